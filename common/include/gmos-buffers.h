@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2025 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -49,6 +49,50 @@ typedef struct gmosBuffer_t {
 
 } gmosBuffer_t;
 
+/**
+ * Defines the GubbinsMOS data buffer cursor structure which is used for
+ * sequential access to the contents of a data buffer. The cursor keeps
+ * track of the buffer segment that holds the current buffer position,
+ * so that successive accesses do not need to walk the buffer segment
+ * list from the start. All fields are private to the data buffer
+ * implementation.
+ */
+typedef struct gmosBufferCursor_t {
+
+    // This is a pointer to the data buffer being accessed.
+    gmosBuffer_t* buffer;
+
+    // This is a pointer to the buffer segment that holds the current
+    // buffer position.
+    gmosMempoolSegment_t* segment;
+
+    // This specifies the offset of the current buffer position within
+    // the current buffer segment.
+    uint16_t segmentOffset;
+
+    // This specifies the current buffer position, expressed as an
+    // offset from the start of the buffer data.
+    uint16_t position;
+
+} gmosBufferCursor_t;
+
+/**
+ * Defines the GubbinsMOS data buffer span structure which is used to
+ * describe a contiguous block of buffer data within a single buffer
+ * segment. Lists of buffer spans are used for scatter-gather transfers
+ * of buffer data, so that the data does not need to be copied to a
+ * contiguous array.
+ */
+typedef struct gmosBufferSpan_t {
+
+    // This is a pointer to the start of the span data.
+    uint8_t* data;
+
+    // This specifies the number of data bytes in the span.
+    uint16_t size;
+
+} gmosBufferSpan_t;
+
 /**
  * Provides a compile time initialisation macro for a GubbinsMOS data
  * buffer. Assigning this macro value to a data buffer variable on
@@ -149,7 +193,8 @@ bool gmosBufferRebase (gmosBuffer_t* buffer, uint16_t size);
  *     written to the data buffer.
  * @return Returns a boolean value which will be set to 'true' if the
  *     data was written to the buffer and 'false' if the buffer was
- *     not large enough to hold the new data.
+ *     not large enough to hold the new data or if memory could not be
+ *     allocated for a private copy of shared buffer segments.
  */
 bool gmosBufferWrite (gmosBuffer_t* buffer, uint16_t offset,
     const uint8_t* writeData, uint16_t writeSize);
@@ -221,7 +266,10 @@ void gmosBufferMove (gmosBuffer_t* source, gmosBuffer_t* destination);
  * source buffer in a destination buffer. Any existing contents of the
  * destination buffer will be discarded. After the buffer copy operation
  * the destination buffer will hold an exact copy of the contents of the
- * source buffer and the source buffer will be unchanged.
+ * source buffer and the source buffer will be unchanged. If shared
+ * segments are enabled, the source buffer segments are shared with the
+ * destination buffer instead of copying the buffer data, and a private
+ * copy of the shared segments is made when either buffer is modified.
  * @param source This is a pointer to the source buffer from which the
  *     buffer data will be replicated.
  * @param destination This is a pointer to the destination buffer into
@@ -238,7 +286,10 @@ bool gmosBufferCopy (gmosBuffer_t* source, gmosBuffer_t* destination);
  * contents of the destination buffer will be discarded. After the
  * buffer copy operation the destination buffer will hold an exact copy
  * of the contents of the source buffer section and the source buffer
- * will be unchanged.
+ * will be unchanged. If shared segments are enabled, the source buffer
+ * segments are shared with the destination buffer unless the amount of
+ * source buffer data after the section exceeds the section size. This
+ * avoids holding large amounts of unused memory for small sections.
  * @param source This is a pointer to the source buffer from which the
  *     buffer data will be replicated.
  * @param destination This is a pointer to the destination buffer into
@@ -262,7 +313,9 @@ bool gmosBufferCopySection (gmosBuffer_t* source,
  * buffer. Any existing contents of the destination buffer will be
  * discarded. After successful completion, the source buffers will be
  * empty and the destination buffer will contain the concatenated source
- * buffer contents.
+ * buffer contents. On failure, the concatenated data will remain split
+ * between the two source buffers and the destination buffer will not
+ * be modified.
  * @param sourceA This is the buffer which contains the first block of
  *     data to be concatenated.
  * @param sourceB This is the buffer which contains the second block of
@@ -280,7 +333,12 @@ bool gmosBufferConcatenate (gmosBuffer_t* sourceA,
 
 /**
  * Gets a reference to the buffer segment that contains data at the
- * specified buffer offset.
+ * specified buffer offset. Buffer segment lists may contain a mixture
+ * of standard and large memory pool segments, so the size of the
+ * returned segment should be determined using the
+ * 'gmosMempoolGetSegmentSize' function. If shared segments are enabled,
+ * the returned segment may be shared with other buffers, so its
+ * contents should only be modified if the buffer was newly allocated.
  * @param buffer This is the buffer which is to be accessed.
  * @param dataOffset This is the offset within the buffer for which the
  *     associated memory segment is being accessed.
@@ -291,6 +349,309 @@ bool gmosBufferConcatenate (gmosBuffer_t* sourceA,
 gmosMempoolSegment_t* gmosBufferGetSegment (gmosBuffer_t* buffer,
     uint16_t dataOffset);
 
+/**
+ * Populates a list of buffer spans that describe the location of the
+ * buffer data in the specified range. Each span refers to the buffer
+ * data in a single buffer segment. If shared segments are enabled, the
+ * span data may be shared with other buffers, so it should only be
+ * modified if the buffer was newly allocated. The spans remain valid
+ * until the buffer is modified or released.
+ * @param buffer This is the buffer which is to be accessed.
+ * @param offset This is the offset within the buffer of the start of
+ *     the data range.
+ * @param size This is the number of bytes in the data range.
+ * @param spans This is a pointer to an array of buffer spans that will
+ *     be populated with the buffer span information.
+ * @param maxSpans This is the number of entries in the buffer span
+ *     array. If the data range requires more spans than are available,
+ *     only the initial part of the data range will be described.
+ * @return Returns the number of buffer spans that were populated. This
+ *     will be zero if the data range is empty or is not contained
+ *     within the buffer.
+ */
+uint8_t gmosBufferGetSpans (gmosBuffer_t* buffer, uint16_t offset,
+    uint16_t size, gmosBufferSpan_t* spans, uint8_t maxSpans);
+
+/**
+ * Initialises a data buffer cursor for sequential access to the
+ * contents of a data buffer, starting at the specified buffer offset.
+ * The buffer size and segment list must not be modified while the
+ * cursor is in use, but the existing buffer contents may be updated
+ * using the cursor write functions.
+ * @param cursor This is the data buffer cursor that is to be
+ *     initialised.
+ * @param buffer This is the data buffer that is to be accessed using
+ *     the cursor.
+ * @param offset This is the initial cursor position, expressed as an
+ *     offset from the start of the buffer data.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     cursor was successfully initialised and 'false' if the initial
+ *     cursor position is beyond the end of the buffer.
+ */
+bool gmosBufferCursorInit (gmosBufferCursor_t* cursor,
+    gmosBuffer_t* buffer, uint16_t offset);
+
+/**
+ * Moves a data buffer cursor to the specified buffer offset. Moving
+ * the cursor forwards only needs to walk the buffer segments between
+ * the current and new cursor positions. Moving the cursor backwards
+ * walks the buffer segment list from the start of the buffer.
+ * @param cursor This is the data buffer cursor that is to be moved.
+ * @param offset This is the new cursor position, expressed as an
+ *     offset from the start of the buffer data.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     cursor was moved to the new position and 'false' if the new
+ *     cursor position is beyond the end of the buffer.
+ */
+bool gmosBufferCursorSeek (gmosBufferCursor_t* cursor, uint16_t offset);
+
+/**
+ * Gets the current position of a data buffer cursor.
+ * @param cursor This is the data buffer cursor that is to be accessed.
+ * @return Returns the current cursor position, expressed as an offset
+ *     from the start of the buffer data.
+ */
+uint16_t gmosBufferCursorGetOffset (gmosBufferCursor_t* cursor);
+
+/**
+ * Gets the number of buffer data bytes that remain between the current
+ * position of a data buffer cursor and the end of the buffer.
+ * @param cursor This is the data buffer cursor that is to be accessed.
+ * @return Returns the number of buffer data bytes remaining after the
+ *     current cursor position.
+ */
+uint16_t gmosBufferCursorGetRemaining (gmosBufferCursor_t* cursor);
+
+/**
+ * Reads data from a buffer at the current cursor position, advancing
+ * the cursor position past the data that was read.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the read operation.
+ * @param readData This is a pointer to the byte array that will be
+ *     updated with the data read from the buffer.
+ * @param readSize This is the number of bytes that should be read from
+ *     the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     data was read from the buffer and 'false' if there was
+ *     insufficient data remaining in the buffer. The cursor position
+ *     is not changed on failure.
+ */
+bool gmosBufferCursorRead (gmosBufferCursor_t* cursor,
+    uint8_t* readData, uint16_t readSize);
+
+/**
+ * Reads data from a buffer at the current cursor position, without
+ * changing the cursor position.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the peek operation.
+ * @param readData This is a pointer to the byte array that will be
+ *     updated with the data read from the buffer.
+ * @param readSize This is the number of bytes that should be read from
+ *     the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     data was read from the buffer and 'false' if there was
+ *     insufficient data remaining in the buffer.
+ */
+bool gmosBufferCursorPeek (gmosBufferCursor_t* cursor,
+    uint8_t* readData, uint16_t readSize);
+
+/**
+ * Writes data to a buffer at the current cursor position, advancing
+ * the cursor position past the data that was written. This overwrites
+ * the existing buffer contents and will not extend the buffer. If
+ * shared segments are enabled, the buffer segment list is checked on
+ * every write and any shared segments are copied before writing.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the write operation.
+ * @param writeData This is a pointer to the byte array that contains
+ *     the data to be written to the buffer.
+ * @param writeSize This is the number of bytes that should be written
+ *     to the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     data was written to the buffer and 'false' if there was
+ *     insufficient space remaining in the buffer or if memory could not
+ *     be allocated for a private copy of shared buffer segments. The
+ *     cursor position is not changed on failure.
+ */
+bool gmosBufferCursorWrite (gmosBufferCursor_t* cursor,
+    const uint8_t* writeData, uint16_t writeSize);
+
+/**
+ * Advances the position of a data buffer cursor by the specified
+ * number of bytes.
+ * @param cursor This is the data buffer cursor that is to be advanced.
+ * @param skipSize This is the number of bytes to be skipped.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     cursor position was advanced and 'false' if there was
+ *     insufficient data remaining in the buffer. The cursor position
+ *     is not changed on failure.
+ */
+bool gmosBufferCursorSkip (gmosBufferCursor_t* cursor,
+    uint16_t skipSize);
+
+/**
+ * Gets the span of contiguous buffer data that starts at the current
+ * cursor position, advancing the cursor position past the end of the
+ * span. The span will not extend beyond the end of the buffer segment
+ * that holds the current cursor position. If shared segments are
+ * enabled, the span data may be shared with other buffers, so it
+ * should only be modified if the buffer was newly allocated.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     accessing the buffer data.
+ * @param maxSize This is the maximum number of bytes that may be
+ *     included in the span.
+ * @param span This is a pointer to the buffer span structure that will
+ *     be populated with the location and size of the span data.
+ * @return Returns a boolean value which will be set to 'true' if a
+ *     span was found and 'false' if there is no more data remaining in
+ *     the buffer or the maximum span size is zero.
+ */
+bool gmosBufferCursorGetSpan (gmosBufferCursor_t* cursor,
+    uint16_t maxSize, gmosBufferSpan_t* span);
+
+/**
+ * Reads an unsigned 8-bit value from a buffer at the current cursor
+ * position, advancing the cursor position on success.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the read operation.
+ * @param value This is a pointer to the variable that will be updated
+ *     with the value read from the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     value was read from the buffer and 'false' if there was
+ *     insufficient data remaining in the buffer.
+ */
+bool gmosBufferCursorReadU8 (gmosBufferCursor_t* cursor,
+    uint8_t* value);
+
+/**
+ * Reads an unsigned 16-bit value in big endian (network) byte order
+ * from a buffer at the current cursor position, advancing the cursor
+ * position on success.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the read operation.
+ * @param value This is a pointer to the variable that will be updated
+ *     with the value read from the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     value was read from the buffer and 'false' if there was
+ *     insufficient data remaining in the buffer.
+ */
+bool gmosBufferCursorReadU16Be (gmosBufferCursor_t* cursor,
+    uint16_t* value);
+
+/**
+ * Reads an unsigned 16-bit value in little endian byte order from a
+ * buffer at the current cursor position, advancing the cursor position
+ * on success.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the read operation.
+ * @param value This is a pointer to the variable that will be updated
+ *     with the value read from the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     value was read from the buffer and 'false' if there was
+ *     insufficient data remaining in the buffer.
+ */
+bool gmosBufferCursorReadU16Le (gmosBufferCursor_t* cursor,
+    uint16_t* value);
+
+/**
+ * Reads an unsigned 32-bit value in big endian (network) byte order
+ * from a buffer at the current cursor position, advancing the cursor
+ * position on success.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the read operation.
+ * @param value This is a pointer to the variable that will be updated
+ *     with the value read from the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     value was read from the buffer and 'false' if there was
+ *     insufficient data remaining in the buffer.
+ */
+bool gmosBufferCursorReadU32Be (gmosBufferCursor_t* cursor,
+    uint32_t* value);
+
+/**
+ * Reads an unsigned 32-bit value in little endian byte order from a
+ * buffer at the current cursor position, advancing the cursor position
+ * on success.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the read operation.
+ * @param value This is a pointer to the variable that will be updated
+ *     with the value read from the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     value was read from the buffer and 'false' if there was
+ *     insufficient data remaining in the buffer.
+ */
+bool gmosBufferCursorReadU32Le (gmosBufferCursor_t* cursor,
+    uint32_t* value);
+
+/**
+ * Writes an unsigned 8-bit value to a buffer at the current cursor
+ * position, advancing the cursor position on success.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the write operation.
+ * @param value This is the value that is to be written to the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     value was written to the buffer and 'false' if there was
+ *     insufficient space remaining in the buffer.
+ */
+bool gmosBufferCursorWriteU8 (gmosBufferCursor_t* cursor,
+    uint8_t value);
+
+/**
+ * Writes an unsigned 16-bit value in big endian (network) byte order
+ * to a buffer at the current cursor position, advancing the cursor
+ * position on success.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the write operation.
+ * @param value This is the value that is to be written to the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     value was written to the buffer and 'false' if there was
+ *     insufficient space remaining in the buffer.
+ */
+bool gmosBufferCursorWriteU16Be (gmosBufferCursor_t* cursor,
+    uint16_t value);
+
+/**
+ * Writes an unsigned 16-bit value in little endian byte order to a
+ * buffer at the current cursor position, advancing the cursor position
+ * on success.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the write operation.
+ * @param value This is the value that is to be written to the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     value was written to the buffer and 'false' if there was
+ *     insufficient space remaining in the buffer.
+ */
+bool gmosBufferCursorWriteU16Le (gmosBufferCursor_t* cursor,
+    uint16_t value);
+
+/**
+ * Writes an unsigned 32-bit value in big endian (network) byte order
+ * to a buffer at the current cursor position, advancing the cursor
+ * position on success.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the write operation.
+ * @param value This is the value that is to be written to the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     value was written to the buffer and 'false' if there was
+ *     insufficient space remaining in the buffer.
+ */
+bool gmosBufferCursorWriteU32Be (gmosBufferCursor_t* cursor,
+    uint32_t value);
+
+/**
+ * Writes an unsigned 32-bit value in little endian byte order to a
+ * buffer at the current cursor position, advancing the cursor position
+ * on success.
+ * @param cursor This is the data buffer cursor that is to be used for
+ *     the write operation.
+ * @param value This is the value that is to be written to the buffer.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     value was written to the buffer and 'false' if there was
+ *     insufficient space remaining in the buffer.
+ */
+bool gmosBufferCursorWriteU32Le (gmosBufferCursor_t* cursor,
+    uint32_t value);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2025 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -54,6 +54,272 @@
 #define GMOS_CONFIG_BACKGROUND_TASK_INTERVAL 10
 #endif
 
+/**
+ * This configuration option specifies the scheduler timer slack, which
+ * is used to reduce the number of device wakeups. It is expressed as an
+ * integer number of system timer ticks. When other scheduled tasks are
+ * due within this number of ticks after the next scheduled task, the
+ * wakeup is delayed so that they can all be run after a single wakeup.
+ * Scheduled tasks may therefore be run up to this number of ticks
+ * after their requested execution time. When the timing wheel is used,
+ * only the earliest deadline in each higher level wheel slot is known,
+ * so some deadlines may not be merged until the slot contents have been
+ * redistributed. Background tasks that are due within the slack window
+ * after a wakeup will also be run early to take advantage of the
+ * wakeup. A value of zero disables wakeup coalescing.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_TIMER_SLACK
+#define GMOS_CONFIG_SCHEDULER_TIMER_SLACK 0
+#endif
+
+/**
+ * This configuration option specifies the minimum idle period for which
+ * the scheduler will run registered idle workers instead of entering
+ * the idle state. It is expressed as an integer number of milliseconds.
+ * Idle workers are only run when no tasks are ready to run and the next
+ * scheduled task deadline is at least this far away.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_IDLE_WORK_MIN_TIME
+#define GMOS_CONFIG_SCHEDULER_IDLE_WORK_MIN_TIME 20
+#endif
+
+/**
+ * This configuration option specifies the maximum execution budget
+ * that will be passed to an idle worker each time it is run. It is
+ * expressed as an integer number of milliseconds. The budget passed to
+ * the idle worker will be reduced if the next scheduled task deadline
+ * is closer than this.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_IDLE_WORK_BUDGET
+#define GMOS_CONFIG_SCHEDULER_IDLE_WORK_BUDGET 5
+#endif
+
+/**
+ * This configuration option selects the hierarchical timing wheel
+ * implementation for the scheduled and background task queues. By
+ * default the task queues are implemented as sorted linked lists,
+ * which are efficient for small numbers of tasks. The timing wheel
+ * provides constant time task insertion and expiry for applications
+ * with large numbers of timed tasks, at the cost of approximately 1.5
+ * KB of additional RAM per task queue on 32-bit platforms.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_TIMING_WHEEL
+#define GMOS_CONFIG_SCHEDULER_TIMING_WHEEL false
+#endif
+
+/**
+ * This configuration option adds a back reference to each task state
+ * data structure, which allows tasks to be removed from the scheduled
+ * and background task queues in constant time when they are resumed.
+ * This adds one pointer to the size of each task state data structure,
+ * so it may be disabled on memory constrained 8-bit targets, in which
+ * case a linear search of the task queue is used instead.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+#define GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL true
+#endif
+
+/**
+ * This configuration option specifies the number of task priority
+ * levels supported by the scheduler ready task queue, in the range
+ * from 1 to 8. Ready tasks are run in order of priority, with tasks at
+ * the same priority level being run in FIFO order. The default setting
+ * of a single priority level runs all ready tasks in FIFO order.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS
+#define GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS 1
+#endif
+
+/**
+ * This configuration option specifies the maximum number of higher
+ * priority tasks that may be run in succession while tasks at the
+ * lowest priority level are ready to run. Once this limit is reached
+ * the next lowest priority task will be run, which prevents the lowest
+ * priority tasks from being starved of processor time.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_STARVATION_LIMIT
+#define GMOS_CONFIG_SCHEDULER_STARVATION_LIMIT 16
+#endif
+
+/**
+ * This configuration option enables scheduler profiling. When enabled,
+ * the scheduler records the number of times each task is run, the task
+ * execution times and the task scheduling latency. This adds a set of
+ * profiling counters to each task state data structure.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_PROFILING
+#define GMOS_CONFIG_SCHEDULER_PROFILING false
+#endif
+
+/**
+ * This configuration option specifies the interval at which the
+ * scheduler profiling statistics will be written to the debug log,
+ * expressed as an integer number of seconds. A value of zero disables
+ * periodic logging of the profiling statistics.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_PROFILING_LOG_INTERVAL
+#define GMOS_CONFIG_SCHEDULER_PROFILING_LOG_INTERVAL 60
+#endif
+
+/**
+ * This configuration option enables per-task execution budgets. When
+ * enabled, the scheduler measures the execution time of each task
+ * using the platform cycle counter and records a budget overrun if it
+ * exceeds the execution budget for the task. Execution times include
+ * the time spent running other tasks while the task is busy waiting.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+#define GMOS_CONFIG_SCHEDULER_TASK_BUDGET false
+#endif
+
+/**
+ * This configuration option specifies the default execution budget
+ * that is assigned to newly started tasks. It is expressed as an
+ * integer number of microseconds. A value of zero disables budget
+ * checking for tasks that do not have an explicit budget set.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_TASK_BUDGET_DEFAULT
+#define GMOS_CONFIG_SCHEDULER_TASK_BUDGET_DEFAULT 50000
+#endif
+
+/**
+ * This configuration option specifies the number of consecutive budget
+ * overruns for a single task that will trigger the scheduler watchdog.
+ * The scheduler watchdog calls the watchdog handler registered by the
+ * application or fails with an assertion if no handler is registered.
+ * A value of zero disables the scheduler watchdog.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_OVERRUN_LIMIT
+#define GMOS_CONFIG_SCHEDULER_OVERRUN_LIMIT 0
+#endif
+
+/**
+ * This configuration option specifies whether the platform provides a
+ * high resolution cycle counter via the 'gmosPalGetCycleCount'
+ * function. Platforms without a cycle counter will use the system
+ * timer instead.
+ */
+#ifndef GMOS_CONFIG_PAL_CYCLE_COUNTER
+#define GMOS_CONFIG_PAL_CYCLE_COUNTER false
+#endif
+
+/**
+ * This configuration option specifies the rate at which the platform
+ * cycle counter increments. This will be the same as the system timer
+ * frequency for platforms that do not provide a cycle counter.
+ */
+#ifndef GMOS_CONFIG_PAL_CYCLE_COUNTER_FREQUENCY
+#define GMOS_CONFIG_PAL_CYCLE_COUNTER_FREQUENCY \
+    GMOS_CONFIG_SYSTEM_TIMER_FREQUENCY
+#endif
+
+/**
+ * This configuration option enables the timeline trace recorder, which
+ * captures scheduler, event and stream activity in a ring buffer for
+ * subsequent analysis.
+ */
+#ifndef GMOS_CONFIG_TRACE_ENABLE
+#define GMOS_CONFIG_TRACE_ENABLE false
+#endif
+
+/**
+ * This configuration option specifies the number of records that may
+ * be held in the trace ring buffer. This must be a power of two. Each
+ * trace record occupies 16 bytes on 32-bit platforms. When multiple
+ * scheduler cores are configured, a separate trace ring buffer of this
+ * size is allocated for each core.
+ */
+#ifndef GMOS_CONFIG_TRACE_BUFFER_SIZE
+#define GMOS_CONFIG_TRACE_BUFFER_SIZE 128
+#endif
+
+/**
+ * This configuration option enables the hot path profiling probes,
+ * which accumulate the minimum, maximum and mean platform cycle counts
+ * for selected code sections.
+ */
+#ifndef GMOS_CONFIG_PROFILE_ENABLE
+#define GMOS_CONFIG_PROFILE_ENABLE false
+#endif
+
+/**
+ * This configuration option specifies the number of profiling probes
+ * that may be recorded. This includes the built in probes, so it must
+ * be at least 'GMOS_PROFILE_ID_APP_FIRST'.
+ */
+#ifndef GMOS_CONFIG_PROFILE_PROBE_COUNT
+#define GMOS_CONFIG_PROFILE_PROBE_COUNT 16
+#endif
+
+/**
+ * This configuration option enables power state residency accounting.
+ * When enabled, the time spent in the active, power save and deep
+ * sleep states is recorded, together with the reason for each wakeup
+ * and an estimate of the energy used.
+ */
+#ifndef GMOS_CONFIG_POWER_RESIDENCY
+#define GMOS_CONFIG_POWER_RESIDENCY false
+#endif
+
+/**
+ * This configuration option specifies the typical device supply
+ * current when the scheduler is active. It is expressed as an integer
+ * number of microamps and is used for power residency energy
+ * estimates. It should normally be set by the platform or application
+ * configuration for the specific device.
+ */
+#ifndef GMOS_CONFIG_POWER_ACTIVE_CURRENT
+#define GMOS_CONFIG_POWER_ACTIVE_CURRENT 0
+#endif
+
+/**
+ * This configuration option specifies the typical device supply
+ * current when the device is in its power save state. It is expressed
+ * as an integer number of microamps and is used for power residency
+ * energy estimates.
+ */
+#ifndef GMOS_CONFIG_POWER_SAVE_CURRENT
+#define GMOS_CONFIG_POWER_SAVE_CURRENT 0
+#endif
+
+/**
+ * This configuration option specifies the typical device supply
+ * current when the device is in its deep sleep state. It is expressed
+ * as an integer number of microamps and is used for power residency
+ * energy estimates.
+ */
+#ifndef GMOS_CONFIG_POWER_DEEP_SLEEP_CURRENT
+#define GMOS_CONFIG_POWER_DEEP_SLEEP_CURRENT 0
+#endif
+
+/**
+ * This configuration option specifies the device supply voltage. It is
+ * expressed as an integer number of millivolts and is used for power
+ * residency energy estimates.
+ */
+#ifndef GMOS_CONFIG_POWER_SUPPLY_VOLTAGE
+#define GMOS_CONFIG_POWER_SUPPLY_VOLTAGE 3300
+#endif
+
+/**
+ * This configuration option specifies the number of deferred call
+ * queues. Each queue has its own priority, with queue zero being the
+ * highest priority queue. A value of zero disables deferred call
+ * support.
+ */
+#ifndef GMOS_CONFIG_DEFERRED_CALL_QUEUES
+#define GMOS_CONFIG_DEFERRED_CALL_QUEUES 0
+#endif
+
+/**
+ * This configuration option specifies the maximum number of deferred
+ * calls that may be held in each deferred call queue. This must be a
+ * power of two, no greater than 128.
+ */
+#ifndef GMOS_CONFIG_DEFERRED_CALL_QUEUE_SIZE
+#define GMOS_CONFIG_DEFERRED_CALL_QUEUE_SIZE 8
+#endif
+
 /**
  * This configuration option specifies whether the GubbinsMOS platform
  * is hosted by a multithreaded operating system, such as a conventional
@@ -63,6 +329,53 @@
 #define GMOS_CONFIG_HOST_OS_SUPPORT false
 #endif
 
+/**
+ * This configuration option specifies the maximum number of consecutive
+ * active scheduler steps that may be run for each acquisition of the
+ * host operating system mutex. Holding the mutex over a batch of steps
+ * reduces the mutex overhead when many tasks are ready to run. The
+ * mutex is always released when the scheduler requests an idle period.
+ * Setting this to one releases the mutex after every scheduler step.
+ */
+#ifndef GMOS_CONFIG_HOST_OS_LOCK_BATCH_SIZE
+#define GMOS_CONFIG_HOST_OS_LOCK_BATCH_SIZE 16
+#endif
+
+/**
+ * This configuration option specifies the maximum time for which the
+ * host operating system mutex may be held over a batch of scheduler
+ * steps. This bounds the time for which other host threads may be
+ * locked out when the scheduler is busy. It is expressed as an integer
+ * number of milliseconds, and setting it to zero disables the time
+ * limit so that only the batch size is used.
+ */
+#ifndef GMOS_CONFIG_HOST_OS_LOCK_BATCH_TIME
+#define GMOS_CONFIG_HOST_OS_LOCK_BATCH_TIME 5
+#endif
+
+/**
+ * This configuration option specifies whether the scheduler, event and
+ * memory pool state is held in separate GubbinsMOS instance data
+ * structures instead of static variables. This allows multiple
+ * independent GubbinsMOS instances to be run in a single host process,
+ * which is useful for simulating large numbers of devices.
+ */
+#ifndef GMOS_CONFIG_INSTANCE_SUPPORT
+#define GMOS_CONFIG_INSTANCE_SUPPORT false
+#endif
+
+/**
+ * This configuration option specifies the number of processor cores
+ * that run independent GubbinsMOS schedulers. When set to more than
+ * one, the platform creates a separate GubbinsMOS instance for each
+ * core, so instance support must also be enabled. Tasks always run on
+ * the core from which they were started, and calls may be passed
+ * between cores using the instance core call functions.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_CORES
+#define GMOS_CONFIG_SCHEDULER_CORES 1
+#endif
+
 /**
  * This configuration option specifies the size of the 'C' language call
  * stack to be used for platforms where this needs to be explicitly
@@ -116,6 +429,55 @@
 #define GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER 64
 #endif
 
+/**
+ * This configuration option specifies the size of the optional large
+ * memory pool segments as an integer number of bytes. Large segments
+ * are used by buffers and streams for bulk data transfers, reducing
+ * the length of the segment lists used for large payloads while the
+ * standard segment size may be kept small. This must be an integer
+ * multiple of 4 and greater than the standard segment size. A value of
+ * zero disables large segment support.
+ */
+#ifndef GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE
+#define GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE 0
+#endif
+
+/**
+ * This configuration option specifies the number of large memory pool
+ * segments to be allocated. Large segments are always allocated
+ * statically, even when the heap is being used for standard memory
+ * pool segments.
+ */
+#ifndef GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER
+#define GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER 4
+#endif
+
+/**
+ * This configuration option enables reference counted memory pool
+ * segments, which allows data buffer copy and section copy operations
+ * to share the source buffer segments instead of copying the buffer
+ * contents. Shared segments are copied on demand when one of the data
+ * buffers that refers to them is modified. Shared segments are not
+ * supported when the memory pool uses the heap for data storage.
+ */
+#ifndef GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+#define GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS false
+#endif
+
+/**
+ * This configuration option enables memory pool telemetry, which
+ * records the current and peak memory pool usage, the number of failed
+ * allocation requests and the time spent with the number of free
+ * segments below the low capacity threshold. Memory pool usage is also
+ * recorded for each owner tag, where the owner tag is taken from the
+ * task that was running when each segment was allocated. Memory pool
+ * telemetry is not supported when the memory pool uses the heap for
+ * data storage.
+ */
+#ifndef GMOS_CONFIG_MEMPOOL_TELEMETRY
+#define GMOS_CONFIG_MEMPOOL_TELEMETRY false
+#endif
+
 /**
  * This configuration option is used to select memcpy as the method for
  * transferring data to and from the stream buffers. By default an
@@ -0,0 +1,125 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * This header defines the API for GubbinsMOS deferred calls. Deferred
+ * calls allow interrupt service routines to pass work to handler
+ * functions that will be run from the scheduler context, without
+ * disabling interrupts. Each deferred call queue is a lock free single
+ * producer, single consumer ring buffer. The scheduler is the only
+ * consumer, so calls to post to a given queue must not be able to
+ * preempt each other. Typically this means that each queue should only
+ * be used by interrupt service routines running at the same interrupt
+ * priority level.
+ */
+
+#ifndef GMOS_DEFERRED_H
+#define GMOS_DEFERRED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gmos-config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Defines the function prototype to be used for deferred call handler
+ * functions.
+ * @param callData This is an opaque pointer to the data item that was
+ *     supplied when the deferred call was posted.
+ */
+typedef void (*gmosDeferredCallFn_t) (void* callData);
+
+/**
+ * Defines the data structure used for each deferred call queue entry.
+ */
+typedef struct gmosDeferredCall_t {
+    gmosDeferredCallFn_t callFn;
+    void* callData;
+} gmosDeferredCall_t;
+
+/**
+ * Defines the data structure used for each deferred call queue. The
+ * write counter is only updated by the producer and the read counter
+ * is only updated by the consumer. Single byte counters are used so
+ * that they can be accessed atomically on all platforms.
+ */
+typedef struct gmosDeferredCallQueue_t {
+    gmosDeferredCall_t calls [GMOS_CONFIG_DEFERRED_CALL_QUEUE_SIZE];
+    volatile uint8_t writeCount;
+    volatile uint8_t readCount;
+} gmosDeferredCallQueue_t;
+
+/**
+ * Posts a deferred call to the specified deferred call queue instance.
+ * This does not disable interrupts or wake the consumer. The same
+ * single producer, single consumer restrictions apply as for the
+ * standard deferred call queues.
+ * @param queue This is the deferred call queue instance that is to be
+ *     used.
+ * @param callFn This is the handler function that is to be called.
+ * @param callData This is an opaque pointer to a data item that will be
+ *     passed to the handler function.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     deferred call was queued and 'false' if the queue was full.
+ */
+bool gmosDeferredCallQueuePost (gmosDeferredCallQueue_t* queue,
+    gmosDeferredCallFn_t callFn, void* callData);
+
+/**
+ * Runs all the deferred calls that are currently held in the specified
+ * deferred call queue instance. This must only be called by the queue
+ * consumer.
+ * @param queue This is the deferred call queue instance that is to be
+ *     processed.
+ * @return Returns a boolean value which will be set to 'true' if one
+ *     or more deferred calls were run and 'false' otherwise.
+ */
+bool gmosDeferredCallQueueProcess (gmosDeferredCallQueue_t* queue);
+
+/**
+ * Posts a deferred call to the specified deferred call queue. This may
+ * be called from interrupt service routines and does not disable
+ * interrupts. The handler function will be called from the scheduler
+ * context before any ready tasks are run.
+ * @param queueId This is the deferred call queue to be used. Queue zero
+ *     is the highest priority queue and will always be processed first.
+ * @param callFn This is the handler function that is to be called.
+ * @param callData This is an opaque pointer to a data item that will be
+ *     passed to the handler function.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     deferred call was queued and 'false' if the queue was full.
+ */
+bool gmosDeferredCallPost (uint8_t queueId,
+    gmosDeferredCallFn_t callFn, void* callData);
+
+/**
+ * Runs all the deferred calls that are currently held in the deferred
+ * call queues, in priority order. This is called by the scheduler on
+ * each scheduler step and should not be called directly.
+ * @return Returns a boolean value which will be set to 'true' if one
+ *     or more deferred calls were run and 'false' otherwise.
+ */
+bool gmosDeferredCallProcess (void);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // GMOS_DEFERRED_H
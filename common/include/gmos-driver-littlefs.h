@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2025 Zynaptic Limited
+ * Copyright 2025-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -82,6 +82,9 @@ typedef struct gmosDriverLittlefs_t {
     // Allocate the main task data structure.
     gmosTaskState_t lfsTask;
 
+    // Allocate the idle worker used to start garbage collection.
+    gmosIdleWorker_t lfsGcWorker;
+
     // Allocate the LittleFS file system main data structure.
     lfs_t lfsInstance;
 
@@ -114,7 +117,8 @@ typedef struct gmosDriverLittlefs_t {
  * @param gcInterval This is the periodic garbage collection interval to
  *     be used while the file system is mounted, expressed as an integer
  *     number of seconds. A value of zero will disable periodic garbage
- *     collection.
+ *     collection. Garbage collection that is due will be deferred
+ *     until the scheduler would otherwise be idle.
  * @return Returns a boolean value which will be set to 'true' on
  *     successfully setting up the file system driver and 'false' on
  *     failure.
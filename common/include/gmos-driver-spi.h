@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2023 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,6 +29,7 @@
 
 #include "gmos-scheduler.h"
 #include "gmos-events.h"
+#include "gmos-buffers.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -169,6 +170,18 @@ typedef struct gmosDriverSpiBus_t {
     // This is the current internal SPI bus state.
     uint8_t busState;
 
+    // This is a pointer to the list of remaining buffer spans to be
+    // transferred during a chained SPI I/O transaction.
+    gmosBufferSpan_t* spanList;
+
+    // This is the number of bytes already transferred during a chained
+    // SPI I/O transaction.
+    uint16_t spanTransferSize;
+
+    // This is the number of remaining buffer spans to be transferred
+    // during a chained SPI I/O transaction.
+    uint8_t spanCount;
+
 } gmosDriverSpiBus_t;
 
 /**
@@ -184,7 +197,7 @@ typedef struct gmosDriverSpiBus_t {
  *     configuration options to be used with the SPI interface.
  */
 #define GMOS_DRIVER_SPI_PAL_CONFIG(_palData_, _palConfig_)             \
-    { _palData_, _palConfig_, NULL, NULL, NULL, 0, 0 }
+    { _palData_, _palConfig_, NULL, NULL, NULL, 0, 0, NULL, 0, 0 }
 
 /**
  * Initialises a SPI bus interface data structure and initiates the
@@ -312,6 +325,56 @@ bool gmosDriverSpiIoRead (gmosDriverSpiBus_t* spiInterface,
 bool gmosDriverSpiIoTransfer (gmosDriverSpiBus_t* spiInterface,
     uint8_t* writeData, uint8_t* readData, uint16_t transferSize);
 
+/**
+ * Initiates a chained SPI write request for a device peripheral
+ * connected to the SPI interface, using a list of buffer spans as the
+ * data source. The buffer spans are written in order as a single
+ * transaction, without releasing the chip select between spans. Each
+ * buffer span is started from the platform transfer completion handler
+ * for the previous span, so the client task is only notified on
+ * completion of the entire transaction. The chip select must already
+ * have been asserted using 'gmosDriverSpiDeviceSelect'. On completion
+ * the total number of bytes transferred will be indicated by
+ * 'gmosDriverSpiIoComplete'.
+ * @param spiInterface This is the SPI state data structure which is
+ *     associated with the SPI bus.
+ * @param writeSpans This is a pointer to the list of buffer spans that
+ *     are to be written to the SPI peripheral. The span list and the
+ *     data it refers to must remain valid for the full duration of the
+ *     transaction.
+ * @param spanCount This specifies the number of buffer spans in the
+ *     span list. It must be greater than zero.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     SPI write was initiated and is now active and 'false' otherwise.
+ */
+bool gmosDriverSpiIoWriteSpans (gmosDriverSpiBus_t* spiInterface,
+    gmosBufferSpan_t* writeSpans, uint8_t spanCount);
+
+/**
+ * Initiates a chained SPI read request for a device peripheral
+ * connected to the SPI interface, using a list of buffer spans as the
+ * data destination. The buffer spans are filled in order as a single
+ * transaction, without releasing the chip select between spans. Each
+ * buffer span is started from the platform transfer completion handler
+ * for the previous span, so the client task is only notified on
+ * completion of the entire transaction. The chip select must already
+ * have been asserted using 'gmosDriverSpiDeviceSelect'. On completion
+ * the total number of bytes transferred will be indicated by
+ * 'gmosDriverSpiIoComplete'.
+ * @param spiInterface This is the SPI state data structure which is
+ *     associated with the SPI bus.
+ * @param readSpans This is a pointer to the list of buffer spans that
+ *     will be updated with the data read from the SPI peripheral. The
+ *     span list and the data it refers to must remain valid for the
+ *     full duration of the transaction.
+ * @param spanCount This specifies the number of buffer spans in the
+ *     span list. It must be greater than zero.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     SPI read was initiated and is now active and 'false' otherwise.
+ */
+bool gmosDriverSpiIoReadSpans (gmosDriverSpiBus_t* spiInterface,
+    gmosBufferSpan_t* readSpans, uint8_t spanCount);
+
 /**
  * Completes an asynchronous SPI transaction for a device peripheral
  * connected to the SPI interface.
@@ -391,6 +454,23 @@ gmosDriverSpiStatus_t gmosDriverSpiIoInlineTransfer
     (gmosDriverSpiBus_t* spiInterface, uint8_t* writeData,
     uint8_t* readData, uint16_t transferSize);
 
+/**
+ * Signals the completion of a platform specific SPI transfer. This
+ * must be called by the platform abstraction layer from the transfer
+ * completion interrupt or callback instead of setting the device
+ * completion event directly. For chained buffer span transactions the
+ * transfer for the next buffer span is started immediately from the
+ * caller context, and the completion event is only set once all the
+ * buffer spans have been transferred or a transfer error occurs.
+ * @param spiInterface This is the SPI interface data structure for
+ *     which the current transfer has completed.
+ * @param eventFlags This is the set of completion event flags for the
+ *     current transfer, which includes the completion flag, the status
+ *     value and the number of bytes transferred.
+ */
+void gmosDriverSpiIoNotifyComplete (gmosDriverSpiBus_t* spiInterface,
+    uint32_t eventFlags);
+
 /**
  * Initialises the platform abstraction layer for a given SPI interface.
  * Refer to the platform specific SPI implementation for details of the
@@ -416,7 +496,9 @@ void gmosDriverSpiPalClockSetup (gmosDriverSpiBus_t* spiInterface);
 
 /**
  * Performs a platform specific SPI transaction using the given SPI
- * interface.
+ * interface. Completion must be signalled by calling the
+ * 'gmosDriverSpiIoNotifyComplete' function, which may in turn call
+ * this function to start the next transfer in a chained transaction.
  * @param spiInterface This is the SPI interface data structure, which
  *     will have been configured with all the parameters required to
  *     initiate the SPI transaction.
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2024 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,13 +18,17 @@
 
 /*
  * This header defines the API for GubbinsMOS asynchronous event flag
- * support.
+ * support. The functions for modifying event bits may be called from
+ * interrupt service routines. They only disable interrupts for a fixed
+ * number of operations, which does not depend on the number of events
+ * that are currently waiting to be processed.
  */
 
 #ifndef GMOS_EVENTS_H
 #define GMOS_EVENTS_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include "gmos-scheduler.h"
 
@@ -50,8 +54,39 @@ typedef struct gmosEvent_t {
     // only be accessed via the get, set and clear functions.
     uint32_t eventBits;
 
+    // This is the system timer value at which the current event wait
+    // times out.
+    uint32_t waitDeadline;
+
+    // This is a flag which is used to indicate that the event is
+    // currently held in the pending event queue.
+    bool eventQueued;
+
 } gmosEvent_t;
 
+/**
+ * Defines the event queue state data structure. This holds the pending
+ * event queue for a single GubbinsMOS instance, and is normally
+ * allocated statically by the event implementation. When instance
+ * support is enabled, it forms part of the GubbinsMOS instance data
+ * structure instead. All fields are private to the event
+ * implementation.
+ */
+typedef struct gmosEventQueueState_t {
+
+    // Specifies the head of the pending event queue.
+    gmosEvent_t* pendingEvents;
+
+    // Specifies the end of the pending event queue. This is only valid
+    // when the pending event queue is not empty.
+    gmosEvent_t* pendingEventsEnd;
+
+    // Specifies a volatile flag that can be used to avoid disabling
+    // interrupts to check for queued events.
+    volatile bool pendingEventsReady;
+
+} gmosEventQueueState_t;
+
 /**
  * Provides a compile time initialisation macro for a set of GubbinsMOS
  * event flags. Assigning this macro value to an event state variable on
@@ -63,7 +98,7 @@ typedef struct gmosEvent_t {
  *     disable this functionality.
  */
 #define GMOS_EVENT_INIT(_consumer_task_)                               \
-    { _consumer_task_, NULL, 0 }
+    { _consumer_task_, NULL, 0, 0, false }
 
 /**
  * Performs a one-time initialisation of a set of GubbinsMOS event
@@ -177,6 +212,64 @@ uint32_t gmosEventClearBits (gmosEvent_t* event, uint32_t bitMask);
  */
 uint32_t gmosEventResetBits (gmosEvent_t* event);
 
+/**
+ * Starts waiting for one or more event bits to be set, with the
+ * specified timeout. This sets the wait deadline that will be used by
+ * subsequent calls to 'gmosEventWaitPending'. Only the consumer task
+ * for the event should wait on it.
+ * @param event This is the event state data structure for which the
+ *     event wait is being started.
+ * @param timeout This is the maximum time to wait for the event bits
+ *     to be set, expressed as an integer number of system timer ticks.
+ */
+void gmosEventWaitStart (gmosEvent_t* event, uint32_t timeout);
+
+/**
+ * Checks whether an event wait is still pending. The wait will be
+ * complete when any of the event bits selected by the bit mask are set
+ * or the wait deadline has been reached. While the wait is pending, the
+ * task status will be set so that the consumer task is not run again
+ * until the event bits are modified or the wait deadline is reached.
+ * Any change to the event bits will run the consumer task early, so it
+ * should continue to check for completion until this function returns
+ * 'false'.
+ * @param event This is the event state data structure for which the
+ *     event wait is being checked.
+ * @param bitMask This is a bit vector specifying the event bits that
+ *     are to be checked.
+ * @param taskStatus This is a pointer to the task status which will be
+ *     updated if the event wait is still pending.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     event wait is still pending and 'false' if it has completed.
+ *     The event bits should be checked to determine whether the wait
+ *     completed successfully or timed out.
+ */
+bool gmosEventWaitPending (gmosEvent_t* event, uint32_t bitMask,
+    gmosTaskStatus_t* taskStatus);
+
+/**
+ * Waits for one or more event bits to be set, with the specified
+ * timeout. This holds the state of the current task on the call stack
+ * while other tasks are run, so it should only be used where the task
+ * function can not return control to the scheduler, such as when
+ * implementing blocking callbacks for third party libraries. Unlike
+ * direct busy waiting, the device may be placed in a low power state
+ * when no other tasks are ready to run. Events that have no consumer
+ * task will still wake the device, since the busy waiting task is used
+ * as a temporary consumer for the duration of the wait.
+ * @param event This is the event state data structure for which the
+ *     event wait is being performed.
+ * @param bitMask This is a bit vector specifying the event bits that
+ *     are to be checked.
+ * @param timeout This is the maximum time to wait for the event bits
+ *     to be set, expressed as an integer number of system timer ticks.
+ * @return Returns a boolean value which will be set to 'true' if any of
+ *     the specified event bits were set and 'false' if the wait timed
+ *     out.
+ */
+bool gmosEventBusyWait (gmosEvent_t* event, uint32_t bitMask,
+    uint32_t timeout);
+
 /**
  * If one or more events have occurred, this function will return the
  * associated consumer tasks in the order in which the events occured.
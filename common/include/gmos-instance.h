@@ -0,0 +1,218 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * This header defines the API for running multiple GubbinsMOS instances
+ * in a single host process. When instance support is enabled, the
+ * scheduler, event queue, callback timer and memory pool state is held
+ * in an instance data structure instead of static variables, and all
+ * the GubbinsMOS API functions operate on the currently selected
+ * instance. This is intended for host based simulation, where a test
+ * harness steps a large number of simulated devices in turn from a
+ * single host thread. Platform, trace, deferred call and random number
+ * generator state is shared by all instances, as is any static state
+ * used by drivers and application code. Each task runs on the instance
+ * that was selected when it was started, and events that are set or
+ * tasks that are resumed from other instances are always queued on the
+ * instance that runs the task.
+ *
+ * Instances are also used to run independent schedulers on each core
+ * of multicore devices. In this case the platform creates and selects
+ * a separate instance for each core, and the currently selected
+ * instance is tracked independently for each core. Tasks always run on
+ * the core from which they were started, and events are always queued
+ * for the core that runs the consumer task. A single memory pool is
+ * shared by all cores and the standard deferred call queues are always
+ * processed by core zero. Calls may also be passed between cores using
+ * the lock free core call queues.
+ */
+
+#ifndef GMOS_INSTANCE_H
+#define GMOS_INSTANCE_H
+
+#include <stdint.h>
+#include "gmos-config.h"
+#include "gmos-scheduler.h"
+#include "gmos-events.h"
+#include "gmos-mempool.h"
+#include "gmos-deferred.h"
+#include "gmos-timers.h"
+#include "gmos-power.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Specifies the index of the processor core that is currently running.
+ * This must be defined in the platform configuration header when
+ * multiple scheduler cores are configured.
+ */
+#ifndef GMOS_PAL_CORE_ID
+#define GMOS_PAL_CORE_ID 0
+#endif
+
+// Instance support is only available if configured.
+#if GMOS_CONFIG_INSTANCE_SUPPORT
+
+/**
+ * Specifies the currently selected GubbinsMOS instance for the
+ * processor core that is currently running.
+ */
+#define GMOS_INSTANCE_CURRENT (gmosInstanceCurrent [GMOS_PAL_CORE_ID])
+
+/**
+ * Defines the GubbinsMOS instance data structure which is used to hold
+ * all the per instance state for a single simulated device or
+ * processor core.
+ */
+typedef struct gmosInstance_t {
+
+    // Specifies the scheduler state for the instance.
+    gmosSchedulerState_t schedulerState;
+
+    // Specifies the pending event queue state for the instance.
+    gmosEventQueueState_t eventQueueState;
+
+    // Specifies the callback timer state for the instance.
+    gmosTimerState_t timerState;
+
+    // Specifies the power state residency accounting state for the
+    // instance.
+#if GMOS_CONFIG_POWER_RESIDENCY
+    gmosPowerState_t powerState;
+#endif
+
+    // Specifies the memory pool state for the instance. A single
+    // memory pool is shared by all processor cores.
+#if (GMOS_CONFIG_SCHEDULER_CORES == 1)
+    gmosMempoolState_t mempoolState;
+#endif
+
+    // Specifies the queues used for passing calls from each of the
+    // processor cores to the core that runs the instance.
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+    gmosDeferredCallQueue_t coreCallQueues [
+        GMOS_CONFIG_SCHEDULER_CORES];
+#endif
+
+    // This is an opaque pointer to the test harness data associated
+    // with the instance.
+    void* instanceData;
+
+} gmosInstance_t;
+
+/**
+ * Specifies the currently selected GubbinsMOS instance for each
+ * processor core. This should only be modified using the
+ * 'gmosInstanceSelect' function.
+ */
+extern gmosInstance_t* gmosInstanceCurrent [
+    GMOS_CONFIG_SCHEDULER_CORES];
+
+/**
+ * Initialises a GubbinsMOS instance and selects it as the current
+ * instance. This resets the scheduler, event queue, callback timer and
+ * core call queue state and sets up the instance memory pool if
+ * required. Application tasks for the instance may then be started
+ * before the instance is first stepped.
+ * @param instance This is the GubbinsMOS instance data structure that
+ *     is to be initialised.
+ * @param instanceData This is an opaque pointer to the test harness
+ *     data that is to be associated with the instance.
+ */
+void gmosInstanceInit (gmosInstance_t* instance, void* instanceData);
+
+/**
+ * Selects a GubbinsMOS instance as the current instance for the
+ * processor core that is currently running. All subsequent GubbinsMOS
+ * API calls on that core will then operate on the selected instance.
+ * @param instance This is the GubbinsMOS instance that is to be
+ *     selected.
+ */
+static inline void gmosInstanceSelect (gmosInstance_t* instance)
+{
+    GMOS_INSTANCE_CURRENT = instance;
+}
+
+/**
+ * Selects a GubbinsMOS instance and performs a single scheduler step
+ * for it. A test harness will typically step all instances in turn,
+ * repeating this until they all request an idle period and then
+ * idling for the shortest requested period.
+ * @param instance This is the GubbinsMOS instance that is to be
+ *     stepped.
+ * @return Returns the number of system timer ticks for which the
+ *     instance can idle, or zero if the instance should be stepped
+ *     again immediately.
+ */
+uint32_t gmosInstanceStep (gmosInstance_t* instance);
+
+/**
+ * Initialises a GubbinsMOS instance for a processor core and then runs
+ * the scheduler loop for that core. This is called by the platform
+ * specific startup code on each secondary processor core and does not
+ * return.
+ * @param instance This is the GubbinsMOS instance data structure that
+ *     is to be used by the processor core.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+void gmosInstanceCoreStart (gmosInstance_t* instance);
+#endif
+
+/**
+ * Posts a call to the scheduler running on the specified processor
+ * core. The handler function will be called from the scheduler context
+ * of the target core before any ready tasks are run. This must only be
+ * called from task context, and not from interrupt service routines.
+ * @param coreId This is the index of the processor core on which the
+ *     handler function is to be called.
+ * @param callFn This is the handler function that is to be called.
+ * @param callData This is an opaque pointer to a data item that will be
+ *     passed to the handler function.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     call was queued and 'false' if the queue was full or the target
+ *     core has not been started.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+bool gmosInstanceCoreCallPost (uint8_t coreId,
+    gmosDeferredCallFn_t callFn, void* callData);
+#endif
+
+/**
+ * Runs all the calls that have been posted to the current processor
+ * core by other processor cores. This is called by the scheduler on
+ * each scheduler step and should not be called directly.
+ * @return Returns a boolean value which will be set to 'true' if one
+ *     or more calls were run and 'false' otherwise.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+bool gmosInstanceCoreCallProcess (void);
+#endif
+
+#endif // GMOS_CONFIG_INSTANCE_SUPPORT
+
+// Multiple scheduler cores require instance support.
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1) && !GMOS_CONFIG_INSTANCE_SUPPORT
+#error "Multiple scheduler cores require instance support."
+#endif
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // GMOS_INSTANCE_H
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,14 +18,20 @@
 
 /*
  * This header defines the API for the GubbinsMOS memory pool, which
- * supports fixed sized dynamic memory allocation.
+ * supports fixed sized dynamic memory allocation. An optional class of
+ * large memory pool segments may also be configured for use with bulk
+ * data transfers. Optional memory pool telemetry may be used to
+ * record memory pool usage, including the memory pool usage for each
+ * of a small set of owner tags.
  */
 
 #ifndef GMOS_MEMPOOL_H
 #define GMOS_MEMPOOL_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "gmos-config.h"
+#include "gmos-scheduler.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -49,6 +55,137 @@ typedef struct gmosMempoolSegment_t {
 
 } gmosMempoolSegment_t;
 
+/**
+ * Defines the GubbinsMOS large memory pool segment data structure.
+ * This has the same layout as the standard memory pool segment, but
+ * with additional space for segment data. Large segments are always
+ * accessed using standard memory pool segment references.
+ */
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+typedef struct gmosMempoolLargeSegment_t {
+
+    // Specifies the location of the next segment in the list.
+    struct gmosMempoolSegment_t* nextSegment;
+
+    // Allocates a block of word aligned segment data which may be
+    // accessed as either a byte array or a 32-bit word array.
+    union {
+        uint32_t words [GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE / 4];
+        uint8_t  bytes [GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE];
+    } data;
+
+} gmosMempoolLargeSegment_t;
+#endif
+
+/**
+ * Defines the set of owner tags that may be used to attribute memory
+ * pool usage when memory pool telemetry is enabled. The owner tag for
+ * each allocated segment is taken from the task that was running when
+ * the segment was allocated.
+ */
+typedef enum {
+    GMOS_MEMPOOL_OWNER_OTHER,
+    GMOS_MEMPOOL_OWNER_NETWORK,
+    GMOS_MEMPOOL_OWNER_TLS,
+    GMOS_MEMPOOL_OWNER_CBOR,
+    GMOS_MEMPOOL_OWNER_SENSOR,
+    GMOS_MEMPOOL_OWNER_DISPLAY,
+    GMOS_MEMPOOL_OWNER_COUNT
+} gmosMempoolOwner_t;
+
+/**
+ * Defines the memory pool telemetry data structure that is used to
+ * report the current memory pool usage statistics.
+ */
+typedef struct gmosMempoolStats_t {
+
+    // This is the total time spent with the number of free standard
+    // segments below the low capacity threshold, expressed as an
+    // integer number of system timer ticks.
+    uint64_t lowCapacityTicks;
+
+    // This is the number of times that the number of free standard
+    // segments has fallen below the low capacity threshold.
+    uint32_t lowCapacityCount;
+
+    // This is the number of memory pool allocation requests that
+    // failed because insufficient segments were available.
+    uint32_t allocFailCount;
+
+    // This is the current and peak memory pool usage for each owner
+    // tag, expressed as an integer number of bytes of allocated
+    // segment data capacity.
+    uint32_t ownerBytes [GMOS_MEMPOOL_OWNER_COUNT];
+    uint32_t ownerPeakBytes [GMOS_MEMPOOL_OWNER_COUNT];
+
+    // This is the current and peak number of allocated standard
+    // segments.
+    uint16_t segmentsInUse;
+    uint16_t peakSegmentsInUse;
+
+    // This is the current and peak number of allocated large segments.
+    uint16_t largeSegmentsInUse;
+    uint16_t peakLargeSegmentsInUse;
+
+} gmosMempoolStats_t;
+
+/**
+ * Defines the memory pool state data structure. This holds the memory
+ * pool for a single GubbinsMOS instance, and is normally allocated
+ * statically by the memory pool implementation. When instance support
+ * is enabled, it forms part of the GubbinsMOS instance data structure
+ * instead. All fields are private to the memory pool implementation.
+ */
+typedef struct gmosMempoolState_t {
+
+    // Specifies the head of the free segment list.
+    gmosMempoolSegment_t* freeList;
+
+    // Specifies the number of available free segments.
+    uint_fast16_t freeSegmentCount;
+
+    // Specifies the head of the large segment free list, the number of
+    // available large segments and the large segment storage.
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    gmosMempoolSegment_t* largeFreeList;
+    uint_fast16_t largeFreeSegmentCount;
+    gmosMempoolLargeSegment_t largeSegments [
+        GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER];
+#endif
+
+    // Specifies the number of additional references to each standard
+    // and large memory pool segment when shared segments are enabled.
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+    uint16_t segmentRefs [GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER];
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    uint16_t largeSegmentRefs [
+        GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER];
+#endif
+#endif
+
+    // Specifies the memory pool telemetry state, including the owner
+    // tag for each standard and large memory pool segment.
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+    gmosMempoolStats_t stats;
+    uint32_t lowCapacityTime;
+    bool lowCapacity;
+    uint8_t segmentOwners [GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER];
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    uint8_t largeSegmentOwners [
+        GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER];
+#endif
+#endif
+
+    // Allocates the memory pool segments. These are allocated from the
+    // heap instead if dynamic memory management is being used.
+#if (GMOS_CONFIG_MEMPOOL_USE_HEAP)
+    gmosMempoolSegment_t segments [0];
+#else
+    gmosMempoolSegment_t segments [GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER];
+#endif
+
+} gmosMempoolState_t;
+
 /**
  * Initialises the memory pool. This is called automatically during
  * system initialisation to set up the memory pool.
@@ -63,6 +200,69 @@ void gmosMempoolInit (void);
  */
 uint16_t gmosMempoolSegmentsAvailable (void);
 
+/**
+ * Determines the number of free large memory pool segments currently
+ * available for allocation.
+ * @return Returns the number of large memory pool segments currently
+ *     available for allocation. This will always be zero if large
+ *     segment support has not been configured.
+ */
+uint16_t gmosMempoolLargeSegmentsAvailable (void);
+
+/**
+ * Determines the data capacity of a memory pool segment. This will be
+ * the standard segment size unless large segment support has been
+ * configured and the segment is a large segment.
+ * @param segment This is a pointer to the memory pool segment that is
+ *     to be checked.
+ * @return Returns the number of data bytes that may be stored in the
+ *     memory pool segment.
+ */
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+uint16_t gmosMempoolGetSegmentSize (gmosMempoolSegment_t* segment);
+#else
+static inline uint16_t gmosMempoolGetSegmentSize (
+    gmosMempoolSegment_t* segment)
+{
+    (void) segment;
+    return GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
+}
+#endif
+
+/**
+ * Adds a reference to a shared memory pool segment. Segments are
+ * linked into lists, so each reference to a segment also refers to all
+ * the segments that follow it in the list. Each reference must be
+ * released by passing the segment to 'gmosMempoolFree' or
+ * 'gmosMempoolFreeSegments'. This is only available if shared segments
+ * have been enabled.
+ * @param segment This is a pointer to the memory pool segment that is
+ *     to be shared.
+ */
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+void gmosMempoolRetain (gmosMempoolSegment_t* segment);
+#endif
+
+/**
+ * Determines whether a memory pool segment is currently shared. The
+ * contents of a shared segment and the segments that follow it in the
+ * segment list must not be modified.
+ * @param segment This is a pointer to the memory pool segment that is
+ *     to be checked.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     segment has more than one reference and 'false' otherwise. This
+ *     will always be 'false' if shared segments have not been enabled.
+ */
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+bool gmosMempoolIsShared (gmosMempoolSegment_t* segment);
+#else
+static inline bool gmosMempoolIsShared (gmosMempoolSegment_t* segment)
+{
+    (void) segment;
+    return false;
+}
+#endif
+
 /**
  * Allocates a new memory pool segment from the memory pool and returns
  * a pointer to it.
@@ -74,9 +274,10 @@ gmosMempoolSegment_t* gmosMempoolAlloc (void);
 
 /**
  * Returns a memory pool segment to the memory pool free list after use.
+ * If the segment is shared, one reference to it is released instead.
  * @param freeSegment This is a pointer to a memory pool segment
- *     previously allocated using 'gmosMempoolAlloc' that is to be
- *     returned to the memory pool free list.
+ *     previously allocated from the memory pool that is to be returned
+ *     to the appropriate memory pool free list.
  */
 void gmosMempoolFree (gmosMempoolSegment_t* freeSegment);
 
@@ -92,12 +293,79 @@ void gmosMempoolFree (gmosMempoolSegment_t* freeSegment);
 gmosMempoolSegment_t* gmosMempoolAllocSegments (uint16_t segmentCount);
 
 /**
- * Returns a number of memory pool segments to the memory pool.
+ * Allocates a linked list of memory pool segments with sufficient
+ * combined capacity to store the specified number of data bytes. If
+ * large segment support has been configured, large segments will be
+ * used in preference to standard segments where this does not
+ * increase the amount of unused space at the end of the list. Any
+ * large segments will be placed at the start of the list.
+ * @param capacity This is the number of data bytes that are to be
+ *     stored in the allocated memory pool segments. It must be greater
+ *     than zero.
+ * @return Returns a pointer to a linked list that contains the
+ *     allocated segments, or a null reference if the requested
+ *     capacity is not available.
+ */
+gmosMempoolSegment_t* gmosMempoolAllocCapacity (uint16_t capacity);
+
+/**
+ * Returns a number of memory pool segments to the memory pool. If a
+ * shared segment is found in the list, one reference to it is released
+ * and the remaining segments are left in place for the other users of
+ * the shared segment.
  * @param freeSegments This is a pointer to a linked list of memory pool
- *     segments that are to be returned to the memory pool.
+ *     segments that are to be returned to the memory pool. The list may
+ *     contain a mixture of standard and large segments.
  */
 void gmosMempoolFreeSegments (gmosMempoolSegment_t* freeSegments);
 
+/**
+ * Sets the memory pool owner tag for a task. Segments allocated while
+ * the task is running will be attributed to the specified owner. Newly
+ * started tasks are assigned the 'GMOS_MEMPOOL_OWNER_OTHER' tag, so
+ * this should be called after starting the task. It may also be called
+ * for the current task in order to temporarily attribute allocations
+ * to a different owner, restoring the previous owner tag afterwards.
+ * If memory pool telemetry is not enabled this function has no effect.
+ * @param task This is a pointer to the task state for the task that
+ *     is to have its owner tag set.
+ * @param owner This is the owner tag that is to be assigned to the
+ *     task. Out of range values will be set to the
+ *     'GMOS_MEMPOOL_OWNER_OTHER' tag.
+ * @return Returns the previous owner tag for the task.
+ */
+uint8_t gmosMempoolSetTaskOwner (gmosTaskState_t* task, uint8_t owner);
+
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+
+/**
+ * Accesses the memory pool telemetry statistics. The low capacity
+ * time includes any current low capacity period up to the current
+ * time. This is only available if memory pool telemetry has been
+ * enabled.
+ * @param mempoolStats This is a pointer to a memory pool statistics
+ *     data structure which will be populated with the current memory
+ *     pool telemetry statistics.
+ */
+void gmosMempoolGetStats (gmosMempoolStats_t* mempoolStats);
+
+/**
+ * Resets the memory pool telemetry statistics. This sets the peak
+ * usage values to the current usage and clears the allocation failure
+ * and low capacity statistics, so that memory pool usage may be
+ * monitored over a specific period. This is only available if memory
+ * pool telemetry has been enabled.
+ */
+void gmosMempoolResetStats (void);
+
+/**
+ * Writes the memory pool telemetry statistics to the debug log. This
+ * is only available if memory pool telemetry has been enabled.
+ */
+void gmosMempoolLogStats (void);
+
+#endif // GMOS_CONFIG_MEMPOOL_TELEMETRY
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
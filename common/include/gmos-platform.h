@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2023 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -187,6 +187,21 @@ void gmosPalInit (void);
  */
 void gmosAppInit (void);
 
+/**
+ * Initialises the application code for a secondary processor core on
+ * startup. This must be implemented by application specific code when
+ * multiple scheduler cores are configured, in order to set up the
+ * application tasks that are to be run on the secondary cores. It is
+ * called on the secondary core immediately prior to starting its
+ * scheduler loop.
+ * @param coreId This is the index of the secondary core that is being
+ *     initialised, in the range from 1 up to the number of configured
+ *     scheduler cores minus one.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+void gmosAppCoreInit (uint8_t coreId);
+#endif
+
 /**
  * Initialises and starts the GubbinsMOS scheduler when it is being run
  * in the context of a host operating system thread. This will
@@ -239,6 +254,23 @@ bool gmosPalHostOsInit (void);
  */
 uint32_t gmosPalGetTimer (void);
 
+/**
+ * Reads the contents of the platform cycle counter. This is a free
+ * running 32-bit counter that increments at the rate defined by
+ * 'GMOS_CONFIG_PAL_CYCLE_COUNTER_FREQUENCY' and is used for fine
+ * grained execution time measurements. Platforms that do not provide
+ * a cycle counter use the system timer instead.
+ * @return Returns the current value of the platform cycle counter.
+ */
+#if GMOS_CONFIG_PAL_CYCLE_COUNTER
+uint32_t gmosPalGetCycleCount (void);
+#else
+static inline uint32_t gmosPalGetCycleCount (void)
+{
+    return gmosPalGetTimer ();
+}
+#endif
+
 /**
  * Requests that the platform abstraction layer enter idle mode for
  * the specified number of platform timer ticks. Depending on
@@ -257,6 +289,17 @@ void gmosPalIdle (uint32_t duration);
  */
 void gmosPalWake (void);
 
+/**
+ * Requests that the platform abstraction layer wakes the GMOS scheduler
+ * running on the specified processor core from idle mode. This is only
+ * required when multiple scheduler cores are configured.
+ * @param coreId This is the index of the processor core that is to be
+ *     woken from idle mode.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+void gmosPalCoreWake (uint8_t coreId);
+#endif
+
 /**
  * Requests that the platform abstraction layer terminate all further
  * processing. The behaviour will be platform specific, but this
@@ -0,0 +1,182 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * This header defines the API for GubbinsMOS power state residency
+ * accounting. When enabled, a scheduler lifecycle monitor is used to
+ * record the time spent in the active, power save and deep sleep
+ * states. Each wakeup is classified as a timer wakeup if the requested
+ * idle period expired, or as an event wakeup otherwise, and the first
+ * task to run after each wakeup is recorded. An estimate of the energy
+ * used is derived from the per-state supply current settings in the
+ * platform or application configuration.
+ */
+
+#ifndef GMOS_POWER_H
+#define GMOS_POWER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gmos-config.h"
+#include "gmos-scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Defines the set of power states that are tracked by the power state
+ * residency accounting.
+ */
+typedef enum {
+    GMOS_POWER_STATE_ACTIVE,
+    GMOS_POWER_STATE_POWER_SAVE,
+    GMOS_POWER_STATE_DEEP_SLEEP,
+    GMOS_POWER_STATE_COUNT
+} gmosPowerStateId_t;
+
+/**
+ * Defines the power state residency statistics data structure that is
+ * used to report the accumulated power state residency information.
+ */
+typedef struct gmosPowerStats_t {
+
+    // This is the total time spent in each power state, expressed as
+    // an integer number of system timer ticks.
+    uint64_t residencyTicks [GMOS_POWER_STATE_COUNT];
+
+    // This is the estimated energy used since startup, expressed as an
+    // integer number of microjoules.
+    uint64_t energyMicrojoules;
+
+    // This is the number of wakeups caused by the expiry of the
+    // requested idle period.
+    uint32_t timerWakeCount;
+
+    // This is the number of wakeups caused by events or interrupts
+    // before the requested idle period had expired.
+    uint32_t eventWakeCount;
+
+} gmosPowerStats_t;
+
+/**
+ * Defines the power state residency accounting state data structure.
+ * This is normally allocated statically by the power state residency
+ * implementation. When instance support is enabled, it forms part of
+ * the GubbinsMOS instance data structure instead. All fields are
+ * private to the power state residency implementation.
+ */
+typedef struct gmosPowerState_t {
+
+    // Specifies the lifecycle monitor used to track power states.
+    gmosLifecycleMonitor_t lifecycleMonitor;
+
+    // Specifies the accumulated time spent in each power state.
+    uint64_t residencyTicks [GMOS_POWER_STATE_COUNT];
+
+    // Specifies the wakeup counts for each wakeup reason.
+    uint32_t timerWakeCount;
+    uint32_t eventWakeCount;
+
+    // Specifies the system timer value at the last power state change.
+    uint32_t stateChangeTime;
+
+    // Specifies the system timer value at which the scheduler requested
+    // to be woken from the current idle period.
+    uint32_t idleWakeTime;
+
+    // Specifies the first task that was run after the last wakeup.
+    gmosTaskState_t* wakeTask;
+
+    // Specifies the current power state.
+    uint8_t currentState;
+
+    // Indicates that the next task to run should be recorded as the
+    // wakeup task.
+    bool wakePending;
+
+} gmosPowerState_t;
+
+#if GMOS_CONFIG_POWER_RESIDENCY
+
+/**
+ * Initialises power state residency accounting on startup. This should
+ * be called once from the application initialisation code, and resets
+ * all the accumulated power state residency information.
+ */
+void gmosPowerInit (void);
+
+/**
+ * Accesses the accumulated power state residency statistics. The
+ * residency time for the current power state is included up to the
+ * current time.
+ * @param powerStats This is a pointer to a power statistics data
+ *     structure which will be populated with the current power state
+ *     residency statistics.
+ */
+void gmosPowerGetStats (gmosPowerStats_t* powerStats);
+
+/**
+ * Accesses the task state for the first task that was run after the
+ * most recent wakeup from a power save or deep sleep state.
+ * @return Returns a pointer to the task state for the most recent
+ *     wakeup task, or a null reference if no task has been run since
+ *     the most recent wakeup.
+ */
+gmosTaskState_t* gmosPowerGetWakeTask (void);
+
+/**
+ * Accesses the number of times that a task was the first task to be
+ * run after a wakeup from a power save or deep sleep state.
+ * @param task This is a pointer to the task state for the task that
+ *     is to be queried.
+ * @return Returns the number of wakeups for which the task was the
+ *     first task to be run.
+ */
+uint32_t gmosPowerTaskGetWakes (gmosTaskState_t* task);
+
+/**
+ * Writes the accumulated power state residency statistics to the
+ * debug log.
+ */
+void gmosPowerLogStats (void);
+
+/**
+ * Records the wakeup time requested by the scheduler when it enters an
+ * idle period. This is called automatically by the scheduler and should
+ * not be called directly.
+ * @param idleDuration This is the requested idle period, expressed as
+ *     an integer number of system timer ticks.
+ */
+void gmosPowerIdleRequest (uint32_t idleDuration);
+
+/**
+ * Records the first task to run after a wakeup. This is called
+ * automatically by the scheduler before running each task and should
+ * not be called directly.
+ * @param task This is a pointer to the task state for the task that is
+ *     about to be run.
+ */
+void gmosPowerTaskRun (gmosTaskState_t* task);
+
+#endif // GMOS_CONFIG_POWER_RESIDENCY
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // GMOS_POWER_H
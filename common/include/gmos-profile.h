@@ -0,0 +1,137 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * This header defines the API for GubbinsMOS hot path profiling
+ * probes. When enabled, each probe measures the number of platform
+ * cycle counter ticks taken to run a section of code and accumulates
+ * the minimum, maximum and mean execution times in a static probe
+ * table. Probes are placed using the 'GMOS_PROFILE_BEGIN' and
+ * 'GMOS_PROFILE_END' macros, which are removed at compile time when
+ * profiling is disabled.
+ */
+
+#ifndef GMOS_PROFILE_H
+#define GMOS_PROFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gmos-config.h"
+#include "gmos-platform.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Defines the set of profiling probe identifiers used by the common
+ * GubbinsMOS components. Application specific probes should use
+ * identifiers starting from 'GMOS_PROFILE_ID_APP_FIRST'.
+ */
+typedef enum {
+    GMOS_PROFILE_ID_BUFFER_COPY,            // Buffer segment writes.
+    GMOS_PROFILE_ID_STREAM_WRITE,           // Stream data writes.
+    GMOS_PROFILE_ID_CBOR_SCAN,              // CBOR message scanning.
+    GMOS_PROFILE_ID_SPI_TRANSACTION,        // SPI asynchronous setup.
+    GMOS_PROFILE_ID_SPI_INLINE_TRANSACTION, // SPI inline transfers.
+    GMOS_PROFILE_ID_APP_FIRST
+} gmosProfileId_t;
+
+/**
+ * Defines the profiling probe statistics data structure that is used
+ * to accumulate the execution times for a single profiling probe. All
+ * times are expressed as platform cycle counter ticks.
+ */
+typedef struct gmosProfileStats_t {
+
+    // This is the total execution time for all probe runs.
+    uint64_t totalCycles;
+
+    // This is the number of times the probe has been run.
+    uint32_t runCount;
+
+    // This is the minimum execution time for a single probe run.
+    uint32_t minCycles;
+
+    // This is the maximum execution time for a single probe run.
+    uint32_t maxCycles;
+
+} gmosProfileStats_t;
+
+/**
+ * Adds a new execution time measurement to the statistics for the
+ * specified profiling probe. This may be called from interrupt service
+ * routines. It should normally be invoked via the 'GMOS_PROFILE_END'
+ * macro so that it is removed when profiling is disabled.
+ * @param probeId This is the identifier for the profiling probe.
+ * @param runCycles This is the measured execution time, expressed as
+ *     an integer number of platform cycle counter ticks.
+ */
+void gmosProfileRecord (uint_fast8_t probeId, uint32_t runCycles);
+
+/**
+ * Accesses the accumulated statistics for the specified profiling
+ * probe.
+ * @param probeId This is the identifier for the profiling probe.
+ * @param probeStats This is a pointer to a profiling statistics data
+ *     structure which will be populated with the current probe
+ *     statistics.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     probe identifier is valid and 'false' otherwise.
+ */
+bool gmosProfileGetStats (
+    uint_fast8_t probeId, gmosProfileStats_t* probeStats);
+
+/**
+ * Resets the accumulated statistics for all profiling probes.
+ */
+void gmosProfileReset (void);
+
+/**
+ * Writes the accumulated statistics for all profiling probes that have
+ * been run to the debug log. Execution times are reported as platform
+ * cycle counter ticks, together with the cycle counter frequency.
+ */
+void gmosProfileLogStats (void);
+
+/**
+ * Provides the profiling probe macros that are used to measure the
+ * execution time of a section of code. The begin macro declares a
+ * local start time variable, so it must be placed at the start of a
+ * block and the end macro must be placed later in the same block. The
+ * probe identifier must be a simple identifier, such as one of the
+ * 'gmosProfileId_t' enumeration values. These will be removed at
+ * compile time if profiling is disabled using the
+ * 'GMOS_CONFIG_PROFILE_ENABLE' option.
+ * @param _id_ This is the identifier for the profiling probe.
+ */
+#if GMOS_CONFIG_PROFILE_ENABLE
+#define GMOS_PROFILE_BEGIN(_id_)                                       \
+    uint32_t gmosProfileStart_##_id_ = gmosPalGetCycleCount ()
+#define GMOS_PROFILE_END(_id_)                                         \
+    gmosProfileRecord (_id_,                                           \
+        gmosPalGetCycleCount () - gmosProfileStart_##_id_)
+#else
+#define GMOS_PROFILE_BEGIN(_id_) do {} while (false)
+#define GMOS_PROFILE_END(_id_) do {} while (false)
+#endif
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // GMOS_PROFILE_H
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2024 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -38,6 +38,34 @@ extern "C" {
  */
 typedef uint32_t gmosTaskStatus_t;
 
+/**
+ * Defines the GubbinsMOS task profiling data structure which is used
+ * to record task execution statistics when scheduler profiling is
+ * enabled. Execution times are measured using the platform cycle
+ * counter and include the time spent running other tasks while the
+ * task is busy waiting. Scheduling latency is measured in system timer
+ * ticks from the point at which the task became ready to run.
+ */
+typedef struct gmosTaskStats_t {
+
+    // This is the total task execution time in cycle counter ticks.
+    uint64_t runCycles;
+
+    // This is the total task scheduling latency in system timer ticks.
+    uint64_t lateTicks;
+
+    // This is the number of times that the task has been run.
+    uint32_t runCount;
+
+    // This is the maximum task execution time in cycle counter ticks.
+    uint32_t maxRunCycles;
+
+    // This is the maximum task scheduling latency in system timer
+    // ticks.
+    uint32_t maxLateTicks;
+
+} gmosTaskStats_t;
+
 /**
  * Defines the GubbinsMOS task state data structure which is used for
  * managing an individual task.
@@ -62,6 +90,21 @@ typedef struct gmosTaskState_t {
     // This is a pointer to the next task in the task queue.
     struct gmosTaskState_t* nextTask;
 
+#if GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+    // This is a pointer to the task queue link that currently refers
+    // to this task, which allows the task to be removed from the task
+    // queue without searching.
+    struct gmosTaskState_t** prevTaskPtr;
+#endif
+
+#if GMOS_CONFIG_SCHEDULER_TIMING_WHEEL && \
+    GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+    // This is the timing wheel level and slot that currently holds the
+    // task, which allows the slot list end reference to be updated when
+    // the task is removed.
+    uint8_t wheelSlot;
+#endif
+
     // This is a timestamp that is used to indicate the next platform
     // timer value at which the task is to be run.
     int32_t timestamp;
@@ -70,6 +113,63 @@ typedef struct gmosTaskState_t {
     // task is initialising, running, suspended or queued.
     uint8_t taskState;
 
+#if (GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS > 1)
+    // This is the task priority level, which determines the order in
+    // which ready tasks are run. Level zero is the highest priority.
+    uint8_t taskPriority;
+#endif
+
+#if GMOS_CONFIG_INSTANCE_SUPPORT
+    // This is the GubbinsMOS instance that runs the task. It is set to
+    // the current instance when the task is started.
+    struct gmosInstance_t* taskInstance;
+#endif
+
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+    // This is the index of the processor core that runs the task. It
+    // is set to the current core when the task is started.
+    uint8_t taskCore;
+
+    // This flag is set when a task resume request has been posted to
+    // the core that runs the task and has not yet been processed.
+    volatile bool resumePosted;
+#endif
+
+#if GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+    // This is the task execution budget in cycle counter ticks. A
+    // value of zero disables budget checking for the task.
+    uint32_t budgetCycles;
+
+    // This is the total number of execution budget overruns for the
+    // task.
+    uint32_t overrunCount;
+
+    // This is the number of consecutive execution budget overruns for
+    // the task.
+    uint16_t overrunStreak;
+#endif
+
+#if GMOS_CONFIG_POWER_RESIDENCY
+    // This is the number of times that the task was the first task to
+    // be run after a wakeup from a power save or deep sleep state.
+    uint32_t wakeCount;
+#endif
+
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+    // This is the memory pool owner tag that is used to attribute the
+    // memory pool segments allocated by the task.
+    uint8_t mempoolOwner;
+#endif
+
+#if GMOS_CONFIG_SCHEDULER_PROFILING
+    // This is a pointer to the next task in the list of all started
+    // tasks, which is used to access the task profiling statistics.
+    struct gmosTaskState_t* nextStartedTask;
+
+    // This is the set of task profiling statistics.
+    gmosTaskStats_t taskStats;
+#endif
+
 } gmosTaskState_t;
 
 /**
@@ -101,6 +201,208 @@ typedef struct gmosLifecycleMonitor_t {
 
 } gmosLifecycleMonitor_t;
 
+/**
+ * Defines the GubbinsMOS idle worker type that is used to run low
+ * priority background work when the scheduler would otherwise be idle.
+ */
+typedef struct gmosIdleWorker_t {
+
+    // This is a pointer to the idle worker function. It will be passed
+    // the idle worker data item and an execution budget in system timer
+    // ticks, and should return a boolean value that is set to 'true' if
+    // further work is pending.
+    bool (*workerFn) (void*, uint32_t);
+
+    // This is a pointer to an arbitrary data item that is passed to
+    // the idle worker function.
+    void* workerData;
+
+    // This is a pointer to the next idle worker in the list.
+    struct gmosIdleWorker_t* nextWorker;
+
+    // Indicates that the idle worker has pending work.
+    bool workPending;
+
+} gmosIdleWorker_t;
+
+#if GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+
+/**
+ * Defines the scheduler overrun statistics data structure which is
+ * used to record task execution budget overruns when task budgets are
+ * enabled.
+ */
+typedef struct gmosSchedulerOverrunStats_t {
+
+    // This is the number of task runs that have been checked against
+    // the task execution budgets.
+    uint32_t runCount;
+
+    // This is the number of task runs that exceeded the task execution
+    // budget.
+    uint32_t overrunCount;
+
+    // This is the number of times that the scheduler watchdog has been
+    // triggered by persistent task overruns.
+    uint32_t watchdogCount;
+
+} gmosSchedulerOverrunStats_t;
+
+/**
+ * Defines the function prototype for scheduler watchdog handlers. The
+ * handler will be passed a pointer to the task state for the task that
+ * caused the watchdog to be triggered. It will typically log the task
+ * details and then perform a controlled device reset. If the handler
+ * returns, the consecutive overrun count for the task is cleared.
+ */
+typedef void (*gmosSchedulerWatchdogFn_t) (gmosTaskState_t*);
+
+#endif // GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+
+// Specify the timing wheel dimensions. Each wheel level is indexed
+// using four bits of the 32-bit timestamp, so eight levels are required
+// to cover the full system timer range.
+#if GMOS_CONFIG_SCHEDULER_TIMING_WHEEL
+#define GMOS_SCHEDULER_WHEEL_SLOT_BITS   4
+#define GMOS_SCHEDULER_WHEEL_SLOT_COUNT  \
+    (1 << GMOS_SCHEDULER_WHEEL_SLOT_BITS)
+#define GMOS_SCHEDULER_WHEEL_LEVEL_COUNT \
+    (32 / GMOS_SCHEDULER_WHEEL_SLOT_BITS)
+#endif
+
+/**
+ * Defines the task queue data structure which is used for the scheduled
+ * and background task queues. This is either a hierarchical timing
+ * wheel or a simple linked list that is sorted by task timestamp. All
+ * fields are private to the scheduler implementation.
+ */
+typedef struct gmosTaskQueue_t {
+#if GMOS_CONFIG_SCHEDULER_TIMING_WHEEL
+
+    // Specifies the task lists for each timing wheel slot.
+    gmosTaskState_t* slots [GMOS_SCHEDULER_WHEEL_LEVEL_COUNT]
+        [GMOS_SCHEDULER_WHEEL_SLOT_COUNT];
+
+    // Specifies the task list end references for each timing wheel
+    // slot. These are only valid for occupied slots.
+    gmosTaskState_t** slotEnds [GMOS_SCHEDULER_WHEEL_LEVEL_COUNT]
+        [GMOS_SCHEDULER_WHEEL_SLOT_COUNT];
+
+    // Specifies the earliest task timestamp for each timing wheel
+    // slot. These are only valid for occupied slots above level zero.
+    uint32_t slotDeadlines [GMOS_SCHEDULER_WHEEL_LEVEL_COUNT]
+        [GMOS_SCHEDULER_WHEEL_SLOT_COUNT];
+
+    // Specifies the slot occupancy bit masks for each wheel level.
+    uint16_t slotMasks [GMOS_SCHEDULER_WHEEL_LEVEL_COUNT];
+
+    // Specifies the bit masks for each wheel level that indicate the
+    // slots with earliest task timestamps that need to be recalculated
+    // after task removal.
+    uint16_t staleDeadlineMasks [GMOS_SCHEDULER_WHEEL_LEVEL_COUNT];
+
+    // Specifies the timing wheel base time. All tasks with timestamps
+    // prior to the base time have already been made ready to run.
+    uint32_t baseTime;
+
+#else
+
+    // Specifies the start of the sorted task list.
+    gmosTaskState_t* taskList;
+
+#endif
+} gmosTaskQueue_t;
+
+/**
+ * Defines the scheduler state data structure. This holds all of the
+ * scheduler state for a single GubbinsMOS instance, and is normally
+ * allocated statically by the scheduler implementation. When instance
+ * support is enabled, it forms part of the GubbinsMOS instance data
+ * structure instead. All fields are private to the scheduler
+ * implementation.
+ */
+typedef struct gmosSchedulerState_t {
+
+    // Specifies the scheduled task queue.
+    gmosTaskQueue_t scheduledTasks;
+
+    // Specifies the background task queue.
+    gmosTaskQueue_t backgroundTasks;
+
+    // Specifies the start of the ready task list for each priority
+    // level.
+    gmosTaskState_t* readyTaskListHead [
+        GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS];
+
+    // Specifies the end of the ready task list for each priority level.
+    gmosTaskState_t* readyTaskListEnd [
+        GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS];
+
+    // Specifies the currently executing task.
+    gmosTaskState_t* currentTask;
+
+    // Specifies the head of the scheduler lifecycle monitor list.
+    gmosLifecycleMonitor_t* lifecycleMonitors;
+
+    // Specifies the head of the idle worker list.
+    gmosIdleWorker_t* idleWorkers;
+
+    // Specifies the next idle worker to be checked for pending work.
+    gmosIdleWorker_t* nextIdleWorker;
+
+    // Tracks the number of 'stay awake' requests.
+    uint32_t stayAwakeCounter;
+
+    // Specifies the bit mask of priority levels with ready tasks.
+    uint8_t readyTaskMask;
+
+    // Counts the number of higher priority tasks that have been run
+    // while lowest priority tasks are ready to run.
+#if (GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS > 1)
+    uint8_t starvationCounter;
+#endif
+
+    // Indicates that the previous scheduler step requested an idle
+    // period.
+    bool schedulerIdle;
+
+#if GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+    // Specifies the task execution budget overrun statistics.
+    gmosSchedulerOverrunStats_t overrunStats;
+
+    // Specifies the scheduler watchdog handler function.
+    gmosSchedulerWatchdogFn_t watchdogFn;
+#endif
+
+#if GMOS_CONFIG_HOST_OS_SUPPORT
+    // Indicates that the host operating system mutex is currently held
+    // by the scheduler.
+    bool hostOsLocked;
+
+    // Counts the number of scheduler steps run in the current host
+    // operating system mutex batch.
+    uint16_t hostOsBatchCount;
+
+    // Specifies the system timer value at the start of the current
+    // host operating system mutex batch.
+    uint32_t hostOsBatchStartTime;
+
+    // Counts the number of nested scheduler steps that are currently
+    // active due to busy waiting tasks.
+    uint8_t hostOsStepDepth;
+#endif
+
+#if GMOS_CONFIG_SCHEDULER_PROFILING
+    // Specifies the start of the list of all started tasks.
+    gmosTaskState_t* startedTaskList;
+
+    // Specifies the system timer value for the next profiling log
+    // output.
+    uint32_t nextStatsLogTime;
+#endif
+
+} gmosSchedulerState_t;
+
 /**
  * This is a macro that may be used to wrap task name strings for
  * efficient storage on the target platform. The default option uses
@@ -150,6 +452,27 @@ static inline void _id_ ## _start (gmosTaskState_t* taskState,         \
     gmosSchedulerTaskStart (taskState);                                \
 }
 
+/**
+ * Defines the task priority level for tasks that have the highest
+ * scheduling priority.
+ */
+#define GMOS_TASK_PRIORITY_HIGHEST 0
+
+/**
+ * Defines the task priority level for tasks that have the lowest
+ * scheduling priority.
+ */
+#define GMOS_TASK_PRIORITY_LOWEST \
+    (GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS - 1)
+
+/**
+ * Defines the default task priority level that is assigned to tasks
+ * when they are started. This is the middle of the supported range of
+ * priority levels.
+ */
+#define GMOS_TASK_PRIORITY_DEFAULT \
+    (GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS / 2)
+
 /**
  * Defines the task function return value that is used to indicate that
  * the task should be re-run immediately by the scheduler.
@@ -222,12 +545,45 @@ void gmosSchedulerTaskStart (gmosTaskState_t* newTask);
 
 /**
  * Immediately resumes processing of a suspended or delayed task, making
- * it ready for scheduler execution.
+ * it ready for scheduler execution. If the task runs on a different
+ * processor core, the resume request is posted to that core and the
+ * task will be made ready on its next scheduler step. This must only be
+ * called from task context when multiple scheduler cores are enabled.
  * @param resumedTask This is a pointer to the task state for the task
  *     that is to be resumed.
  */
 void gmosSchedulerTaskResume (gmosTaskState_t* resumedTask);
 
+/**
+ * Sets the scheduling priority level for a task. Newly started tasks
+ * are assigned the default priority level, so this should be called
+ * after starting the task. The new priority level will apply the next
+ * time the task is made ready to run. If only a single priority level
+ * is supported this function has no effect.
+ * @param task This is a pointer to the task state for the task that
+ *     is to have its priority level set.
+ * @param taskPriority This is the new task priority level, in the
+ *     range from 'GMOS_TASK_PRIORITY_HIGHEST' to
+ *     'GMOS_TASK_PRIORITY_LOWEST'. Out of range values will be set to
+ *     the lowest priority level.
+ */
+void gmosSchedulerTaskSetPriority (
+    gmosTaskState_t* task, uint8_t taskPriority);
+
+/**
+ * Sets the execution budget for a task. Newly started tasks are
+ * assigned the default execution budget, so this should be called
+ * after starting the task. If task execution budgets are not enabled
+ * this function has no effect.
+ * @param task This is a pointer to the task state for the task that
+ *     is to have its execution budget set.
+ * @param budgetMicros This is the new task execution budget, expressed
+ *     as an integer number of microseconds. A value of zero disables
+ *     budget checking for the task.
+ */
+void gmosSchedulerTaskSetBudget (
+    gmosTaskState_t* task, uint32_t budgetMicros);
+
 /**
  * Places the current task in a busy wait state, which allows other
  * scheduled tasks to execute while holding the state of the current
@@ -236,9 +592,24 @@ void gmosSchedulerTaskResume (gmosTaskState_t* resumedTask);
  * issues. The main use for this function is to support third party
  * libraries which assume the use of a blocking I/O model, such as the
  * LittleFS file system. Note that the device can not enter its low
- * power state while busy waiting.
+ * power state while busy waiting, unless the 'gmosEventBusyWait'
+ * function is used to wait on a specific event.
+ * @return Returns the idle period requested by the scheduler step, as
+ *     an integer number of system timer ticks. This will be zero if
+ *     other tasks are ready to run.
+ */
+uint32_t gmosSchedulerTaskBusyWait (void);
+
+/**
+ * Places the device in the idle state while the current task is busy
+ * waiting. This should only be called after 'gmosSchedulerTaskBusyWait'
+ * has requested an idle period. When host OS support is enabled, the
+ * host OS mutex is released for the duration of the idle period so
+ * that host OS threads can interact with the scheduler.
+ * @param idleTime This is the maximum idle period, expressed as an
+ *     integer number of system timer ticks.
  */
-void gmosSchedulerTaskBusyWait (void);
+void gmosSchedulerTaskBusyIdle (uint32_t idleTime);
 
 /**
  * Requests that the scheduler avoids powering down the device. This
@@ -281,6 +652,76 @@ gmosTaskState_t* gmosSchedulerCurrentTask (void);
 gmosTaskStatus_t gmosSchedulerPrioritise (
     gmosTaskStatus_t taskStatusA, gmosTaskStatus_t gmosTaskStatusB);
 
+#if GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+
+/**
+ * Accesses the total number of execution budget overruns for a task
+ * since it was started. This is only available when task execution
+ * budgets are enabled.
+ * @param task This is a pointer to the task state for the task that
+ *     is to be queried.
+ * @return Returns the number of execution budget overruns for the
+ *     task.
+ */
+uint32_t gmosSchedulerTaskGetOverruns (gmosTaskState_t* task);
+
+/**
+ * Accesses the scheduler execution budget overrun statistics. These
+ * cover all tasks run by the scheduler since startup and may be used
+ * to monitor overrun rates. This is only available when task execution
+ * budgets are enabled.
+ * @param overrunStats This is a pointer to an overrun statistics data
+ *     structure which will be populated with a copy of the current
+ *     scheduler overrun statistics.
+ */
+void gmosSchedulerGetOverrunStats (
+    gmosSchedulerOverrunStats_t* overrunStats);
+
+/**
+ * Sets the scheduler watchdog handler. This will be called when a task
+ * exceeds its execution budget on the number of consecutive runs
+ * specified by the 'GMOS_CONFIG_SCHEDULER_OVERRUN_LIMIT' option. If no
+ * watchdog handler is set, the scheduler watchdog will fail with an
+ * assertion instead. This is only available when task execution
+ * budgets are enabled.
+ * @param watchdogFn This is the watchdog handler function that is to
+ *     be called, or a null reference to restore the default behaviour.
+ */
+void gmosSchedulerSetWatchdog (gmosSchedulerWatchdogFn_t watchdogFn);
+
+#endif // GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+
+#if GMOS_CONFIG_SCHEDULER_PROFILING
+
+/**
+ * Iterates over the list of started tasks, accessing the profiling
+ * statistics for each task in turn. This is only available when
+ * scheduler profiling is enabled.
+ * @param taskIterator This is a pointer to a task state reference that
+ *     is used as the iterator state. It should be set to a null
+ *     reference before the first call and will be updated to refer to
+ *     the task associated with the returned statistics. The task name
+ *     may be accessed from the task state if required.
+ * @param taskStats This is a pointer to a task statistics data
+ *     structure which will be populated with a copy of the profiling
+ *     statistics for the next task.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     task statistics were populated and 'false' if there are no more
+ *     tasks in the list.
+ */
+bool gmosSchedulerGetStats (
+    gmosTaskState_t** taskIterator, gmosTaskStats_t* taskStats);
+
+/**
+ * Writes the profiling statistics for all started tasks to the debug
+ * log. This is only available when scheduler profiling is enabled and
+ * will be called automatically at the interval specified by the
+ * 'GMOS_CONFIG_SCHEDULER_PROFILING_LOG_INTERVAL' option.
+ */
+void gmosSchedulerLogStats (void);
+
+#endif // GMOS_CONFIG_SCHEDULER_PROFILING
+
 /**
  * Adds a scheduler lifecycle monitor to receive notifications of
  * scheduler lifecycle management events.
@@ -310,6 +751,39 @@ void gmosLifecycleAddMonitor (gmosLifecycleMonitor_t* lifecycleMonitor,
 bool gmosLifecycleNotify
     (gmosLifecycleStatus_t lifecycleStatus);
 
+/**
+ * Adds an idle worker to the scheduler. Idle workers are used for low
+ * priority housekeeping operations that should only be run when the
+ * scheduler would otherwise be idle. The scheduler will only run idle
+ * workers with pending work when no tasks are ready to run and the
+ * next scheduled task deadline is at least the minimum time specified
+ * by 'GMOS_CONFIG_SCHEDULER_IDLE_WORK_MIN_TIME' away. A single idle
+ * worker is run on each scheduler step, selecting workers with pending
+ * work in turn. Newly added idle workers are marked as having pending
+ * work.
+ * @param idleWorker This is the new idle worker that is to be added to
+ *     the idle worker list.
+ * @param workerFunction This is a pointer to the idle worker function.
+ *     It is passed the worker data item and an execution budget in
+ *     system timer ticks, and should return within the execution
+ *     budget. It should return a boolean value that will be set to
+ *     'true' if further work is pending and 'false' otherwise. Idle
+ *     worker functions are not run in task context, so they must not
+ *     use the busy wait functions.
+ * @param workerData This is an opaque pointer to a data item that will
+ *     be passed to the idle worker function.
+ */
+void gmosSchedulerIdleWorkerAdd (gmosIdleWorker_t* idleWorker,
+    bool (*workerFunction) (void*, uint32_t), void* workerData);
+
+/**
+ * Indicates that an idle worker has pending work. The idle worker will
+ * then be run on a subsequent scheduler step when the scheduler would
+ * otherwise be idle. This must only be called from the task context.
+ * @param idleWorker This is the idle worker that has pending work.
+ */
+void gmosSchedulerIdleWorkerRequest (gmosIdleWorker_t* idleWorker);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2023 Zynaptic Limited
+ * Copyright 2023-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,16 +29,23 @@
  *     rule is the 'multi-phase' state machine design pattern.
  *   - When one of the macros is used to yield control to the scheduler
  *     any data stored as local variables on the stack will be lost.
+ *     Threads that need to preserve local state across these calls may
+ *     use a local frame, which is allocated from the memory pool while
+ *     the thread is running.
  */
 
 #ifndef GMOS_THREADS_H
 #define GMOS_THREADS_H
 
+#include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <string.h>
 #include "gmos-config.h"
 #include "gmos-platform.h"
 #include "gmos-scheduler.h"
+#include "gmos-events.h"
+#include "gmos-mempool.h"
 
 /**
  * Defines the GubbinsMOS thread state data type that is used to hold
@@ -75,7 +82,119 @@ static inline void gmosThreadInit (gmosThread_t* thread) {
  */
 #define GMOS_THREAD_START(_thread_state_)                              \
 gmosThread_t* _gmos_thread_state_ptr_ = &(_thread_state_);             \
+gmosThread_t* _gmos_thread_frame_ptr_ = NULL;                          \
 gmosTaskStatus_t _gmos_thread_status_ = GMOS_TASK_SUSPEND;             \
+(void) _gmos_thread_frame_ptr_;                                        \
+if ((*_gmos_thread_state_ptr_) != (gmosThread_t) NULL) {               \
+    GMOS_PLATFORM_GOTO_LABEL_ADDRESS(*_gmos_thread_state_ptr_);        \
+}
+
+/**
+ * Specifies the thread state value that is used to indicate that a
+ * thread with a local frame has stopped and released its frame.
+ */
+#define GMOS_THREAD_FRAME_STOPPED ((gmosThread_t) (uintptr_t) 1)
+
+/**
+ * Attaches the local frame for a GubbinsMOS thread, allocating it from
+ * the memory pool if required. The frame contents are cleared to zero
+ * whenever the thread is started or restarted. This is used by the
+ * 'GMOS_THREAD_FRAME_START' macro and should not be called directly.
+ * @param thread This is a pointer to the thread state data item, which
+ *     holds a reference to the allocated frame.
+ * @param frameSize This is the size of the frame, including the thread
+ *     resume label, which must fit in a single memory pool segment.
+ * @return Returns a pointer to the frame, or a null reference if the
+ *     thread has stopped or no memory pool segments are available.
+ */
+static inline void* gmosThreadFrameAttach (
+    gmosThread_t* thread, size_t frameSize)
+{
+    gmosMempoolSegment_t* segment;
+    gmosThread_t* resumeLabel;
+
+    if (*thread == GMOS_THREAD_FRAME_STOPPED) {
+        return NULL;
+    }
+    if (*thread == (gmosThread_t) NULL) {
+        segment = gmosMempoolAlloc ();
+        if (segment == NULL) {
+            return NULL;
+        }
+        *thread = (gmosThread_t) segment->data.bytes;
+        *((gmosThread_t*) *thread) = (gmosThread_t) NULL;
+    }
+    resumeLabel = (gmosThread_t*) *thread;
+    if (*resumeLabel == (gmosThread_t) NULL) {
+        memset (*thread, 0, frameSize);
+    }
+    return *thread;
+}
+
+/**
+ * Releases the local frame for a GubbinsMOS thread, returning it to the
+ * memory pool. This is used by the 'GMOS_THREAD_STOP' macro and should
+ * not be called directly.
+ * @param thread This is a pointer to the thread state data item, which
+ *     holds a reference to the allocated frame. A null reference may be
+ *     used for threads that do not have a local frame.
+ */
+static inline void gmosThreadFrameRelease (gmosThread_t* thread)
+{
+    gmosMempoolSegment_t* segment;
+
+    if (thread != NULL) {
+        segment = (gmosMempoolSegment_t*) (((uint8_t*) *thread) -
+            offsetof (gmosMempoolSegment_t, data));
+        gmosMempoolFree (segment);
+        *thread = GMOS_THREAD_FRAME_STOPPED;
+    }
+}
+
+/**
+ * This is an alternative to the 'GMOS_THREAD_START' macro which sets
+ * up a function for use as a GubbinsMOS thread with a local frame. The
+ * local frame is a data structure which is used to hold the thread
+ * local variables that need to be preserved when the thread yields
+ * control to the scheduler. It is allocated from the memory pool when
+ * the thread is first run and released by the 'GMOS_THREAD_STOP' macro,
+ * so memory is only used while the thread is active. The frame type
+ * must fit in a single memory pool segment, together with the thread
+ * resume label. The frame contents are cleared to zero when the thread
+ * is started or restarted. If no memory pool segments are available the
+ * thread function will be retried in the background. After the thread
+ * has stopped, it may be restarted by calling 'gmosThreadInit' and then
+ * resuming execution of the associated task.
+ * @param _thread_state_ This is the thread state data item that will be
+ *     used for storing the local frame reference during execution.
+ * @param _frame_type_ This is the data type of the local frame, which
+ *     will usually be a structure containing the persistent thread
+ *     local variables.
+ * @param _frame_ This is the name of the pointer variable that will be
+ *     declared for accessing the local frame contents.
+ */
+#define GMOS_THREAD_FRAME_START(_thread_state_, _frame_type_, _frame_) \
+typedef struct {                                                       \
+    gmosThread_t resumeLabel;                                          \
+    _frame_type_ frameData;                                            \
+} _gmos_thread_frame_t_;                                               \
+typedef char _gmos_thread_frame_size_check_ [                          \
+    (sizeof (_gmos_thread_frame_t_) <=                                 \
+    GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) ? 1 : -1];                       \
+gmosThread_t* _gmos_thread_frame_ptr_ = &(_thread_state_);             \
+_gmos_thread_frame_t_* _gmos_thread_frame_ =                           \
+    gmosThreadFrameAttach (                                            \
+    _gmos_thread_frame_ptr_, sizeof (_gmos_thread_frame_t_));          \
+gmosThread_t* _gmos_thread_state_ptr_;                                 \
+gmosTaskStatus_t _gmos_thread_status_ = GMOS_TASK_SUSPEND;             \
+_frame_type_* _frame_;                                                 \
+(void) sizeof (_gmos_thread_frame_size_check_);                        \
+if (_gmos_thread_frame_ == NULL) {                                     \
+    return (*_gmos_thread_frame_ptr_ == GMOS_THREAD_FRAME_STOPPED) ?   \
+        GMOS_TASK_SUSPEND : GMOS_TASK_RUN_BACKGROUND;                  \
+}                                                                      \
+_gmos_thread_state_ptr_ = &(_gmos_thread_frame_->resumeLabel);         \
+_frame_ = &(_gmos_thread_frame_->frameData);                           \
 if ((*_gmos_thread_state_ptr_) != (gmosThread_t) NULL) {               \
     GMOS_PLATFORM_GOTO_LABEL_ADDRESS(*_gmos_thread_state_ptr_);        \
 }
@@ -150,18 +269,45 @@ GMOS_THREAD_MAKE_LABEL(__LINE__) : do {} while (false);                \
 #define GMOS_THREAD_SLEEP(_delay_)                                     \
     GMOS_THREAD_SET_STATUS (GMOS_TASK_RUN_AFTER(_delay_))
 
+/**
+ * Provides a mechanism for suspending execution of the GubbinsMOS
+ * thread until one or more of the specified event bits are set or the
+ * timeout period has elapsed. The associated GubbinsMOS task must be
+ * the consumer task for the event. Thread execution will be resumed
+ * when the event bits are modified, but the thread will only continue
+ * past this point once one of the selected bits is set or the timeout
+ * expires. The event bits should then be checked to determine which
+ * condition occurred. On calling this macro, all data stored in local
+ * function scope variables will be invalidated.
+ * @param _event_ This is a pointer to the event state data structure
+ *     for the event that is to be waited on.
+ * @param _bit_mask_ This is a bit vector specifying the event bits that
+ *     are to be checked.
+ * @param _timeout_ This is the maximum time to wait for the event bits
+ *     to be set, expressed as an integer number of GubbinsMOS system
+ *     timer ticks.
+ */
+#define GMOS_THREAD_WAIT_EVENT(_event_, _bit_mask_, _timeout_) do {    \
+gmosEventWaitStart (_event_, _timeout_);                               \
+while (gmosEventWaitPending (                                          \
+    _event_, _bit_mask_, &_gmos_thread_status_)) {                     \
+    GMOS_THREAD_SET_STATUS (_gmos_thread_status_);                     \
+}                                                                      \
+} while (false)
+
 /**
  * This is a macro that should be placed at the end of a GubbinsMOS
  * thread function in order to stop further execution of the thread.
  * After executing the thread stop macro, further processing using the
  * thread can only be resumed by reinitialising the thread state data
  * item and explicitly resuming execution of the associated GubbinsMOS
- * task.
+ * task. If the thread has a local frame, it will be released.
  */
 #define GMOS_THREAD_STOP() do {                                        \
 *_gmos_thread_state_ptr_ =                                             \
     GMOS_PLATFORM_GET_LABEL_ADDRESS(_gmos_thread_exit_);               \
 _gmos_thread_status_ = GMOS_TASK_SUSPEND;                              \
+gmosThreadFrameRelease (_gmos_thread_frame_ptr_);                      \
 _gmos_thread_exit_ : return (_gmos_thread_status_);                    \
 } while (false)
 
@@ -172,7 +318,8 @@ _gmos_thread_exit_ : return (_gmos_thread_status_);                    \
  * function scope variables will be invalidated and the thread state
  * will be reinitialised in order to restart the thread function. The
  * associated GubbinsMOS task will then be rescheduled for immediate
- * execution.
+ * execution. If the thread has a local frame, it will be retained and
+ * cleared to zero on restart.
  */
 #define GMOS_THREAD_CONTINUE() do {                                    \
 *_gmos_thread_state_ptr_ = (gmosThread_t) NULL;                        \
@@ -0,0 +1,147 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * This header defines the API for GubbinsMOS callback timers. Callback
+ * timers provide a lightweight alternative to using a complete task
+ * for simple one-shot and periodic timeouts. All active timers are held
+ * in a single sorted timer list which is serviced by a shared timer
+ * task, and the timer callback functions are always run from the timer
+ * task context. Timer callbacks should complete quickly, since they
+ * delay the processing of any other expired timers.
+ */
+
+#ifndef GMOS_TIMERS_H
+#define GMOS_TIMERS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gmos-config.h"
+#include "gmos-scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Defines the function prototype to be used for timer callback
+ * functions.
+ * @param timerData This is an opaque pointer to the data item that was
+ *     supplied when the timer was initialised.
+ */
+typedef void (*gmosTimerFn_t) (void* timerData);
+
+/**
+ * Defines the GubbinsMOS callback timer data structure which is used
+ * for managing an individual callback timer. All fields are private to
+ * the timer implementation.
+ */
+typedef struct gmosTimer_t {
+
+    // This is a pointer to the timer callback function.
+    gmosTimerFn_t timerFn;
+
+    // This is an opaque pointer to the timer callback data item.
+    void* timerData;
+
+    // This is a pointer to the next timer in the active timer list.
+    // Timers that are not running refer to themselves.
+    struct gmosTimer_t* nextTimer;
+
+    // This is the system timer value at which the timer will expire.
+    uint32_t expiryTime;
+
+    // This is the timer period for periodic timers, or zero for
+    // one-shot timers.
+    uint32_t timerPeriod;
+
+} gmosTimer_t;
+
+/**
+ * Defines the callback timer state data structure. This holds the list
+ * of active timers and the shared timer task for a single GubbinsMOS
+ * instance. All fields are private to the timer implementation.
+ */
+typedef struct gmosTimerState_t {
+
+    // Specifies the start of the list of active timers, sorted in
+    // order of expiry time.
+    gmosTimer_t* activeTimers;
+
+    // Specifies the shared timer task state.
+    gmosTaskState_t timerTask;
+
+    // Indicates that the shared timer task has been started.
+    bool timerTaskStarted;
+
+} gmosTimerState_t;
+
+/**
+ * Initialises a callback timer on startup. This must be called before
+ * any other timer functions are used with the timer.
+ * @param timer This is the callback timer that is to be initialised.
+ * @param timerFn This is the callback function that will be called
+ *     each time the timer expires.
+ * @param timerData This is an opaque pointer to a data item that will
+ *     be passed to the callback function.
+ */
+void gmosTimerInit (gmosTimer_t* timer,
+    gmosTimerFn_t timerFn, void* timerData);
+
+/**
+ * Starts a one-shot callback timer. If the timer is already running,
+ * it will be restarted using the new delay.
+ * @param timer This is the callback timer that is to be started.
+ * @param delay This is the delay after which the timer will expire,
+ *     expressed as an integer number of system timer ticks.
+ */
+void gmosTimerStart (gmosTimer_t* timer, uint32_t delay);
+
+/**
+ * Starts a periodic callback timer. If the timer is already running,
+ * it will be restarted using the new period. Successive expiry times
+ * are derived from the initial start time, so periodic timers will not
+ * drift if the timer task runs late. If the timer task is delayed by
+ * more than a complete timer period, the missed periods are skipped.
+ * @param timer This is the callback timer that is to be started.
+ * @param period This is the timer period, expressed as an integer
+ *     number of system timer ticks. It must be greater than zero.
+ */
+void gmosTimerStartPeriodic (gmosTimer_t* timer, uint32_t period);
+
+/**
+ * Stops a callback timer. This has no effect if the timer is not
+ * currently running.
+ * @param timer This is the callback timer that is to be stopped.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     timer was running and 'false' otherwise.
+ */
+bool gmosTimerStop (gmosTimer_t* timer);
+
+/**
+ * Determines whether a callback timer is currently running.
+ * @param timer This is the callback timer that is to be checked.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     timer is running and 'false' otherwise.
+ */
+bool gmosTimerIsRunning (gmosTimer_t* timer);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // GMOS_TIMERS_H
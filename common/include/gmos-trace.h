@@ -0,0 +1,167 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * This header defines the API for the GubbinsMOS timeline trace
+ * recorder. When enabled, the trace recorder captures scheduler, event
+ * and stream activity in a fixed size ring buffer, which may then be
+ * written to the debug log for conversion into a timeline view using
+ * the 'gmos-trace-convert.py' host tool.
+ */
+
+#ifndef GMOS_TRACE_H
+#define GMOS_TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gmos-config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Defines the set of trace record types that may be recorded.
+ */
+typedef enum {
+    GMOS_TRACE_TASK_START   = 0x01,
+    GMOS_TRACE_TASK_STOP    = 0x02,
+    GMOS_TRACE_EVENT_SET    = 0x03,
+    GMOS_TRACE_STREAM_WRITE = 0x04,
+    GMOS_TRACE_STREAM_READ  = 0x05,
+    GMOS_TRACE_IDLE_ENTER   = 0x06,
+    GMOS_TRACE_IDLE_EXIT    = 0x07,
+    GMOS_TRACE_ISR_ENTER    = 0x08,
+    GMOS_TRACE_ISR_EXIT     = 0x09,
+    GMOS_TRACE_USER_MARKER  = 0x0A
+} gmosTraceRecordType_t;
+
+/**
+ * Defines the trace record data structure that is used to store each
+ * entry in the trace ring buffer.
+ */
+typedef struct gmosTraceRecord_t {
+
+    // This is a reference to the object associated with the trace
+    // record, such as a task state or event data structure.
+    const void* object;
+
+    // This is the platform cycle counter value at which the trace
+    // record was captured.
+    uint32_t timestamp;
+
+    // This is a record type specific value, such as the event bits or
+    // the number of stream bytes transferred.
+    uint32_t value;
+
+    // This is the trace record type.
+    uint8_t recordType;
+
+} gmosTraceRecord_t;
+
+/**
+ * Adds a new record to the trace ring buffer, overwriting the oldest
+ * record if the buffer is full. This may be called from interrupt
+ * service routines. On targets that support lock free 32-bit atomic
+ * operations, the trace buffer slot is claimed using an atomic
+ * increment instead of the platform mutex. It should normally be
+ * invoked via the 'GMOS_TRACE' macro so that it is removed when tracing
+ * is disabled.
+ * @param recordType This is the trace record type, which will usually
+ *     be one of the values specified by the 'gmosTraceRecordType_t'
+ *     enumeration.
+ * @param object This is a reference to the object associated with the
+ *     trace record.
+ * @param value This is a record type specific value.
+ */
+void gmosTraceRecord (uint8_t recordType,
+    const void* object, uint32_t value);
+
+/**
+ * Adds a new record to the trace ring buffer when the caller already
+ * holds the platform mutex lock. This avoids claiming the platform
+ * mutex again from within an existing critical section. It should
+ * normally be invoked via the 'GMOS_TRACE_LOCKED' macro so that it is
+ * removed when tracing is disabled.
+ * @param recordType This is the trace record type, which will usually
+ *     be one of the values specified by the 'gmosTraceRecordType_t'
+ *     enumeration.
+ * @param object This is a reference to the object associated with the
+ *     trace record.
+ * @param value This is a record type specific value.
+ */
+void gmosTraceRecordLocked (uint8_t recordType,
+    const void* object, uint32_t value);
+
+/**
+ * Enables or disables trace recording. Trace recording is enabled by
+ * default. Disabling trace recording may be used to preserve the trace
+ * history leading up to a fault condition.
+ * @param enabled This is a boolean value which should be set to 'true'
+ *     to enable trace recording and 'false' to disable it.
+ */
+void gmosTraceSetEnabled (bool enabled);
+
+/**
+ * Writes the contents of the trace ring buffer to the debug log, in a
+ * format suitable for processing by the 'gmos-trace-convert.py' host
+ * tool. Trace recording is suspended while the trace is being written
+ * and the trace ring buffer is cleared on completion. When multiple
+ * scheduler cores are configured, each core records to its own trace
+ * ring buffer and the records for all cores are merged in timestamp
+ * order.
+ */
+void gmosTraceDump (void);
+
+/**
+ * Provides a trace recording macro that is used to add trace records
+ * to the trace ring buffer. This will be removed at compile time if
+ * tracing is disabled using the 'GMOS_CONFIG_TRACE_ENABLE' option.
+ * @param _type_ This is the trace record type.
+ * @param _object_ This is a reference to the object associated with
+ *     the trace record.
+ * @param _value_ This is a record type specific value.
+ */
+#if GMOS_CONFIG_TRACE_ENABLE
+#define GMOS_TRACE(_type_, _object_, _value_)                          \
+    gmosTraceRecord (_type_, _object_, _value_)
+#else
+#define GMOS_TRACE(_type_, _object_, _value_) do {} while (false)
+#endif
+
+/**
+ * Provides a trace recording macro that is used to add trace records
+ * to the trace ring buffer when the caller already holds the platform
+ * mutex lock. This will be removed at compile time if tracing is
+ * disabled using the 'GMOS_CONFIG_TRACE_ENABLE' option.
+ * @param _type_ This is the trace record type.
+ * @param _object_ This is a reference to the object associated with
+ *     the trace record.
+ * @param _value_ This is a record type specific value.
+ */
+#if GMOS_CONFIG_TRACE_ENABLE
+#define GMOS_TRACE_LOCKED(_type_, _object_, _value_)                   \
+    gmosTraceRecordLocked (_type_, _object_, _value_)
+#else
+#define GMOS_TRACE_LOCKED(_type_, _object_, _value_) do {} while (false)
+#endif
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // GMOS_TRACE_H
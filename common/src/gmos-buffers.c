@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2025 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,6 +27,7 @@
 #include "gmos-config.h"
 #include "gmos-mempool.h"
 #include "gmos-buffers.h"
+#include "gmos-profile.h"
 
 // Use the standard 'memcpy' function for buffer data transfer.
 #if GMOS_CONFIG_BUFFERS_USE_MEMCPY
@@ -70,17 +71,27 @@ static void gmosBufferCopyToSegments (gmosMempoolSegment_t* segment,
 {
     uint8_t* blockPtr;
     uint_fast16_t blockSize;
+    uint_fast16_t segmentSize;
+    GMOS_PROFILE_BEGIN (GMOS_PROFILE_ID_BUFFER_COPY);
+
+    // Zero length copies may refer to the end of the segment list.
+    if (copySize == 0) {
+        GMOS_PROFILE_END (GMOS_PROFILE_ID_BUFFER_COPY);
+        return;
+    }
 
     // Skip to the segment containing the start of the data block.
-    while (segmentOffset >= GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) {
+    segmentSize = gmosMempoolGetSegmentSize (segment);
+    while (segmentOffset >= segmentSize) {
+        segmentOffset -= segmentSize;
         segment = segment->nextSegment;
-        segmentOffset -= GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
+        segmentSize = gmosMempoolGetSegmentSize (segment);
     }
 
     // Copy the data to successive segments.
     while (true) {
-        blockPtr = &(segment->data.bytes [segmentOffset]);
-        blockSize = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE - segmentOffset;
+        blockPtr = segment->data.bytes + segmentOffset;
+        blockSize = segmentSize - segmentOffset;
         if (blockSize > copySize) {
             blockSize = copySize;
         }
@@ -89,13 +100,15 @@ static void gmosBufferCopyToSegments (gmosMempoolSegment_t* segment,
 
         // Break out of the loop on completion.
         if (copySize == 0) {
-            return;
+            break;
         } else {
             segment = segment->nextSegment;
+            segmentSize = gmosMempoolGetSegmentSize (segment);
             segmentOffset = 0;
             sourceData += blockSize;
         }
     }
+    GMOS_PROFILE_END (GMOS_PROFILE_ID_BUFFER_COPY);
 }
 
 /*
@@ -110,17 +123,25 @@ static void gmosBufferCopyFromSegments (gmosMempoolSegment_t* segment,
 {
     uint8_t* blockPtr;
     uint_fast16_t blockSize;
+    uint_fast16_t segmentSize;
+
+    // Zero length copies may refer to the end of the segment list.
+    if (copySize == 0) {
+        return;
+    }
 
     // Skip to the segment containing the start of the data block.
-    while (segmentOffset >= GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) {
+    segmentSize = gmosMempoolGetSegmentSize (segment);
+    while (segmentOffset >= segmentSize) {
+        segmentOffset -= segmentSize;
         segment = segment->nextSegment;
-        segmentOffset -= GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
+        segmentSize = gmosMempoolGetSegmentSize (segment);
     }
 
     // Copy the data to successive segments.
     while (true) {
-        blockPtr = &(segment->data.bytes [segmentOffset]);
-        blockSize = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE - segmentOffset;
+        blockPtr = segment->data.bytes + segmentOffset;
+        blockSize = segmentSize - segmentOffset;
         if (blockSize > copySize) {
             blockSize = copySize;
         }
@@ -132,12 +153,150 @@ static void gmosBufferCopyFromSegments (gmosMempoolSegment_t* segment,
             return;
         } else {
             segment = segment->nextSegment;
+            segmentSize = gmosMempoolGetSegmentSize (segment);
             segmentOffset = 0;
             targetData += blockSize;
         }
     }
 }
 
+/*
+ * Copies a block of data between two linked lists of segments, starting
+ * with the specified source and target segment offsets. This should
+ * always be successful, since the wrapper functions will have checked
+ * for boundary conditions.
+ */
+static void gmosBufferCopyBetweenSegments (
+    gmosMempoolSegment_t* sourceSegment, uint_fast16_t sourceOffset,
+    gmosMempoolSegment_t* targetSegment, uint_fast16_t targetOffset,
+    uint_fast16_t copySize)
+{
+    uint_fast16_t blockSize;
+    uint_fast16_t sourceSize;
+    uint_fast16_t targetSize;
+
+    // Skip to the segments containing the start of the data blocks.
+    sourceSize = gmosMempoolGetSegmentSize (sourceSegment);
+    while (sourceOffset >= sourceSize) {
+        sourceOffset -= sourceSize;
+        sourceSegment = sourceSegment->nextSegment;
+        sourceSize = gmosMempoolGetSegmentSize (sourceSegment);
+    }
+    targetSize = gmosMempoolGetSegmentSize (targetSegment);
+    while (targetOffset >= targetSize) {
+        targetOffset -= targetSize;
+        targetSegment = targetSegment->nextSegment;
+        targetSize = gmosMempoolGetSegmentSize (targetSegment);
+    }
+
+    // Copy the data in blocks that do not cross either source or
+    // destination segment boundaries, since the segment sizes may
+    // differ.
+    while (true) {
+        blockSize = sourceSize - sourceOffset;
+        if (blockSize > targetSize - targetOffset) {
+            blockSize = targetSize - targetOffset;
+        }
+        if (blockSize > copySize) {
+            blockSize = copySize;
+        }
+        BUFFER_COPY (targetSegment->data.bytes + targetOffset,
+            sourceSegment->data.bytes + sourceOffset, blockSize);
+        copySize -= blockSize;
+        if (copySize == 0) {
+            break;
+        }
+
+        // Select the next source and destination segments if required.
+        sourceOffset += blockSize;
+        if (sourceOffset == sourceSize) {
+            sourceSegment = sourceSegment->nextSegment;
+            sourceSize = gmosMempoolGetSegmentSize (sourceSegment);
+            sourceOffset = 0;
+        }
+        targetOffset += blockSize;
+        if (targetOffset == targetSize) {
+            targetSegment = targetSegment->nextSegment;
+            targetSize = gmosMempoolGetSegmentSize (targetSegment);
+            targetOffset = 0;
+        }
+    }
+}
+
+/*
+ * Ensures that none of the segments holding the specified number of
+ * bytes at the start of the buffer are shared with other buffers. If a
+ * shared segment is found, all the buffer data up to the end of the
+ * last segment in the specified range is copied to newly allocated
+ * segments. These are then linked to the remaining segments, which are
+ * still shared. The copied data is aligned to the end of the new
+ * segments so that the segment boundaries are unchanged.
+ */
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+static bool gmosBufferUnshare (
+    gmosBuffer_t* buffer, uint_fast16_t dataLimit)
+{
+    bool sharedFound = false;
+    uint_fast16_t capacity;
+    uint_fast16_t copySize;
+    uint_fast16_t newCapacity;
+    gmosMempoolSegment_t* segment;
+    gmosMempoolSegment_t* newSegments;
+    gmosMempoolSegment_t** segmentPtr;
+
+    // Follow the segment list to the first segment after the specified
+    // range, checking for shared segments.
+    capacity = 0;
+    segment = buffer->segmentList;
+    while (capacity < buffer->bufferOffset + dataLimit) {
+        if ((!sharedFound) && (gmosMempoolIsShared (segment))) {
+            sharedFound = true;
+        }
+        capacity += gmosMempoolGetSegmentSize (segment);
+        segment = segment->nextSegment;
+    }
+    if (!sharedFound) {
+        return true;
+    }
+
+    // The remaining segments are discarded if they do not contain any
+    // buffer data.
+    if (capacity >= buffer->bufferOffset + buffer->bufferSize) {
+        capacity = buffer->bufferOffset + buffer->bufferSize;
+        segment = NULL;
+    }
+
+    // Allocate the new segments and determine their combined capacity.
+    copySize = capacity - buffer->bufferOffset;
+    newSegments = gmosMempoolAllocCapacity (copySize);
+    if (newSegments == NULL) {
+        return false;
+    }
+    newCapacity = 0;
+    segmentPtr = &newSegments;
+    while (*segmentPtr != NULL) {
+        newCapacity += gmosMempoolGetSegmentSize (*segmentPtr);
+        segmentPtr = &((*segmentPtr)->nextSegment);
+    }
+
+    // Copy the data and link the new segments to the remaining shared
+    // segments before releasing the original segments.
+    gmosBufferCopyBetweenSegments (buffer->segmentList,
+        buffer->bufferOffset, newSegments, newCapacity - copySize,
+        copySize);
+    if (segment != NULL) {
+        gmosMempoolRetain (segment);
+        *segmentPtr = segment;
+    }
+    gmosMempoolFreeSegments (buffer->segmentList);
+    buffer->segmentList = newSegments;
+    buffer->bufferOffset = newCapacity - copySize;
+    return true;
+}
+#else
+#define gmosBufferUnshare(_buffer_, _dataLimit_) true
+#endif
+
 /*
  * Performs a one-time initialisation of a GubbinsMOS data buffer. This
  * should be called during initialisation to set up the data buffer for
@@ -172,8 +331,7 @@ bool gmosBufferReset (gmosBuffer_t* buffer, uint16_t size)
 
     // Attempt to allocate the specified amount of memory.
     if (size > 0) {
-        buffer->segmentList = gmosMempoolAllocSegments
-            (1 + ((size - 1) / GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE));
+        buffer->segmentList = gmosMempoolAllocCapacity (size);
         if (buffer->segmentList != NULL) {
             buffer->bufferSize = size;
         } else {
@@ -191,25 +349,35 @@ static bool gmosBufferIncrSizeEnd (
     gmosBuffer_t* buffer, uint_fast16_t size)
 {
     bool extendOk = true;
-    uint_fast16_t segmentCount;
-    uint_fast16_t newSegmentCount;
+    uint_fast16_t capacity;
     gmosMempoolSegment_t** segmentPtr;
     gmosMempoolSegment_t* newSegments;
 
-    // Count the number of segments currently in the buffer.
-    segmentCount = 0;
+    // Ensure that the segments holding the existing buffer data can be
+    // modified.
+    if (!gmosBufferUnshare (buffer, buffer->bufferSize)) {
+        return false;
+    }
+
+    // Determine the capacity of the segments currently in the buffer.
+    // Any shared segments after the end of the buffer data are
+    // released, since they can not be modified.
+    capacity = 0;
     segmentPtr = &(buffer->segmentList);
     while (*segmentPtr != NULL) {
-        segmentCount += 1;
+        if (gmosMempoolIsShared (*segmentPtr)) {
+            gmosMempoolFreeSegments (*segmentPtr);
+            *segmentPtr = NULL;
+            break;
+        }
+        capacity += gmosMempoolGetSegmentSize (*segmentPtr);
         segmentPtr = &((*segmentPtr)->nextSegment);
     }
 
     // Allocate additional memory segments if required.
-    newSegmentCount = 1 - segmentCount +
-        ((buffer->bufferOffset + size - 1) /
-        GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE);
-    if (newSegmentCount != 0) {
-        newSegments = gmosMempoolAllocSegments (newSegmentCount);
+    if (buffer->bufferOffset + size > capacity) {
+        newSegments = gmosMempoolAllocCapacity (
+            buffer->bufferOffset + size - capacity);
         if (newSegments != NULL) {
             *segmentPtr = newSegments;
         } else {
@@ -229,19 +397,26 @@ static bool gmosBufferIncrSizeEnd (
 static void gmosBufferDecrSizeEnd (
     gmosBuffer_t* buffer, uint_fast16_t size)
 {
+    bool sharedFound = false;
     uint_fast16_t byteCount;
     gmosMempoolSegment_t** segmentPtr;
 
-    // Follow the segment list to the trim point.
+    // Follow the segment list to the trim point, checking for shared
+    // segments.
     byteCount = 0;
     segmentPtr = &(buffer->segmentList);
     while (byteCount < buffer->bufferOffset + size) {
-        byteCount += GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
+        if ((!sharedFound) && (gmosMempoolIsShared (*segmentPtr))) {
+            sharedFound = true;
+        }
+        byteCount += gmosMempoolGetSegmentSize (*segmentPtr);
         segmentPtr = &((*segmentPtr)->nextSegment);
     }
 
-    // Return the excess segments to the memory pool.
-    if (*segmentPtr != NULL) {
+    // Return the excess segments to the memory pool. A shared segment
+    // list can not be modified, so the excess segments are retained
+    // until the buffer is released.
+    if ((*segmentPtr != NULL) && (!sharedFound)) {
         gmosMempoolFreeSegments (*segmentPtr);
         *segmentPtr = NULL;
     }
@@ -257,11 +432,19 @@ static bool gmosBufferIncrSizeStart (
 {
     bool extendOk = true;
     uint_fast16_t extraByteCount;
-    uint_fast16_t newSegmentCount;
-    uint_fast16_t newOffset;
+    uint_fast16_t newCapacity;
     gmosMempoolSegment_t** segmentPtr;
     gmosMempoolSegment_t* newSegments;
 
+    // The unused space at the start of a shared initial segment can not
+    // be modified, so a private copy of the initial segment is needed.
+    if ((buffer->bufferOffset > 0) &&
+        (gmosMempoolIsShared (buffer->segmentList))) {
+        if (!gmosBufferUnshare (buffer, 1)) {
+            return false;
+        }
+    }
+
     // Extend into the existing memory segment if possible.
     extraByteCount = size - buffer->bufferSize;
     if (extraByteCount <= buffer->bufferOffset) {
@@ -270,19 +453,15 @@ static bool gmosBufferIncrSizeStart (
         return true;
     };
 
-    // Calculate the number of additional segments required and the new
-    // buffer offset.
-    newSegmentCount = 1 + (extraByteCount - buffer->bufferOffset - 1) /
-        GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
-    newOffset = buffer->bufferOffset - extraByteCount +
-        newSegmentCount * GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
-
     // Allocate additional memory segments and link them to the start
-    // of the buffer.
-    newSegments = gmosMempoolAllocSegments (newSegmentCount);
+    // of the buffer, determining their combined capacity.
+    newSegments = gmosMempoolAllocCapacity (
+        extraByteCount - buffer->bufferOffset);
     if (newSegments != NULL) {
+        newCapacity = gmosMempoolGetSegmentSize (newSegments);
         segmentPtr = &(newSegments->nextSegment);
         while (*segmentPtr != NULL) {
+            newCapacity += gmosMempoolGetSegmentSize (*segmentPtr);
             segmentPtr = &((*segmentPtr)->nextSegment);
         }
         *segmentPtr = buffer->segmentList;
@@ -294,7 +473,7 @@ static bool gmosBufferIncrSizeStart (
     // Update the buffer size and offset.
     if (extendOk) {
         buffer->bufferSize = size;
-        buffer->bufferOffset = newOffset;
+        buffer->bufferOffset += newCapacity - extraByteCount;
     }
     return extendOk;
 }
@@ -307,32 +486,41 @@ static void gmosBufferDecrSizeStart (
     gmosBuffer_t* buffer, uint_fast16_t size)
 {
     uint_fast16_t trimByteCount;
-    uint_fast16_t segmentCount;
+    uint_fast16_t trimCapacity;
+    uint_fast16_t segmentSize;
     gmosMempoolSegment_t** segmentPtr;
     gmosMempoolSegment_t* freeSegments;
 
     // Follow the segment list to the trim point.
     trimByteCount = buffer->bufferSize - size;
-    segmentCount = 0;
+    trimCapacity = 0;
     segmentPtr = &(buffer->segmentList);
+    segmentSize = gmosMempoolGetSegmentSize (*segmentPtr);
     while (buffer->bufferOffset + trimByteCount >=
-        (segmentCount + 1) * GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) {
-        segmentCount += 1;
+        trimCapacity + segmentSize) {
+        trimCapacity += segmentSize;
         segmentPtr = &((*segmentPtr)->nextSegment);
+        segmentSize = gmosMempoolGetSegmentSize (*segmentPtr);
     }
 
-    // Return the excess segments to the memory pool.
-    if (segmentCount > 0) {
+    // Return the excess segments to the memory pool. When shared
+    // segments are enabled, the segment list is not modified. Instead,
+    // the new initial segment is retained so that releasing the
+    // original segment list stops at that point.
+    if (trimCapacity > 0) {
         freeSegments = buffer->segmentList;
         buffer->segmentList = *segmentPtr;
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+        gmosMempoolRetain (buffer->segmentList);
+#else
         *segmentPtr = NULL;
+#endif
         gmosMempoolFreeSegments (freeSegments);
     }
 
     // Update the buffer size and offset fields.
     buffer->bufferSize = size;
-    buffer->bufferOffset += trimByteCount -
-        segmentCount * GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
+    buffer->bufferOffset += trimByteCount - trimCapacity;
 }
 
 /*
@@ -435,14 +623,18 @@ bool gmosBufferWrite (gmosBuffer_t* buffer, uint16_t offset,
 {
     bool writeOk;
 
-    // Check for valid offset and size before initiating the copy.
-    if (((uint32_t) offset) + ((uint32_t) writeSize) <=
+    // Check for valid offset and size before initiating the copy. Any
+    // shared segments that are to be modified must first be copied.
+    if (((uint32_t) offset) + ((uint32_t) writeSize) >
         ((uint32_t) buffer->bufferSize)) {
+        writeOk = false;
+    } else if ((writeSize > 0) &&
+        (!gmosBufferUnshare (buffer, offset + writeSize))) {
+        writeOk = false;
+    } else {
         gmosBufferCopyToSegments (buffer->segmentList,
             buffer->bufferOffset + offset, writeData, writeSize);
         writeOk = true;
-    } else {
-        writeOk = false;
     }
     return writeOk;
 }
@@ -538,11 +730,12 @@ void gmosBufferMove (gmosBuffer_t* source, gmosBuffer_t* destination)
 static bool gmosBufferCopyCommon (gmosBuffer_t* source,
     gmosBuffer_t* destination, uint16_t copyOffset, uint16_t copySize)
 {
-    uint_fast16_t segmentCount;
-    uint_fast16_t targetOffset;
     gmosMempoolSegment_t* segmentList;
-    gmosMempoolSegment_t* sourceSegment;
-    gmosMempoolSegment_t* targetSegment;
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+    uint_fast16_t sourceOffset;
+    uint_fast16_t sourceSize;
+    uint_fast16_t trailingSize;
+#endif
 
     // Ensure that the destination buffer is empty. This is sufficient
     // to copy an empty source buffer section.
@@ -551,35 +744,41 @@ static bool gmosBufferCopyCommon (gmosBuffer_t* source,
         return true;
     }
 
-    // Allocate the required number of destination buffer segments.
-    segmentCount = 1 + (source->bufferOffset + copyOffset + copySize - 1) /
-        GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
-    segmentList = gmosMempoolAllocSegments (segmentCount);
-    if (segmentList == NULL) {
-        return false;
-    }
-
-    // Skip source segments that are not required for the segment copy.
-    targetOffset = source->bufferOffset + copyOffset;
-    sourceSegment = source->segmentList;
-    while (targetOffset >= GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) {
-        targetOffset -= GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
-        sourceSegment = sourceSegment->nextSegment;
+    // Share the source segments if the section is not small relative to
+    // the source data that follows it. The destination buffer refers to
+    // the source segment that contains the start of the section.
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+    trailingSize = source->bufferSize - copyOffset - copySize;
+    if (trailingSize <= copySize) {
+        sourceOffset = source->bufferOffset + copyOffset;
+        segmentList = source->segmentList;
+        sourceSize = gmosMempoolGetSegmentSize (segmentList);
+        while (sourceOffset >= sourceSize) {
+            sourceOffset -= sourceSize;
+            segmentList = segmentList->nextSegment;
+            sourceSize = gmosMempoolGetSegmentSize (segmentList);
+        }
+        gmosMempoolRetain (segmentList);
+        destination->segmentList = segmentList;
+        destination->bufferSize = copySize;
+        destination->bufferOffset = sourceOffset;
+        return true;
     }
+#endif
 
-    // Copy the contents of each remaining buffer segment in turn.
-    targetSegment = segmentList;
-    while ((sourceSegment != NULL) && (targetSegment != NULL)) {
-        BUFFER_COPY (targetSegment->data.bytes,
-            sourceSegment->data.bytes, GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE);
-        sourceSegment = sourceSegment->nextSegment;
-        targetSegment = targetSegment->nextSegment;
+    // Allocate the required destination buffer segments and copy the
+    // source data.
+    segmentList = gmosMempoolAllocCapacity (copySize);
+    if (segmentList == NULL) {
+        return false;
     }
+    gmosBufferCopyBetweenSegments (source->segmentList,
+        source->bufferOffset + copyOffset, segmentList, 0, copySize);
 
     // Update the destination buffer state.
     destination->segmentList = segmentList;
     destination->bufferSize = copySize;
-    destination->bufferOffset = targetOffset;
+    destination->bufferOffset = 0;
     return true;
 }
 
@@ -613,9 +812,10 @@ bool gmosBufferCopySection (gmosBuffer_t* source,
 
 /*
  * Perform concatenation where data from source buffer B is appended to
- * source buffer A.
+ * source buffer A. Data is only removed from source buffer B after it
+ * has been appended, so no data is lost if the append fails.
  */
-static inline void gmosBufferConcatenateIntoA (
+static inline bool gmosBufferConcatenateIntoA (
     gmosBuffer_t* sourceA, gmosBuffer_t* sourceB)
 {
     uint8_t copyData [2 * GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE];
@@ -628,16 +828,20 @@ static inline void gmosBufferConcatenateIntoA (
             copySize = sourceB->bufferSize;
         }
         gmosBufferRead (sourceB, 0, copyData, copySize);
+        if (!gmosBufferAppend (sourceA, copyData, copySize)) {
+            return false;
+        }
         gmosBufferRebase (sourceB, sourceB->bufferSize - copySize);
-        gmosBufferAppend (sourceA, copyData, copySize);
     }
+    return true;
 }
 
 /*
  * Perform concatenation where data from source buffer A is prepended to
- * source buffer B.
+ * source buffer B. Data is only removed from source buffer A after it
+ * has been prepended, so no data is lost if the prepend fails.
  */
-static inline void gmosBufferConcatenateIntoB (
+static inline bool gmosBufferConcatenateIntoB (
     gmosBuffer_t* sourceA, gmosBuffer_t* sourceB)
 {
     uint8_t copyData [2 * GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE];
@@ -652,9 +856,12 @@ static inline void gmosBufferConcatenateIntoB (
         }
         copyOffset = sourceA->bufferSize - copySize;
         gmosBufferRead (sourceA, copyOffset, copyData, copySize);
+        if (!gmosBufferPrepend (sourceB, copyData, copySize)) {
+            return false;
+        }
         gmosBufferResize (sourceA, sourceA->bufferSize - copySize);
-        gmosBufferPrepend (sourceB, copyData, copySize);
     }
+    return true;
 }
 
 /*
@@ -665,6 +872,8 @@ static inline void gmosBufferConcatenateIntoB (
 bool gmosBufferConcatenate (gmosBuffer_t* sourceA,
     gmosBuffer_t* sourceB, gmosBuffer_t* destination)
 {
+    bool concatOk = true;
+
     // Reset the destination buffer if both source buffers are empty.
     if ((sourceA->bufferSize == 0) && (sourceB->bufferSize == 0)) {
         gmosBufferReset (destination, 0);
@@ -686,20 +895,20 @@ bool gmosBufferConcatenate (gmosBuffer_t* sourceA,
 
     // Perform concatenation when source A is the largest buffer.
     else if (sourceA->bufferSize >= sourceB->bufferSize) {
-        gmosBufferConcatenateIntoA (sourceA, sourceB);
-        if (destination != sourceA) {
+        concatOk = gmosBufferConcatenateIntoA (sourceA, sourceB);
+        if (concatOk && (destination != sourceA)) {
             gmosBufferMove (sourceA, destination);
         }
     }
 
     // Perform concatenation when source B is the largest buffer.
     else {
-        gmosBufferConcatenateIntoB (sourceA, sourceB);
-        if (destination != sourceB) {
+        concatOk = gmosBufferConcatenateIntoB (sourceA, sourceB);
+        if (concatOk && (destination != sourceB)) {
             gmosBufferMove (sourceB, destination);
         }
     }
-    return true;
+    return concatOk;
 }
 
 /*
@@ -718,11 +927,11 @@ gmosMempoolSegment_t* gmosBufferGetSegment (gmosBuffer_t* buffer,
     }
 
     // Follow the segment list to the specified offset.
-    byteCount = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
+    byteCount = 0;
     segment = buffer->segmentList;
     while (segment != NULL) {
+        byteCount += gmosMempoolGetSegmentSize (segment);
         if (buffer->bufferOffset + dataOffset >= byteCount) {
-            byteCount += GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
             segment = segment->nextSegment;
         } else {
             break;
@@ -730,3 +939,428 @@ gmosMempoolSegment_t* gmosBufferGetSegment (gmosBuffer_t* buffer,
     }
     return segment;
 }
+
+/*
+ * Advances the cursor position by the specified number of bytes,
+ * following the buffer segment list as required. The cursor is left
+ * at the end of the last segment when it reaches the end of the
+ * segment list. This should always be successful, since the wrapper
+ * functions will have checked for boundary conditions.
+ */
+static void gmosBufferCursorAdvance (gmosBufferCursor_t* cursor,
+    uint_fast16_t advanceSize)
+{
+    gmosMempoolSegment_t* segment = cursor->segment;
+    uint_fast16_t segmentOffset = cursor->segmentOffset + advanceSize;
+    uint_fast16_t segmentSize;
+
+    // Skip to the segment containing the new cursor position.
+    if (segment != NULL) {
+        segmentSize = gmosMempoolGetSegmentSize (segment);
+        while ((segmentOffset >= segmentSize) &&
+            (segment->nextSegment != NULL)) {
+            segmentOffset -= segmentSize;
+            segment = segment->nextSegment;
+            segmentSize = gmosMempoolGetSegmentSize (segment);
+        }
+    }
+    cursor->segment = segment;
+    cursor->segmentOffset = segmentOffset;
+    cursor->position += advanceSize;
+}
+
+/*
+ * Transfers a block of data between the buffer segments and a byte
+ * array, starting at the current cursor position. This should always
+ * be successful, since the wrapper functions will have checked for
+ * boundary conditions.
+ */
+static void gmosBufferCursorTransfer (gmosBufferCursor_t* cursor,
+    uint8_t* data, uint_fast16_t transferSize, bool writeData)
+{
+    gmosMempoolSegment_t* segment = cursor->segment;
+    uint_fast16_t segmentOffset = cursor->segmentOffset;
+    uint_fast16_t segmentSize;
+    uint_fast16_t blockSize;
+    uint8_t* blockPtr;
+
+    // Copy the data to or from successive segments.
+    cursor->position += transferSize;
+    while (transferSize > 0) {
+        segmentSize = gmosMempoolGetSegmentSize (segment);
+        if (segmentOffset >= segmentSize) {
+            segment = segment->nextSegment;
+            segmentOffset = 0;
+            continue;
+        }
+        blockPtr = segment->data.bytes + segmentOffset;
+        blockSize = segmentSize - segmentOffset;
+        if (blockSize > transferSize) {
+            blockSize = transferSize;
+        }
+        if (writeData) {
+            BUFFER_COPY (blockPtr, data, blockSize);
+        } else {
+            BUFFER_COPY (data, blockPtr, blockSize);
+        }
+        segmentOffset += blockSize;
+        transferSize -= blockSize;
+        data += blockSize;
+    }
+    cursor->segment = segment;
+    cursor->segmentOffset = segmentOffset;
+}
+
+/*
+ * Initialises a data buffer cursor for sequential access to the
+ * contents of a data buffer.
+ */
+bool gmosBufferCursorInit (gmosBufferCursor_t* cursor,
+    gmosBuffer_t* buffer, uint16_t offset)
+{
+    cursor->buffer = buffer;
+    cursor->segment = buffer->segmentList;
+    cursor->segmentOffset = 0;
+    cursor->position = 0;
+    gmosBufferCursorAdvance (cursor, buffer->bufferOffset);
+    cursor->position = 0;
+    return gmosBufferCursorSeek (cursor, offset);
+}
+
+/*
+ * Moves a data buffer cursor to the specified buffer offset.
+ */
+bool gmosBufferCursorSeek (gmosBufferCursor_t* cursor, uint16_t offset)
+{
+    if (offset > cursor->buffer->bufferSize) {
+        return false;
+    }
+
+    // Restart from the beginning of the buffer when moving backwards.
+    if (offset < cursor->position) {
+        gmosBufferCursorInit (cursor, cursor->buffer, 0);
+    }
+    gmosBufferCursorAdvance (cursor, offset - cursor->position);
+    return true;
+}
+
+/*
+ * Gets the current position of a data buffer cursor.
+ */
+uint16_t gmosBufferCursorGetOffset (gmosBufferCursor_t* cursor)
+{
+    return cursor->position;
+}
+
+/*
+ * Gets the number of buffer data bytes remaining after the current
+ * cursor position.
+ */
+uint16_t gmosBufferCursorGetRemaining (gmosBufferCursor_t* cursor)
+{
+    return cursor->buffer->bufferSize - cursor->position;
+}
+
+/*
+ * Reads data from a buffer at the current cursor position, advancing
+ * the cursor position.
+ */
+bool gmosBufferCursorRead (gmosBufferCursor_t* cursor,
+    uint8_t* readData, uint16_t readSize)
+{
+    if (readSize > gmosBufferCursorGetRemaining (cursor)) {
+        return false;
+    }
+    gmosBufferCursorTransfer (cursor, readData, readSize, false);
+    return true;
+}
+
+/*
+ * Reads data from a buffer at the current cursor position, without
+ * changing the cursor position.
+ */
+bool gmosBufferCursorPeek (gmosBufferCursor_t* cursor,
+    uint8_t* readData, uint16_t readSize)
+{
+    gmosBufferCursor_t peekCursor = *cursor;
+    return gmosBufferCursorRead (&peekCursor, readData, readSize);
+}
+
+/*
+ * Writes data to a buffer at the current cursor position, advancing
+ * the cursor position.
+ */
+bool gmosBufferCursorWrite (gmosBufferCursor_t* cursor,
+    const uint8_t* writeData, uint16_t writeSize)
+{
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+    gmosMempoolSegment_t* segmentList = cursor->buffer->segmentList;
+#endif
+
+    if (writeSize > gmosBufferCursorGetRemaining (cursor)) {
+        return false;
+    }
+
+    // Make a private copy of any shared segments before writing. The
+    // cursor must be reinitialised if the segment list was changed.
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+    if ((writeSize > 0) && (!gmosBufferUnshare (cursor->buffer,
+        cursor->position + writeSize))) {
+        return false;
+    }
+    if (cursor->buffer->segmentList != segmentList) {
+        gmosBufferCursorInit (cursor, cursor->buffer, cursor->position);
+    }
+#endif
+    gmosBufferCursorTransfer (cursor, (uint8_t*) writeData,
+        writeSize, true);
+    return true;
+}
+
+/*
+ * Advances the position of a data buffer cursor by the specified
+ * number of bytes.
+ */
+bool gmosBufferCursorSkip (gmosBufferCursor_t* cursor,
+    uint16_t skipSize)
+{
+    if (skipSize > gmosBufferCursorGetRemaining (cursor)) {
+        return false;
+    }
+    gmosBufferCursorAdvance (cursor, skipSize);
+    return true;
+}
+
+/*
+ * Gets the span of contiguous buffer data that starts at the current
+ * cursor position, advancing the cursor position.
+ */
+bool gmosBufferCursorGetSpan (gmosBufferCursor_t* cursor,
+    uint16_t maxSize, gmosBufferSpan_t* span)
+{
+    gmosMempoolSegment_t* segment = cursor->segment;
+    uint_fast16_t segmentOffset = cursor->segmentOffset;
+    uint_fast16_t segmentSize;
+    uint_fast16_t spanSize;
+
+    // Limit the span size to the remaining buffer data.
+    spanSize = gmosBufferCursorGetRemaining (cursor);
+    if (spanSize > maxSize) {
+        spanSize = maxSize;
+    }
+    if (spanSize == 0) {
+        return false;
+    }
+
+    // The cursor may be at the end of a buffer segment, in which case
+    // the span starts with the next segment.
+    segmentSize = gmosMempoolGetSegmentSize (segment);
+    if (segmentOffset >= segmentSize) {
+        segment = segment->nextSegment;
+        segmentSize = gmosMempoolGetSegmentSize (segment);
+        segmentOffset = 0;
+    }
+    if (spanSize > segmentSize - segmentOffset) {
+        spanSize = segmentSize - segmentOffset;
+    }
+    span->data = segment->data.bytes + segmentOffset;
+    span->size = spanSize;
+
+    // Advance the cursor past the end of the span.
+    cursor->segment = segment;
+    cursor->segmentOffset = segmentOffset;
+    gmosBufferCursorAdvance (cursor, spanSize);
+    return true;
+}
+
+/*
+ * Populates a list of buffer spans that describe the location of the
+ * buffer data in the specified range.
+ */
+uint8_t gmosBufferGetSpans (gmosBuffer_t* buffer, uint16_t offset,
+    uint16_t size, gmosBufferSpan_t* spans, uint8_t maxSpans)
+{
+    gmosBufferCursor_t cursor;
+    gmosBufferSpan_t* span;
+    uint_fast8_t spanCount = 0;
+    uint_fast16_t remaining = size;
+
+    // Check for out of range requests.
+    if (((uint32_t) offset) + ((uint32_t) size) >
+        ((uint32_t) buffer->bufferSize)) {
+        return 0;
+    }
+
+    // Add spans until the end of the data range is reached.
+    gmosBufferCursorInit (&cursor, buffer, offset);
+    while (spanCount < maxSpans) {
+        span = &(spans [spanCount]);
+        if (!gmosBufferCursorGetSpan (&cursor, remaining, span)) {
+            break;
+        }
+        remaining -= span->size;
+        spanCount += 1;
+    }
+    return spanCount;
+}
+
+/*
+ * Reads an unsigned 8-bit value from a buffer at the current cursor
+ * position. Reads from within the current segment are handled directly.
+ */
+bool gmosBufferCursorReadU8 (gmosBufferCursor_t* cursor,
+    uint8_t* value)
+{
+    gmosMempoolSegment_t* segment = cursor->segment;
+
+    if ((cursor->position < cursor->buffer->bufferSize) &&
+        (cursor->segmentOffset < gmosMempoolGetSegmentSize (segment))) {
+        *value = segment->data.bytes [cursor->segmentOffset];
+        cursor->segmentOffset += 1;
+        cursor->position += 1;
+        return true;
+    }
+    return gmosBufferCursorRead (cursor, value, 1);
+}
+
+/*
+ * Reads an unsigned 16-bit value in big endian byte order from a
+ * buffer at the current cursor position.
+ */
+bool gmosBufferCursorReadU16Be (gmosBufferCursor_t* cursor,
+    uint16_t* value)
+{
+    uint8_t data [2];
+
+    if (!gmosBufferCursorRead (cursor, data, 2)) {
+        return false;
+    }
+    *value = ((uint16_t) data [0]) << 8;
+    *value |= (uint16_t) data [1];
+    return true;
+}
+
+/*
+ * Reads an unsigned 16-bit value in little endian byte order from a
+ * buffer at the current cursor position.
+ */
+bool gmosBufferCursorReadU16Le (gmosBufferCursor_t* cursor,
+    uint16_t* value)
+{
+    uint8_t data [2];
+
+    if (!gmosBufferCursorRead (cursor, data, 2)) {
+        return false;
+    }
+    *value = (uint16_t) data [0];
+    *value |= ((uint16_t) data [1]) << 8;
+    return true;
+}
+
+/*
+ * Reads an unsigned 32-bit value in big endian byte order from a
+ * buffer at the current cursor position.
+ */
+bool gmosBufferCursorReadU32Be (gmosBufferCursor_t* cursor,
+    uint32_t* value)
+{
+    uint8_t data [4];
+
+    if (!gmosBufferCursorRead (cursor, data, 4)) {
+        return false;
+    }
+    *value = ((uint32_t) data [0]) << 24;
+    *value |= ((uint32_t) data [1]) << 16;
+    *value |= ((uint32_t) data [2]) << 8;
+    *value |= (uint32_t) data [3];
+    return true;
+}
+
+/*
+ * Reads an unsigned 32-bit value in little endian byte order from a
+ * buffer at the current cursor position.
+ */
+bool gmosBufferCursorReadU32Le (gmosBufferCursor_t* cursor,
+    uint32_t* value)
+{
+    uint8_t data [4];
+
+    if (!gmosBufferCursorRead (cursor, data, 4)) {
+        return false;
+    }
+    *value = (uint32_t) data [0];
+    *value |= ((uint32_t) data [1]) << 8;
+    *value |= ((uint32_t) data [2]) << 16;
+    *value |= ((uint32_t) data [3]) << 24;
+    return true;
+}
+
+/*
+ * Writes an unsigned 8-bit value to a buffer at the current cursor
+ * position.
+ */
+bool gmosBufferCursorWriteU8 (gmosBufferCursor_t* cursor,
+    uint8_t value)
+{
+    return gmosBufferCursorWrite (cursor, &value, 1);
+}
+
+/*
+ * Writes an unsigned 16-bit value in big endian byte order to a buffer
+ * at the current cursor position.
+ */
+bool gmosBufferCursorWriteU16Be (gmosBufferCursor_t* cursor,
+    uint16_t value)
+{
+    uint8_t data [2];
+
+    data [0] = (uint8_t) (value >> 8);
+    data [1] = (uint8_t) value;
+    return gmosBufferCursorWrite (cursor, data, 2);
+}
+
+/*
+ * Writes an unsigned 16-bit value in little endian byte order to a
+ * buffer at the current cursor position.
+ */
+bool gmosBufferCursorWriteU16Le (gmosBufferCursor_t* cursor,
+    uint16_t value)
+{
+    uint8_t data [2];
+
+    data [0] = (uint8_t) value;
+    data [1] = (uint8_t) (value >> 8);
+    return gmosBufferCursorWrite (cursor, data, 2);
+}
+
+/*
+ * Writes an unsigned 32-bit value in big endian byte order to a buffer
+ * at the current cursor position.
+ */
+bool gmosBufferCursorWriteU32Be (gmosBufferCursor_t* cursor,
+    uint32_t value)
+{
+    uint8_t data [4];
+
+    data [0] = (uint8_t) (value >> 24);
+    data [1] = (uint8_t) (value >> 16);
+    data [2] = (uint8_t) (value >> 8);
+    data [3] = (uint8_t) value;
+    return gmosBufferCursorWrite (cursor, data, 4);
+}
+
+/*
+ * Writes an unsigned 32-bit value in little endian byte order to a
+ * buffer at the current cursor position.
+ */
+bool gmosBufferCursorWriteU32Le (gmosBufferCursor_t* cursor,
+    uint32_t value)
+{
+    uint8_t data [4];
+
+    data [0] = (uint8_t) value;
+    data [1] = (uint8_t) (value >> 8);
+    data [2] = (uint8_t) (value >> 16);
+    data [3] = (uint8_t) (value >> 24);
+    return gmosBufferCursorWrite (cursor, data, 4);
+}
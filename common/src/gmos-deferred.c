@@ -0,0 +1,155 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements the GubbinsMOS deferred call queues.
+ */
+
+#include "gmos-config.h"
+
+// Deferred call support is only compiled if configured. The deferred
+// call queue implementation is also used for passing calls between
+// processor cores.
+#if (GMOS_CONFIG_DEFERRED_CALL_QUEUES > 0) || \
+    (GMOS_CONFIG_SCHEDULER_CORES > 1)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gmos-platform.h"
+#include "gmos-deferred.h"
+
+// Check that the deferred call queue size is a power of two that can
+// be indexed using 8-bit counters.
+#if ((GMOS_CONFIG_DEFERRED_CALL_QUEUE_SIZE & \
+    (GMOS_CONFIG_DEFERRED_CALL_QUEUE_SIZE - 1)) != 0) || \
+    (GMOS_CONFIG_DEFERRED_CALL_QUEUE_SIZE > 128)
+#error "The deferred call queue size must be a power of two up to 128."
+#endif
+
+// Specifies the bit mask used to derive ring buffer indices.
+#define DEFERRED_QUEUE_MASK (GMOS_CONFIG_DEFERRED_CALL_QUEUE_SIZE - 1)
+
+// Specifies the set of deferred call queues.
+#if (GMOS_CONFIG_DEFERRED_CALL_QUEUES > 0)
+static gmosDeferredCallQueue_t deferredCallQueues
+    [GMOS_CONFIG_DEFERRED_CALL_QUEUES];
+#endif
+
+/*
+ * Posts a deferred call to the specified deferred call queue instance.
+ */
+bool gmosDeferredCallQueuePost (gmosDeferredCallQueue_t* queue,
+    gmosDeferredCallFn_t callFn, void* callData)
+{
+    gmosDeferredCall_t* call;
+    uint8_t writeCount;
+
+    // Check for a full queue.
+    writeCount = queue->writeCount;
+    if (((uint8_t) (writeCount - queue->readCount)) >=
+        GMOS_CONFIG_DEFERRED_CALL_QUEUE_SIZE) {
+        return false;
+    }
+
+    // Write the queue entry before making it visible to the consumer.
+    call = &(queue->calls [writeCount & DEFERRED_QUEUE_MASK]);
+    call->callFn = callFn;
+    call->callData = callData;
+    __sync_synchronize ();
+    queue->writeCount = writeCount + 1;
+    return true;
+}
+
+/*
+ * Runs all the deferred calls that are currently held in the specified
+ * deferred call queue instance. Calls that are posted while the queue
+ * is being processed may also be run.
+ */
+bool gmosDeferredCallQueueProcess (gmosDeferredCallQueue_t* queue)
+{
+    gmosDeferredCall_t* call;
+    gmosDeferredCallFn_t callFn;
+    void* callData;
+    uint8_t readCount;
+    bool callsRun = false;
+
+    readCount = queue->readCount;
+    while (readCount != queue->writeCount) {
+
+        // Copy the queue entry before releasing it to the producer.
+        __sync_synchronize ();
+        call = &(queue->calls [readCount & DEFERRED_QUEUE_MASK]);
+        callFn = call->callFn;
+        callData = call->callData;
+        __sync_synchronize ();
+        readCount += 1;
+        queue->readCount = readCount;
+
+        // Run the deferred call handler.
+        callFn (callData);
+        callsRun = true;
+    }
+    return callsRun;
+}
+
+/*
+ * Posts a deferred call to the specified deferred call queue.
+ */
+#if (GMOS_CONFIG_DEFERRED_CALL_QUEUES > 0)
+bool gmosDeferredCallPost (uint8_t queueId,
+    gmosDeferredCallFn_t callFn, void* callData)
+{
+    GMOS_ASSERT (ASSERT_FAILURE,
+        queueId < GMOS_CONFIG_DEFERRED_CALL_QUEUES,
+        "Invalid deferred call queue.");
+
+    // Queue the call and wake the scheduler if required.
+    if (gmosDeferredCallQueuePost (
+        &(deferredCallQueues [queueId]), callFn, callData)) {
+        gmosPalWake ();
+        return true;
+    } else {
+        return false;
+    }
+}
+#endif
+
+/*
+ * Runs all the deferred calls that are currently held in the deferred
+ * call queues, in priority order.
+ */
+#if (GMOS_CONFIG_DEFERRED_CALL_QUEUES > 0)
+bool gmosDeferredCallProcess (void)
+{
+    uint_fast8_t queueId;
+    bool callsRun = false;
+
+    for (queueId = 0;
+        queueId < GMOS_CONFIG_DEFERRED_CALL_QUEUES; queueId++) {
+        if (gmosDeferredCallQueueProcess (
+            &(deferredCallQueues [queueId]))) {
+            callsRun = true;
+        }
+    }
+    return callsRun;
+}
+#endif
+
+#endif // GMOS_CONFIG_DEFERRED_CALL_QUEUES
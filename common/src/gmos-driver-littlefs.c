@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2025 Zynaptic Limited
+ * Copyright 2025-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -33,6 +33,7 @@
 
 #include "gmos-platform.h"
 #include "gmos-scheduler.h"
+#include "gmos-events.h"
 #include "gmos-driver-littlefs.h"
 
 // Implement LittleFS tracing to log verbose debug messages.
@@ -104,6 +105,25 @@ typedef enum {
     GMOS_DRIVER_LITTLEFS_STATE_FAILED
 } gmosDriverLittlefsState_t;
 
+/*
+ * Waits until the current flash memory transaction is complete. This
+ * waits on the flash memory completion event, so that the device may
+ * enter its low power state while the transaction is in progress. The
+ * completion status is rechecked at least once per second.
+ */
+static gmosDriverFlashStatus_t gmosDriverLittlefsWaitComplete (
+    gmosDriverFlash_t* flash, uint16_t* transferSize)
+{
+    gmosDriverFlashStatus_t flashStatus;
+
+    do {
+        gmosEventBusyWait (&(flash->completionEvent),
+            0xFFFFFFFF, GMOS_MS_TO_TICKS (1000));
+        flashStatus = gmosDriverFlashComplete (flash, transferSize);
+    } while (flashStatus == GMOS_DRIVER_FLASH_STATUS_ACTIVE);
+    return flashStatus;
+}
+
 /*
  * Implement the LittleFS flash memory reader function.
  */
@@ -126,10 +146,7 @@ static int gmosDriverLittlefsRead (const struct lfs_config* lfsConfig,
     }
 
     // Wait until the flash memory transaction is complete.
-    do {
-        gmosSchedulerTaskBusyWait ();
-        flashStatus = gmosDriverFlashComplete (flash, &readSize);
-    } while (flashStatus == GMOS_DRIVER_FLASH_STATUS_ACTIVE);
+    flashStatus = gmosDriverLittlefsWaitComplete (flash, &readSize);
 
     // Indicate successful completion or an I/O error.
     if (flashStatus == GMOS_DRIVER_FLASH_STATUS_SUCCESS) {
@@ -169,10 +186,7 @@ static int gmosDriverLittlefsWrite (const struct lfs_config* lfsConfig,
     }
 
     // Wait until the flash memory transaction is complete.
-    do {
-        gmosSchedulerTaskBusyWait ();
-        flashStatus = gmosDriverFlashComplete (flash, &writeSize);
-    } while (flashStatus == GMOS_DRIVER_FLASH_STATUS_ACTIVE);
+    flashStatus = gmosDriverLittlefsWaitComplete (flash, &writeSize);
 
     // Indicate successful completion or an I/O error.
     if (flashStatus == GMOS_DRIVER_FLASH_STATUS_SUCCESS) {
@@ -213,10 +227,7 @@ static int gmosDriverLittlefsErase (const struct lfs_config* lfsConfig,
     }
 
     // Wait until the flash memory transaction is complete.
-    do {
-        gmosSchedulerTaskBusyWait ();
-        flashStatus = gmosDriverFlashComplete (flash, NULL);
-    } while (flashStatus == GMOS_DRIVER_FLASH_STATUS_ACTIVE);
+    flashStatus = gmosDriverLittlefsWaitComplete (flash, NULL);
 
     // Indicate successful completion or an I/O error.
     if (flashStatus == GMOS_DRIVER_FLASH_STATUS_SUCCESS) {
@@ -363,7 +374,8 @@ static inline gmosTaskStatus_t gmosDriverLittlefsTaskFn (
 
         // In the mounted state wait until it is time for the scheduled
         // garbage collection. This is skipped if the flash memory is
-        // currently in read only mode.
+        // currently in read only mode. When garbage collection is due,
+        // the task is suspended until it is resumed by the idle worker.
         case GMOS_DRIVER_LITTLEFS_STATE_MOUNTED :
             delay = (int32_t)
                 (littlefs->lfsGcTimestamp - gmosPalGetTimer ());
@@ -374,7 +386,8 @@ static inline gmosTaskStatus_t gmosDriverLittlefsTaskFn (
             } else if (delay > 0) {
                 taskStatus = GMOS_TASK_RUN_LATER ((uint32_t) delay);
             } else if (littlefs->flashDevice->writeEnable) {
-                nextState = GMOS_DRIVER_LITTLEFS_STATE_RUNNING_GC;
+                gmosSchedulerIdleWorkerRequest (&(littlefs->lfsGcWorker));
+                taskStatus = GMOS_TASK_SUSPEND;
             } else {
                 littlefs->lfsGcTimestamp += GMOS_MS_TO_TICKS (
                     1000 * (uint32_t) (littlefs->lfsGcInterval));
@@ -410,6 +423,29 @@ static inline gmosTaskStatus_t gmosDriverLittlefsTaskFn (
 GMOS_TASK_DEFINITION (gmosDriverLittlefsTask,
     gmosDriverLittlefsTaskFn, gmosDriverLittlefs_t);
 
+/*
+ * Implement the garbage collection idle worker. This resumes the main
+ * task to run garbage collection if it is due, so that the busy waits
+ * used for flash memory access are still run in the task context.
+ */
+static bool gmosDriverLittlefsGcWorkerFn (
+    void* workerData, uint32_t budget)
+{
+    gmosDriverLittlefs_t* littlefs = (gmosDriverLittlefs_t*) workerData;
+    int32_t delay;
+    (void) budget;
+
+    if (littlefs->lfsState == GMOS_DRIVER_LITTLEFS_STATE_MOUNTED) {
+        delay = (int32_t)
+            (littlefs->lfsGcTimestamp - gmosPalGetTimer ());
+        if ((delay <= 0) && (littlefs->flashDevice->writeEnable)) {
+            littlefs->lfsState = GMOS_DRIVER_LITTLEFS_STATE_RUNNING_GC;
+            gmosSchedulerTaskResume (&(littlefs->lfsTask));
+        }
+    }
+    return false;
+}
+
 /*
  * Initialises a LittleFS file system driver on startup. This should be
  * called for each file system prior to accessing it via any of the
@@ -456,6 +492,10 @@ bool gmosDriverLittlefsInit (gmosDriverLittlefs_t* littlefs,
     // Initialise the state machine task.
     gmosDriverLittlefsTask_start (&(littlefs->lfsTask), littlefs,
         GMOS_TASK_NAME_WRAPPER ("LittleFS Driver Task"));
+
+    // Add the idle worker that is used to start garbage collection.
+    gmosSchedulerIdleWorkerAdd (&(littlefs->lfsGcWorker),
+        gmosDriverLittlefsGcWorkerFn, littlefs);
     return true;
 }
 
@@ -587,12 +627,9 @@ int gmosDriverLittlefsWriteEnable (gmosDriverLittlefs_t* littlefs,
         lfsStatus = LFS_ERR_AGAIN;
     }
 
-    // Implement busy waiting on the transaction request.
+    // Wait for completion of the transaction request.
     else {
-        do {
-            gmosSchedulerTaskBusyWait ();
-            flashStatus = gmosDriverFlashComplete (flash, NULL);
-        } while (flashStatus == GMOS_DRIVER_FLASH_STATUS_ACTIVE);
+        flashStatus = gmosDriverLittlefsWaitComplete (flash, NULL);
         if (flashStatus == GMOS_DRIVER_FLASH_STATUS_SUCCESS) {
             lfsStatus = LFS_ERR_OK;
         } else {
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2023 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,6 +28,7 @@
 #include "gmos-scheduler.h"
 #include "gmos-driver-spi.h"
 #include "gmos-driver-gpio.h"
+#include "gmos-profile.h"
 
 // Sets the drive strength for the SPI chip select lines if not defined
 // in the platform configuration header.
@@ -161,14 +162,18 @@ bool gmosDriverSpiIoWrite (gmosDriverSpiBus_t* spiInterface,
     uint8_t* writeData, uint16_t writeSize)
 {
     bool writeOk = false;
+    GMOS_PROFILE_BEGIN (GMOS_PROFILE_ID_SPI_TRANSACTION);
     if (spiInterface->busState == GMOS_DRIVER_SPI_BUS_SELECTED) {
         spiInterface->busState = GMOS_DRIVER_SPI_BUS_ACTIVE;
         spiInterface->writeData = writeData;
         spiInterface->readData = NULL;
         spiInterface->transferSize = writeSize;
+        spiInterface->spanCount = 0;
+        spiInterface->spanTransferSize = 0;
         gmosDriverSpiPalTransaction (spiInterface);
         writeOk = true;
     }
+    GMOS_PROFILE_END (GMOS_PROFILE_ID_SPI_TRANSACTION);
     return writeOk;
 }
 
@@ -180,14 +185,18 @@ bool gmosDriverSpiIoRead (gmosDriverSpiBus_t* spiInterface,
     uint8_t* readData, uint16_t readSize)
 {
     bool readOk = false;
+    GMOS_PROFILE_BEGIN (GMOS_PROFILE_ID_SPI_TRANSACTION);
     if (spiInterface->busState == GMOS_DRIVER_SPI_BUS_SELECTED) {
         spiInterface->busState = GMOS_DRIVER_SPI_BUS_ACTIVE;
         spiInterface->writeData = NULL;
         spiInterface->readData = readData;
         spiInterface->transferSize = readSize;
+        spiInterface->spanCount = 0;
+        spiInterface->spanTransferSize = 0;
         gmosDriverSpiPalTransaction (spiInterface);
         readOk = true;
     }
+    GMOS_PROFILE_END (GMOS_PROFILE_ID_SPI_TRANSACTION);
     return readOk;
 }
 
@@ -199,17 +208,125 @@ bool gmosDriverSpiIoTransfer (gmosDriverSpiBus_t* spiInterface,
     uint8_t* writeData, uint8_t* readData, uint16_t transferSize)
 {
     bool transferOk = false;
+    GMOS_PROFILE_BEGIN (GMOS_PROFILE_ID_SPI_TRANSACTION);
     if (spiInterface->busState == GMOS_DRIVER_SPI_BUS_SELECTED) {
         spiInterface->busState = GMOS_DRIVER_SPI_BUS_ACTIVE;
         spiInterface->writeData = writeData;
         spiInterface->readData = readData;
         spiInterface->transferSize = transferSize;
+        spiInterface->spanCount = 0;
+        spiInterface->spanTransferSize = 0;
         gmosDriverSpiPalTransaction (spiInterface);
         transferOk = true;
     }
+    GMOS_PROFILE_END (GMOS_PROFILE_ID_SPI_TRANSACTION);
     return transferOk;
 }
 
+/*
+ * Starts the SPI transfer for the next buffer span in a chained SPI
+ * transaction, using the same transfer direction as the previous span.
+ */
+static void gmosDriverSpiIoNextSpan (gmosDriverSpiBus_t* spiInterface)
+{
+    gmosBufferSpan_t* span = spiInterface->spanList;
+
+    if (spiInterface->writeData != NULL) {
+        spiInterface->writeData = span->data;
+    } else {
+        spiInterface->readData = span->data;
+    }
+    spiInterface->transferSize = span->size;
+    spiInterface->spanList = span + 1;
+    spiInterface->spanCount -= 1;
+    gmosDriverSpiPalTransaction (spiInterface);
+}
+
+/*
+ * Initiates a chained SPI write request for a device peripheral
+ * connected to the SPI interface, using a list of buffer spans as the
+ * data source.
+ */
+bool gmosDriverSpiIoWriteSpans (gmosDriverSpiBus_t* spiInterface,
+    gmosBufferSpan_t* writeSpans, uint8_t spanCount)
+{
+    bool writeOk = false;
+    GMOS_PROFILE_BEGIN (GMOS_PROFILE_ID_SPI_TRANSACTION);
+    if ((spiInterface->busState == GMOS_DRIVER_SPI_BUS_SELECTED) &&
+        (spanCount > 0)) {
+        spiInterface->busState = GMOS_DRIVER_SPI_BUS_ACTIVE;
+        spiInterface->writeData = writeSpans->data;
+        spiInterface->readData = NULL;
+        spiInterface->spanList = writeSpans;
+        spiInterface->spanCount = spanCount;
+        spiInterface->spanTransferSize = 0;
+        gmosDriverSpiIoNextSpan (spiInterface);
+        writeOk = true;
+    }
+    GMOS_PROFILE_END (GMOS_PROFILE_ID_SPI_TRANSACTION);
+    return writeOk;
+}
+
+/*
+ * Initiates a chained SPI read request for a device peripheral
+ * connected to the SPI interface, using a list of buffer spans as the
+ * data destination.
+ */
+bool gmosDriverSpiIoReadSpans (gmosDriverSpiBus_t* spiInterface,
+    gmosBufferSpan_t* readSpans, uint8_t spanCount)
+{
+    bool readOk = false;
+    GMOS_PROFILE_BEGIN (GMOS_PROFILE_ID_SPI_TRANSACTION);
+    if ((spiInterface->busState == GMOS_DRIVER_SPI_BUS_SELECTED) &&
+        (spanCount > 0)) {
+        spiInterface->busState = GMOS_DRIVER_SPI_BUS_ACTIVE;
+        spiInterface->writeData = NULL;
+        spiInterface->readData = readSpans->data;
+        spiInterface->spanList = readSpans;
+        spiInterface->spanCount = spanCount;
+        spiInterface->spanTransferSize = 0;
+        gmosDriverSpiIoNextSpan (spiInterface);
+        readOk = true;
+    }
+    GMOS_PROFILE_END (GMOS_PROFILE_ID_SPI_TRANSACTION);
+    return readOk;
+}
+
+/*
+ * Signals the completion of a platform specific SPI transfer. This is
+ * called by the platform abstraction layer from the transfer completion
+ * interrupt or callback. For chained transactions, the next buffer span
+ * is started directly from the completion handler, so the client task
+ * is only notified once all the buffer spans have been transferred.
+ */
+void gmosDriverSpiIoNotifyComplete (gmosDriverSpiBus_t* spiInterface,
+    uint32_t eventFlags)
+{
+    uint32_t spiStatus = eventFlags & GMOS_DRIVER_SPI_EVENT_STATUS_MASK;
+    uint32_t transferSize;
+
+    // Accumulate the total transfer size for chained transactions.
+    transferSize = spiInterface->spanTransferSize +
+        ((eventFlags & GMOS_DRIVER_SPI_EVENT_SIZE_MASK) >>
+        GMOS_DRIVER_SPI_EVENT_SIZE_OFFSET);
+    spiInterface->spanTransferSize = (uint16_t) transferSize;
+
+    // Start the transfer for the next buffer span in a chained
+    // transaction without deasserting the chip select.
+    if ((spiStatus == GMOS_DRIVER_SPI_STATUS_SUCCESS) &&
+        (spiInterface->spanCount > 0)) {
+        gmosDriverSpiIoNextSpan (spiInterface);
+        return;
+    }
+
+    // Notify the client task, using the total transfer size.
+    eventFlags &= ~GMOS_DRIVER_SPI_EVENT_SIZE_MASK;
+    eventFlags |= GMOS_DRIVER_SPI_EVENT_SIZE_MASK &
+        (transferSize << GMOS_DRIVER_SPI_EVENT_SIZE_OFFSET);
+    gmosEventSetBits (
+        &(spiInterface->device->completionEvent), eventFlags);
+}
+
 /*
  * Completes an asynchronous SPI transaction for a device peripheral
  * connected to the SPI interface.
@@ -252,12 +369,14 @@ gmosDriverSpiStatus_t gmosDriverSpiIoInlineWrite
     uint16_t writeSize)
 {
     gmosDriverSpiStatus_t spiStatus = GMOS_DRIVER_SPI_STATUS_NOT_READY;
+    GMOS_PROFILE_BEGIN (GMOS_PROFILE_ID_SPI_INLINE_TRANSACTION);
     if (spiInterface->busState == GMOS_DRIVER_SPI_BUS_SELECTED) {
         spiInterface->writeData = writeData;
         spiInterface->readData = NULL;
         spiInterface->transferSize = writeSize;
         spiStatus = gmosDriverSpiPalInlineTransaction (spiInterface);
     }
+    GMOS_PROFILE_END (GMOS_PROFILE_ID_SPI_INLINE_TRANSACTION);
     return spiStatus;
 }
 
@@ -271,12 +390,14 @@ gmosDriverSpiStatus_t gmosDriverSpiIoInlineRead
     uint16_t readSize)
 {
     gmosDriverSpiStatus_t spiStatus = GMOS_DRIVER_SPI_STATUS_NOT_READY;
+    GMOS_PROFILE_BEGIN (GMOS_PROFILE_ID_SPI_INLINE_TRANSACTION);
     if (spiInterface->busState == GMOS_DRIVER_SPI_BUS_SELECTED) {
         spiInterface->writeData = NULL;
         spiInterface->readData = readData;
         spiInterface->transferSize = readSize;
         spiStatus = gmosDriverSpiPalInlineTransaction (spiInterface);
     }
+    GMOS_PROFILE_END (GMOS_PROFILE_ID_SPI_INLINE_TRANSACTION);
     return spiStatus;
 }
 
@@ -291,11 +412,13 @@ gmosDriverSpiStatus_t gmosDriverSpiIoInlineTransfer
     uint8_t* readData, uint16_t transferSize)
 {
     gmosDriverSpiStatus_t spiStatus = GMOS_DRIVER_SPI_STATUS_NOT_READY;
+    GMOS_PROFILE_BEGIN (GMOS_PROFILE_ID_SPI_INLINE_TRANSACTION);
     if (spiInterface->busState == GMOS_DRIVER_SPI_BUS_SELECTED) {
         spiInterface->writeData = writeData;
         spiInterface->readData = readData;
         spiInterface->transferSize = transferSize;
         spiStatus = gmosDriverSpiPalInlineTransaction (spiInterface);
     }
+    GMOS_PROFILE_END (GMOS_PROFILE_ID_SPI_INLINE_TRANSACTION);
     return spiStatus;
 }
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2024 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,21 +25,37 @@
 
 #include "gmos-platform.h"
 #include "gmos-events.h"
+#include "gmos-trace.h"
+#include "gmos-instance.h"
 
-// Specifies the head of the pending event queue.
-static gmosEvent_t* pendingEvents = NULL;
-
-// Specifies a volatile flag that can be used to avoid disabling
-// interrupts to check for queued events.
-static volatile bool pendingEventsReady = false;
+// Specifies the event queue state. This is either allocated statically
+// or selected from the current GubbinsMOS instance.
+#if GMOS_CONFIG_INSTANCE_SUPPORT
+#define eventState (GMOS_INSTANCE_CURRENT->eventQueueState)
+#else
+static gmosEventQueueState_t eventState;
+#endif
 
 /*
  * Appends an event to the end of the pending event queue if not already
- * present in the queue.
+ * present in the queue. This is always called with interrupts disabled,
+ * so it uses the queued event flag and the queue end pointer to ensure
+ * that the time spent in the critical section is constant and does not
+ * depend on the number of pending events. When instance support is
+ * enabled, the event is appended to the pending event queue for the
+ * instance that runs the consumer task. Consumer tasks that have not
+ * yet been started are assumed to run on the current instance.
  */
 static void gmosEventAppendToQueue (gmosEvent_t* event)
 {
-    gmosEvent_t** nextEventPtr;
+    gmosEventQueueState_t* queueState;
+#if GMOS_CONFIG_INSTANCE_SUPPORT
+    gmosInstance_t* taskInstance;
+#endif
+
+    // Record the updated event bits in the trace buffer. The platform
+    // mutex is already held by the caller.
+    GMOS_TRACE_LOCKED (GMOS_TRACE_EVENT_SET, event, event->eventBits);
 
     // Only append the event to the event queue if it has an associated
     // consumer task.
@@ -47,23 +63,37 @@ static void gmosEventAppendToQueue (gmosEvent_t* event)
         return;
     }
 
-    // Loop until the end of the queue, exiting if the queue already
-    // contains the event.
-    nextEventPtr = &pendingEvents;
-    while (*nextEventPtr != NULL) {
-        if (*nextEventPtr == event) {
-            return;
-        }
-        nextEventPtr = &((*nextEventPtr)->nextEvent);
+    // Exit if the queue already contains the event.
+    if (event->eventQueued) {
+        return;
     }
 
+    // Select the pending event queue for the consumer task.
+#if GMOS_CONFIG_INSTANCE_SUPPORT
+    taskInstance = event->consumerTask->taskInstance;
+    queueState = (taskInstance != NULL) ?
+        &(taskInstance->eventQueueState) : &eventState;
+#else
+    queueState = &eventState;
+#endif
+
     // Append the event to the end of the queue.
     event->nextEvent = NULL;
-    *nextEventPtr = event;
-    pendingEventsReady = true;
+    event->eventQueued = true;
+    if (queueState->pendingEvents == NULL) {
+        queueState->pendingEvents = event;
+    } else {
+        queueState->pendingEventsEnd->nextEvent = event;
+    }
+    queueState->pendingEventsEnd = event;
+    queueState->pendingEventsReady = true;
 
     // Wake the scheduler if required.
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+    gmosPalCoreWake (event->consumerTask->taskCore);
+#else
     gmosPalWake ();
+#endif
 }
 
 /*
@@ -76,6 +106,8 @@ void gmosEventInit (gmosEvent_t* event, gmosTaskState_t* consumerTask)
     event->consumerTask = consumerTask;
     event->nextEvent = NULL;
     event->eventBits = 0;
+    event->waitDeadline = 0;
+    event->eventQueued = false;
 }
 
 /*
@@ -210,30 +242,123 @@ uint32_t gmosEventResetBits (gmosEvent_t* event)
     return eventBits;
 }
 
+/*
+ * Determines the remaining time for an event wait. This will be zero
+ * if any of the selected event bits are set or the wait deadline has
+ * been reached.
+ */
+static uint32_t gmosEventWaitRemaining (
+    gmosEvent_t* event, uint32_t bitMask)
+{
+    int32_t waitTime;
+
+    if (gmosEventTestAnyBits (event, bitMask)) {
+        return 0;
+    }
+    waitTime = (int32_t) (event->waitDeadline - gmosPalGetTimer ());
+    return (waitTime < 0) ? 0 : (uint32_t) waitTime;
+}
+
+/*
+ * Starts waiting for one or more event bits to be set, with the
+ * specified timeout.
+ */
+void gmosEventWaitStart (gmosEvent_t* event, uint32_t timeout)
+{
+    event->waitDeadline = gmosPalGetTimer () + timeout;
+}
+
+/*
+ * Checks whether an event wait is still pending. The consumer task is
+ * placed in the scheduled task queue until the wait deadline, and will
+ * be removed from it early if the event bits are modified.
+ */
+bool gmosEventWaitPending (gmosEvent_t* event, uint32_t bitMask,
+    gmosTaskStatus_t* taskStatus)
+{
+    uint32_t waitTime = gmosEventWaitRemaining (event, bitMask);
+
+    if (waitTime == 0) {
+        return false;
+    }
+    *taskStatus = GMOS_TASK_RUN_LATER (waitTime);
+    return true;
+}
+
+/*
+ * Waits for one or more event bits to be set, with the specified
+ * timeout. The scheduler idle function is called directly if no other
+ * tasks are ready to run. Events that have no consumer task would not
+ * wake the device from the idle state, so the busy waiting task is
+ * used as a temporary consumer for the duration of the wait.
+ */
+bool gmosEventBusyWait (gmosEvent_t* event, uint32_t bitMask,
+    uint32_t timeout)
+{
+    uint32_t waitTime;
+    uint32_t execDelay;
+    bool tempConsumer = false;
+
+    // Register the current task as a temporary consumer if required.
+    gmosPalMutexLock ();
+    if (event->consumerTask == NULL) {
+        event->consumerTask = gmosSchedulerCurrentTask ();
+        tempConsumer = true;
+    }
+    gmosPalMutexUnlock ();
+
+    // Run nested scheduler steps until the wait completes.
+    gmosEventWaitStart (event, timeout);
+    waitTime = gmosEventWaitRemaining (event, bitMask);
+    while (waitTime > 0) {
+        execDelay = gmosSchedulerTaskBusyWait ();
+        if (execDelay > 0) {
+            gmosSchedulerTaskBusyIdle (
+                (execDelay < waitTime) ? execDelay : waitTime);
+        }
+        waitTime = gmosEventWaitRemaining (event, bitMask);
+    }
+
+    // Remove the temporary consumer. If the event is still in the
+    // pending event queue it will subsequently be discarded.
+    if (tempConsumer) {
+        gmosPalMutexLock ();
+        event->consumerTask = NULL;
+        gmosPalMutexUnlock ();
+    }
+    return gmosEventTestAnyBits (event, bitMask);
+}
+
 /*
  * If one or more events have occurred, this function will return the
  * associated consumer tasks in the order in which the events occured.
+ * Queued events for which a temporary busy wait consumer has since been
+ * removed are discarded.
  */
 gmosTaskState_t* gmosEventGetNextConsumer (void)
 {
-    gmosEvent_t* event = NULL;
+    gmosEvent_t* event;
+    gmosTaskState_t* consumerTask = NULL;
 
     // Avoid queue processing if there are no pending events.
-    if (!pendingEventsReady) {
+    if (!eventState.pendingEventsReady) {
         return NULL;
     }
 
     // Pop the next event from the queue with interrupts disabled.
     gmosPalMutexLock ();
-    if (pendingEvents != NULL) {
-        event = pendingEvents;
-        pendingEvents = event->nextEvent;
+    while ((consumerTask == NULL) && (eventState.pendingEvents != NULL)) {
+        event = eventState.pendingEvents;
+        eventState.pendingEvents = event->nextEvent;
+        event->nextEvent = NULL;
+        event->eventQueued = false;
+        consumerTask = event->consumerTask;
     }
-    if (pendingEvents == NULL) {
-        pendingEventsReady = false;
+    if (eventState.pendingEvents == NULL) {
+        eventState.pendingEventsReady = false;
     }
     gmosPalMutexUnlock ();
 
     // Return the consumer task associated with the event.
-    return (event == NULL) ? NULL : event->consumerTask;
+    return consumerTask;
 }
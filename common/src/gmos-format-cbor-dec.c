@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2023-2024 Zynaptic Limited
+ * Copyright 2023-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -33,6 +33,7 @@
 #include "gmos-platform.h"
 #include "gmos-buffers.h"
 #include "gmos-format-cbor.h"
+#include "gmos-profile.h"
 
 /*
  * Provides a forward reference to the main token processing function.
@@ -572,6 +573,7 @@ bool gmosFormatCborParserScan (gmosFormatCborParser_t* parser,
     gmosBuffer_t* buffer, uint8_t maxScanDepth)
 {
     uint_fast16_t nextTokenOffset;
+    GMOS_PROFILE_BEGIN (GMOS_PROFILE_ID_CBOR_SCAN);
 
     // Reset parser state.
     gmosBufferInit (&(parser->messageBuffer));
@@ -581,6 +583,7 @@ bool gmosFormatCborParserScan (gmosFormatCborParser_t* parser,
     // Parse the first token in the message.
     nextTokenOffset = gmosFormatCborParserScanNextToken (
         parser, 0, maxScanDepth, NULL);
+    GMOS_PROFILE_END (GMOS_PROFILE_ID_CBOR_SCAN);
 
     // On completion there should be no further data in the message
     // buffer.
@@ -0,0 +1,160 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements support for multiple GubbinsMOS instances in a single
+ * host process or on multiple processor cores.
+ */
+
+#include "gmos-config.h"
+
+// Instance support is only compiled if configured.
+#if GMOS_CONFIG_INSTANCE_SUPPORT
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-mempool.h"
+#include "gmos-deferred.h"
+#include "gmos-power.h"
+#include "gmos-instance.h"
+
+// Specifies the currently selected GubbinsMOS instance for each core.
+gmosInstance_t* gmosInstanceCurrent [GMOS_CONFIG_SCHEDULER_CORES] =
+    { NULL };
+
+/*
+ * Initialises a GubbinsMOS instance and selects it as the current
+ * instance.
+ */
+void gmosInstanceInit (gmosInstance_t* instance, void* instanceData)
+{
+    memset (&(instance->schedulerState), 0,
+        sizeof (gmosSchedulerState_t));
+    memset (&(instance->eventQueueState), 0,
+        sizeof (gmosEventQueueState_t));
+    memset (&(instance->timerState), 0,
+        sizeof (gmosTimerState_t));
+#if GMOS_CONFIG_POWER_RESIDENCY
+    memset (&(instance->powerState), 0,
+        sizeof (gmosPowerState_t));
+#endif
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+    memset (instance->coreCallQueues, 0,
+        sizeof (instance->coreCallQueues));
+#endif
+    instance->instanceData = instanceData;
+
+    // Set the first profiling log time for the instance.
+#if GMOS_CONFIG_SCHEDULER_PROFILING && \
+    (GMOS_CONFIG_SCHEDULER_PROFILING_LOG_INTERVAL > 0)
+    instance->schedulerState.nextStatsLogTime = GMOS_MS_TO_TICKS (
+        1000 * GMOS_CONFIG_SCHEDULER_PROFILING_LOG_INTERVAL);
+#endif
+
+    // Select the instance and set up its memory pool. The instance
+    // state must be visible to other cores before it is selected. The
+    // shared memory pool for multiple cores is set up by the platform.
+    __sync_synchronize ();
+    gmosInstanceSelect (instance);
+#if (GMOS_CONFIG_SCHEDULER_CORES == 1)
+    gmosMempoolInit ();
+#endif
+}
+
+/*
+ * Selects a GubbinsMOS instance and performs a single scheduler step
+ * for it.
+ */
+uint32_t gmosInstanceStep (gmosInstance_t* instance)
+{
+    gmosInstanceSelect (instance);
+    return gmosSchedulerStep ();
+}
+
+/*
+ * Initialises a GubbinsMOS instance for a processor core and then runs
+ * the scheduler loop for that core.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+void gmosInstanceCoreStart (gmosInstance_t* instance)
+{
+    gmosInstanceInit (instance, NULL);
+    gmosAppCoreInit (GMOS_PAL_CORE_ID);
+    gmosSchedulerStart ();
+}
+#endif
+
+/*
+ * Posts a call to the scheduler running on the specified processor
+ * core.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+bool gmosInstanceCoreCallPost (uint8_t coreId,
+    gmosDeferredCallFn_t callFn, void* callData)
+{
+    gmosInstance_t* targetInstance;
+
+    // Check that the target core has been started.
+    if (coreId >= GMOS_CONFIG_SCHEDULER_CORES) {
+        return false;
+    }
+    targetInstance = gmosInstanceCurrent [coreId];
+    if (targetInstance == NULL) {
+        return false;
+    }
+    __sync_synchronize ();
+
+    // Each core posts to its own queue in the target instance, so that
+    // there is only ever a single producer for each queue.
+    if (gmosDeferredCallQueuePost (
+        &(targetInstance->coreCallQueues [GMOS_PAL_CORE_ID]),
+        callFn, callData)) {
+        gmosPalCoreWake (coreId);
+        return true;
+    } else {
+        return false;
+    }
+}
+#endif
+
+/*
+ * Runs all the calls that have been posted to the current processor
+ * core by other processor cores.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+bool gmosInstanceCoreCallProcess (void)
+{
+    gmosInstance_t* instance = GMOS_INSTANCE_CURRENT;
+    uint_fast8_t coreId;
+    bool callsRun = false;
+
+    for (coreId = 0; coreId < GMOS_CONFIG_SCHEDULER_CORES; coreId++) {
+        if (gmosDeferredCallQueueProcess (
+            &(instance->coreCallQueues [coreId]))) {
+            callsRun = true;
+        }
+    }
+    return callsRun;
+}
+#endif
+
+#endif // GMOS_CONFIG_INSTANCE_SUPPORT
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2023 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,28 +21,62 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <stddef.h>
 
 #include "gmos-config.h"
 #include "gmos-platform.h"
+#include "gmos-scheduler.h"
 #include "gmos-mempool.h"
+#include "gmos-instance.h"
 
-// Specify the lower free capacity threshold when dynamic memory
-// management is being used.
+// Specify the lower free capacity threshold. This is used to extend
+// the memory pool when dynamic memory management is being used and to
+// track low capacity periods when memory pool telemetry is enabled.
 #define FREE_SEGMENT_THRESHOLD (GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER / 4)
 
-// Statically allocate the memory pool area.
-#if (GMOS_CONFIG_MEMPOOL_USE_HEAP)
-static gmosMempoolSegment_t gmosMempool [0];
-#else
-static gmosMempoolSegment_t gmosMempool [GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER];
+// Check the large segment size configuration.
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+#if ((GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE % 4) != 0)
+#error "The large memory pool segment size must be a multiple of 4."
+#endif
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE <= \
+    GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE)
+#error "Large memory pool segments must exceed the standard size."
+#endif
 #endif
 
-// Specifies the head of the free segment list.
-static gmosMempoolSegment_t* gmosMempoolFreeList;
+// Shared segments are tracked using the segment storage index, which is
+// not available for segments allocated from the heap.
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS && GMOS_CONFIG_MEMPOOL_USE_HEAP
+#error "Shared memory pool segments are not supported with heap memory."
+#endif
 
-// Specifies the number of available free segments.
-static uint_fast16_t gmosMempoolFreeSegmentCount;
+// Memory pool telemetry records segment owner tags using the segment
+// storage index, which is not available for heap segments.
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY && GMOS_CONFIG_MEMPOOL_USE_HEAP
+#error "Memory pool telemetry is not supported with heap memory."
+#endif
+
+// Specifies the memory pool state. This is either allocated statically
+// or selected from the current GubbinsMOS instance. When multiple
+// scheduler cores are configured, a single memory pool is shared by
+// all cores so that segments may be passed between them.
+#if GMOS_CONFIG_INSTANCE_SUPPORT && (GMOS_CONFIG_SCHEDULER_CORES == 1)
+#define mempoolState (GMOS_INSTANCE_CURRENT->mempoolState)
+#else
+static gmosMempoolState_t mempoolState;
+#endif
+
+// The shared memory pool is protected by the platform mutex when
+// multiple scheduler cores are configured.
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+#define MEMPOOL_LOCK() gmosPalMutexLock ()
+#define MEMPOOL_UNLOCK() gmosPalMutexUnlock ()
+#else
+#define MEMPOOL_LOCK()
+#define MEMPOOL_UNLOCK()
+#endif
 
 /*
  * Initialises the memory pool. This should be called exactly once on
@@ -56,7 +90,7 @@ void gmosMempoolInit (void)
     gmosMempoolSegment_t* currentSegment;
 
     // Link the memory pool free segment list.
-    nextSegmentPtr = &gmosMempoolFreeList;
+    nextSegmentPtr = &mempoolState.freeList;
     for (i = 0; i < GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER; i++) {
         if (GMOS_CONFIG_MEMPOOL_USE_HEAP) {
             currentSegment = (gmosMempoolSegment_t*)
@@ -64,7 +98,7 @@ void gmosMempoolInit (void)
             GMOS_ASSERT (ASSERT_FAILURE, (currentSegment != NULL),
                 "Out of heap memory when creating memory pool.");
         } else {
-            currentSegment = &gmosMempool [i];
+            currentSegment = &mempoolState.segments [i];
         }
         *nextSegmentPtr = currentSegment;
         nextSegmentPtr = &(currentSegment->nextSegment);
@@ -72,9 +106,216 @@ void gmosMempoolInit (void)
 
     // Add null terminator to the list.
     *nextSegmentPtr = NULL;
-    gmosMempoolFreeSegmentCount = GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER;
+    mempoolState.freeSegmentCount = GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER;
+
+    // Link the large segment free list.
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    nextSegmentPtr = &mempoolState.largeFreeList;
+    for (i = 0; i < GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER; i++) {
+        currentSegment = (gmosMempoolSegment_t*)
+            &mempoolState.largeSegments [i];
+        *nextSegmentPtr = currentSegment;
+        nextSegmentPtr = &(currentSegment->nextSegment);
+    }
+    *nextSegmentPtr = NULL;
+    mempoolState.largeFreeSegmentCount =
+        GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER;
+#endif
+
+    // Clear the shared segment reference counts.
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+    for (i = 0; i < GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER; i++) {
+        mempoolState.segmentRefs [i] = 0;
+    }
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    for (i = 0; i < GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER; i++) {
+        mempoolState.largeSegmentRefs [i] = 0;
+    }
+#endif
+#endif
+
+    // Clear the memory pool telemetry statistics.
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+    mempoolState.stats = (gmosMempoolStats_t) { 0 };
+    mempoolState.lowCapacity = false;
+#endif
 }
 
+/*
+ * Determines whether a memory pool segment is a large segment by
+ * checking whether it is located in the large segment storage area.
+ */
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+static inline bool isLargeSegment (gmosMempoolSegment_t* segment)
+{
+    uintptr_t segmentAddr = (uintptr_t) segment;
+    uintptr_t storageStart = (uintptr_t)
+        &(mempoolState.largeSegments [0]);
+    uintptr_t storageEnd = (uintptr_t)
+        &(mempoolState.largeSegments [
+        GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER]);
+    return ((segmentAddr >= storageStart) &&
+        (segmentAddr < storageEnd)) ? true : false;
+}
+#endif
+
+/*
+ * Accesses the additional reference count for a shared memory pool
+ * segment, using the segment index in the appropriate storage area.
+ */
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+static inline uint16_t* getSegmentRefs (gmosMempoolSegment_t* segment)
+{
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    if (isLargeSegment (segment)) {
+        return &(mempoolState.largeSegmentRefs [
+            (gmosMempoolLargeSegment_t*) segment -
+            mempoolState.largeSegments]);
+    }
+#endif
+    return &(mempoolState.segmentRefs [
+        segment - mempoolState.segments]);
+}
+#endif
+
+/*
+ * Releases one of the additional references to a shared memory pool
+ * segment. This must be called with the memory pool lock held.
+ */
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+static inline bool releaseSharedSegment (gmosMempoolSegment_t* segment)
+{
+    uint16_t* segmentRefs = getSegmentRefs (segment);
+    if (*segmentRefs == 0) {
+        return false;
+    }
+    *segmentRefs -= 1;
+    return true;
+}
+#else
+#define releaseSharedSegment(segment) false
+#endif
+
+/*
+ * Accesses the owner tag for an allocated memory pool segment, using
+ * the segment index in the appropriate storage area.
+ */
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+static inline uint8_t* getSegmentOwner (gmosMempoolSegment_t* segment)
+{
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    if (isLargeSegment (segment)) {
+        return &(mempoolState.largeSegmentOwners [
+            (gmosMempoolLargeSegment_t*) segment -
+            mempoolState.largeSegments]);
+    }
+#endif
+    return &(mempoolState.segmentOwners [
+        segment - mempoolState.segments]);
+}
+#endif
+
+/*
+ * Records the allocation of a list of memory pool segments, using the
+ * owner tag for the current task. This must be called with the memory
+ * pool lock held.
+ */
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+static void recordSegmentAlloc (gmosMempoolSegment_t* segment)
+{
+    gmosMempoolStats_t* stats = &(mempoolState.stats);
+    gmosTaskState_t* currentTask = gmosSchedulerCurrentTask ();
+    uint8_t owner = (currentTask == NULL) ?
+        GMOS_MEMPOOL_OWNER_OTHER : currentTask->mempoolOwner;
+
+    while (segment != NULL) {
+        *getSegmentOwner (segment) = owner;
+        stats->ownerBytes [owner] +=
+            gmosMempoolGetSegmentSize (segment);
+        segment = segment->nextSegment;
+    }
+    if (stats->ownerPeakBytes [owner] < stats->ownerBytes [owner]) {
+        stats->ownerPeakBytes [owner] = stats->ownerBytes [owner];
+    }
+}
+#else
+#define recordSegmentAlloc(segment)
+#endif
+
+/*
+ * Records the release of a single memory pool segment, using the owner
+ * tag assigned on allocation. This must be called with the memory pool
+ * lock held.
+ */
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+static inline void recordSegmentFree (gmosMempoolSegment_t* segment)
+{
+    mempoolState.stats.ownerBytes [*getSegmentOwner (segment)] -=
+        gmosMempoolGetSegmentSize (segment);
+}
+#else
+#define recordSegmentFree(segment)
+#endif
+
+/*
+ * Records a failed memory pool allocation request. This must be called
+ * with the memory pool lock held.
+ */
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+static inline void recordAllocFailure (void)
+{
+    mempoolState.stats.allocFailCount += 1;
+}
+#else
+#define recordAllocFailure()
+#endif
+
+/*
+ * Updates the memory pool usage statistics after segments have been
+ * allocated or released. This must be called with the memory pool lock
+ * held.
+ */
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+static void recordPoolUsage (void)
+{
+    gmosMempoolStats_t* stats = &(mempoolState.stats);
+    bool lowCapacity;
+    uint32_t currentTime;
+
+    // Update the current and peak segment usage.
+    stats->segmentsInUse = GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER -
+        mempoolState.freeSegmentCount;
+    if (stats->peakSegmentsInUse < stats->segmentsInUse) {
+        stats->peakSegmentsInUse = stats->segmentsInUse;
+    }
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    stats->largeSegmentsInUse =
+        GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER -
+        mempoolState.largeFreeSegmentCount;
+    if (stats->peakLargeSegmentsInUse < stats->largeSegmentsInUse) {
+        stats->peakLargeSegmentsInUse = stats->largeSegmentsInUse;
+    }
+#endif
+
+    // Accumulate the time spent below the low capacity threshold.
+    lowCapacity = (mempoolState.freeSegmentCount <
+        FREE_SEGMENT_THRESHOLD) ? true : false;
+    if (lowCapacity != mempoolState.lowCapacity) {
+        currentTime = gmosPalGetTimer ();
+        if (lowCapacity) {
+            stats->lowCapacityCount += 1;
+        } else {
+            stats->lowCapacityTicks += (uint32_t)
+                (currentTime - mempoolState.lowCapacityTime);
+        }
+        mempoolState.lowCapacityTime = currentTime;
+        mempoolState.lowCapacity = lowCapacity;
+    }
+}
+#else
+#define recordPoolUsage()
+#endif
+
 /*
  * When dynamic memory mangement is being used, the memory pool can be
  * extended if the number of free segments falls below a set threshold.
@@ -85,15 +326,15 @@ static void checkLowerCapacityThreshold (void)
     gmosMempoolSegment_t* newSegment;
 
     // Loop until the lower threshold limit is restored.
-    while (gmosMempoolFreeSegmentCount < FREE_SEGMENT_THRESHOLD) {
+    while (mempoolState.freeSegmentCount < FREE_SEGMENT_THRESHOLD) {
         newSegment = (gmosMempoolSegment_t*)
             GMOS_MALLOC (sizeof (gmosMempoolSegment_t));
 
         // Append the new segment to the start of the free list.
         if (newSegment != NULL) {
-            newSegment->nextSegment = gmosMempoolFreeList;
-            gmosMempoolFreeList = newSegment;
-            gmosMempoolFreeSegmentCount += 1;
+            newSegment->nextSegment = mempoolState.freeList;
+            mempoolState.freeList = newSegment;
+            mempoolState.freeSegmentCount += 1;
         }
 
         // Leave the memory pool below the lower capacity threshold if
@@ -117,14 +358,14 @@ static void checkUpperCapacityThreshold (void)
     gmosMempoolSegment_t* oldSegment;
 
     // Loop until the upper threshold limit is restored.
-    while (gmosMempoolFreeSegmentCount >
+    while (mempoolState.freeSegmentCount >
         GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER) {
 
         // Remove the old segment from the start of the free list.
-        oldSegment = gmosMempoolFreeList;
-        gmosMempoolFreeList = oldSegment->nextSegment;
+        oldSegment = mempoolState.freeList;
+        mempoolState.freeList = oldSegment->nextSegment;
         GMOS_FREE (oldSegment);
-        gmosMempoolFreeSegmentCount -= 1;
+        mempoolState.freeSegmentCount -= 1;
     }
 }
 #else
@@ -137,21 +378,86 @@ static void checkUpperCapacityThreshold (void)
  */
 uint16_t gmosMempoolSegmentsAvailable (void)
 {
-    return gmosMempoolFreeSegmentCount;
+    return mempoolState.freeSegmentCount;
+}
+
+/*
+ * Determines the number of free large memory pool segments currently
+ * available for allocation.
+ */
+uint16_t gmosMempoolLargeSegmentsAvailable (void)
+{
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    return mempoolState.largeFreeSegmentCount;
+#else
+    return 0;
+#endif
+}
+
+/*
+ * Determines the data capacity of a memory pool segment.
+ */
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+uint16_t gmosMempoolGetSegmentSize (gmosMempoolSegment_t* segment)
+{
+    return isLargeSegment (segment) ?
+        GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE :
+        GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
+}
+#endif
+
+/*
+ * Adds a reference to a shared memory pool segment.
+ */
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+void gmosMempoolRetain (gmosMempoolSegment_t* segment)
+{
+    uint16_t* segmentRefs;
+
+    MEMPOOL_LOCK ();
+    segmentRefs = getSegmentRefs (segment);
+    GMOS_ASSERT (ASSERT_FAILURE, (*segmentRefs < UINT16_MAX),
+        "Memory pool segment reference count overflow.");
+    *segmentRefs += 1;
+    MEMPOOL_UNLOCK ();
 }
+#endif
+
+/*
+ * Determines whether a memory pool segment is currently shared.
+ */
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+bool gmosMempoolIsShared (gmosMempoolSegment_t* segment)
+{
+    bool isShared;
+
+    MEMPOOL_LOCK ();
+    isShared = (*getSegmentRefs (segment) != 0) ? true : false;
+    MEMPOOL_UNLOCK ();
+    return isShared;
+}
+#endif
 
 /*
  * Allocates a new memory pool segment from the memory pool.
  */
 gmosMempoolSegment_t* gmosMempoolAlloc (void)
 {
-    gmosMempoolSegment_t* segment = gmosMempoolFreeList;
+    gmosMempoolSegment_t* segment;
+
+    MEMPOOL_LOCK ();
+    segment = mempoolState.freeList;
     if (segment != NULL) {
-        gmosMempoolFreeList = segment->nextSegment;
+        mempoolState.freeList = segment->nextSegment;
         segment->nextSegment = NULL;
-        gmosMempoolFreeSegmentCount -= 1;
+        mempoolState.freeSegmentCount -= 1;
+        recordSegmentAlloc (segment);
+    } else {
+        recordAllocFailure ();
     }
     checkLowerCapacityThreshold ();
+    recordPoolUsage ();
+    MEMPOOL_UNLOCK ();
     return segment;
 }
 
@@ -160,12 +466,29 @@ gmosMempoolSegment_t* gmosMempoolAlloc (void)
  */
 void gmosMempoolFree (gmosMempoolSegment_t* freeSegment)
 {
+    MEMPOOL_LOCK ();
+    if ((freeSegment != NULL) && (releaseSharedSegment (freeSegment))) {
+        freeSegment = NULL;
+    }
     if (freeSegment != NULL) {
-        freeSegment->nextSegment = gmosMempoolFreeList;
-        gmosMempoolFreeList = freeSegment;
-        gmosMempoolFreeSegmentCount += 1;
+        recordSegmentFree (freeSegment);
+    }
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    if ((freeSegment != NULL) && (isLargeSegment (freeSegment))) {
+        freeSegment->nextSegment = mempoolState.largeFreeList;
+        mempoolState.largeFreeList = freeSegment;
+        mempoolState.largeFreeSegmentCount += 1;
+        freeSegment = NULL;
+    }
+#endif
+    if (freeSegment != NULL) {
+        freeSegment->nextSegment = mempoolState.freeList;
+        mempoolState.freeList = freeSegment;
+        mempoolState.freeSegmentCount += 1;
     }
     checkUpperCapacityThreshold ();
+    recordPoolUsage ();
+    MEMPOOL_UNLOCK ();
 }
 
 /*
@@ -180,40 +503,249 @@ gmosMempoolSegment_t* gmosMempoolAllocSegments (uint16_t segmentCount)
 
     // Remove the required number of segments from the free list and
     // null terminate the return list.
-    if (segmentCount <= gmosMempoolFreeSegmentCount) {
-        segment = gmosMempoolFreeList;
+    MEMPOOL_LOCK ();
+    if (segmentCount <= mempoolState.freeSegmentCount) {
+        segment = mempoolState.freeList;
         for (i = 1; i < segmentCount; i++) {
             segment = segment->nextSegment;
         }
-        result = gmosMempoolFreeList;
-        gmosMempoolFreeList = segment->nextSegment;
+        result = mempoolState.freeList;
+        mempoolState.freeList = segment->nextSegment;
         segment->nextSegment = NULL;
-        gmosMempoolFreeSegmentCount -= segmentCount;
+        mempoolState.freeSegmentCount -= segmentCount;
+        recordSegmentAlloc (result);
+    } else {
+        recordAllocFailure ();
     }
     checkLowerCapacityThreshold ();
+    recordPoolUsage ();
+    MEMPOOL_UNLOCK ();
     return result;
 }
 
 /*
- * Returns a number of memory pool segments to the memory pool.
+ * Allocates a linked list of memory pool segments with sufficient
+ * combined capacity to store the specified number of data bytes.
+ */
+gmosMempoolSegment_t* gmosMempoolAllocCapacity (uint16_t capacity)
+{
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    uint_fast16_t remaining = capacity;
+    uint_fast16_t largeCount = 0;
+    uint_fast16_t segmentCount;
+    uint_fast16_t i;
+    gmosMempoolSegment_t* segment;
+    gmosMempoolSegment_t* result = NULL;
+    gmosMempoolSegment_t** resultEndPtr = &result;
+
+    // Large segments are only selected if more than one standard
+    // segment would otherwise be required for the final part of the
+    // list, so the unused space never exceeds that of a standard
+    // segment list.
+    MEMPOOL_LOCK ();
+    while ((remaining > GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE -
+        GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) &&
+        (largeCount < mempoolState.largeFreeSegmentCount)) {
+        largeCount += 1;
+        if (remaining > GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE) {
+            remaining -= GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE;
+        } else {
+            remaining = 0;
+        }
+    }
+    segmentCount = (remaining == 0) ? 0 :
+        1 + ((remaining - 1) / GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE);
+
+    // Remove the required segments from the free lists, with the large
+    // segments placed at the start of the returned list.
+    if ((capacity > 0) &&
+        (segmentCount <= mempoolState.freeSegmentCount)) {
+        for (i = 0; i < largeCount; i++) {
+            segment = mempoolState.largeFreeList;
+            mempoolState.largeFreeList = segment->nextSegment;
+            *resultEndPtr = segment;
+            resultEndPtr = &(segment->nextSegment);
+        }
+        mempoolState.largeFreeSegmentCount -= largeCount;
+        for (i = 0; i < segmentCount; i++) {
+            segment = mempoolState.freeList;
+            mempoolState.freeList = segment->nextSegment;
+            *resultEndPtr = segment;
+            resultEndPtr = &(segment->nextSegment);
+        }
+        mempoolState.freeSegmentCount -= segmentCount;
+        *resultEndPtr = NULL;
+        recordSegmentAlloc (result);
+    } else if (capacity > 0) {
+        recordAllocFailure ();
+    }
+    checkLowerCapacityThreshold ();
+    recordPoolUsage ();
+    MEMPOOL_UNLOCK ();
+    return result;
+
+    // Only standard segments are available.
+#else
+    if (capacity == 0) {
+        return NULL;
+    }
+    return gmosMempoolAllocSegments (
+        1 + ((capacity - 1) / GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE));
+#endif
+}
+
+/*
+ * Returns a number of memory pool segments to the memory pool. When
+ * large segments are in use, each segment is returned to the
+ * appropriate free list in turn. The remainder of the list is retained
+ * if a shared segment is found.
  */
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
 void gmosMempoolFreeSegments (gmosMempoolSegment_t* freeSegments)
 {
-    uint_fast16_t segmentCount = 0;
     gmosMempoolSegment_t* segment;
 
-    // Count the number of free segments and return them to the free
-    // list.
-    if (freeSegments != NULL) {
-        segmentCount = 1;
+    MEMPOOL_LOCK ();
+    while ((freeSegments != NULL) &&
+        (!releaseSharedSegment (freeSegments))) {
         segment = freeSegments;
-        while (segment->nextSegment != NULL) {
-            segmentCount += 1;
-            segment = segment->nextSegment;
+        freeSegments = segment->nextSegment;
+        recordSegmentFree (segment);
+        if (isLargeSegment (segment)) {
+            segment->nextSegment = mempoolState.largeFreeList;
+            mempoolState.largeFreeList = segment;
+            mempoolState.largeFreeSegmentCount += 1;
+        } else {
+            segment->nextSegment = mempoolState.freeList;
+            mempoolState.freeList = segment;
+            mempoolState.freeSegmentCount += 1;
         }
-        segment->nextSegment = gmosMempoolFreeList;
-        gmosMempoolFreeList = freeSegments;
     }
-    gmosMempoolFreeSegmentCount += segmentCount;
     checkUpperCapacityThreshold ();
+    recordPoolUsage ();
+    MEMPOOL_UNLOCK ();
+}
+
+/*
+ * Returns a number of memory pool segments to the memory pool when
+ * only standard segments are in use.
+ */
+#else
+void gmosMempoolFreeSegments (gmosMempoolSegment_t* freeSegments)
+{
+    uint_fast16_t segmentCount = 0;
+    gmosMempoolSegment_t* segment = freeSegments;
+    gmosMempoolSegment_t* lastSegment = NULL;
+
+    // Count the number of free segments and return them to the free
+    // list. The remainder of the list is retained if a shared segment
+    // is found.
+    MEMPOOL_LOCK ();
+    while ((segment != NULL) && (!releaseSharedSegment (segment))) {
+        recordSegmentFree (segment);
+        segmentCount += 1;
+        lastSegment = segment;
+        segment = segment->nextSegment;
+    }
+    if (lastSegment != NULL) {
+        lastSegment->nextSegment = mempoolState.freeList;
+        mempoolState.freeList = freeSegments;
+    }
+    mempoolState.freeSegmentCount += segmentCount;
+    checkUpperCapacityThreshold ();
+    recordPoolUsage ();
+    MEMPOOL_UNLOCK ();
+}
+#endif
+
+/*
+ * Sets the memory pool owner tag for a task.
+ */
+uint8_t gmosMempoolSetTaskOwner (gmosTaskState_t* task, uint8_t owner)
+{
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+    uint8_t prevOwner = task->mempoolOwner;
+    task->mempoolOwner = (owner < GMOS_MEMPOOL_OWNER_COUNT) ?
+        owner : GMOS_MEMPOOL_OWNER_OTHER;
+    return prevOwner;
+#else
+    return GMOS_MEMPOOL_OWNER_OTHER;
+#endif
 }
+
+/*
+ * Accesses the memory pool telemetry statistics.
+ */
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+void gmosMempoolGetStats (gmosMempoolStats_t* mempoolStats)
+{
+    MEMPOOL_LOCK ();
+    *mempoolStats = mempoolState.stats;
+    if (mempoolState.lowCapacity) {
+        mempoolStats->lowCapacityTicks += (uint32_t)
+            (gmosPalGetTimer () - mempoolState.lowCapacityTime);
+    }
+    MEMPOOL_UNLOCK ();
+}
+#endif
+
+/*
+ * Resets the memory pool telemetry statistics.
+ */
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+void gmosMempoolResetStats (void)
+{
+    gmosMempoolStats_t* stats = &(mempoolState.stats);
+    uint_fast8_t i;
+
+    MEMPOOL_LOCK ();
+    stats->lowCapacityTicks = 0;
+    stats->lowCapacityCount = 0;
+    stats->allocFailCount = 0;
+    stats->peakSegmentsInUse = stats->segmentsInUse;
+    stats->peakLargeSegmentsInUse = stats->largeSegmentsInUse;
+    for (i = 0; i < GMOS_MEMPOOL_OWNER_COUNT; i++) {
+        stats->ownerPeakBytes [i] = stats->ownerBytes [i];
+    }
+    mempoolState.lowCapacityTime = gmosPalGetTimer ();
+    MEMPOOL_UNLOCK ();
+}
+#endif
+
+/*
+ * Writes the memory pool telemetry statistics to the debug log. Low
+ * capacity times are converted to milliseconds.
+ */
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+void gmosMempoolLogStats (void)
+{
+    static const char* ownerNames [GMOS_MEMPOOL_OWNER_COUNT] = {
+        "other", "network", "TLS", "CBOR", "sensor", "display" };
+    gmosMempoolStats_t mempoolStats;
+    uint_fast8_t i;
+
+    gmosMempoolGetStats (&mempoolStats);
+    GMOS_LOG (LOG_INFO, "Memory pool telemetry statistics:");
+    GMOS_LOG_FMT (LOG_INFO, "  segments in use %d/%d, peak %d",
+        mempoolStats.segmentsInUse, GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER,
+        mempoolStats.peakSegmentsInUse);
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    GMOS_LOG_FMT (LOG_INFO, "  large segments in use %d/%d, peak %d",
+        mempoolStats.largeSegmentsInUse,
+        GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER,
+        mempoolStats.peakLargeSegmentsInUse);
+#endif
+    GMOS_LOG_FMT (LOG_INFO,
+        "  allocation failures %ld, low capacity %ld times, %ldms",
+        (long) mempoolStats.allocFailCount,
+        (long) mempoolStats.lowCapacityCount,
+        (long) GMOS_TICKS_TO_MS (mempoolStats.lowCapacityTicks));
+    for (i = 0; i < GMOS_MEMPOOL_OWNER_COUNT; i++) {
+        if (mempoolStats.ownerPeakBytes [i] != 0) {
+            GMOS_LOG_FMT (LOG_INFO, "  owner %s %ld bytes, peak %ld",
+                ownerNames [i], (long) mempoolStats.ownerBytes [i],
+                (long) mempoolStats.ownerPeakBytes [i]);
+        }
+    }
+}
+#endif
@@ -0,0 +1,217 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements GubbinsMOS power state residency accounting.
+ */
+
+#include "gmos-config.h"
+
+// Power state residency accounting is only compiled if configured.
+#if GMOS_CONFIG_POWER_RESIDENCY
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-power.h"
+#include "gmos-instance.h"
+
+// Specifies the power state residency accounting state. This is either
+// allocated statically or selected from the current GubbinsMOS
+// instance.
+#if GMOS_CONFIG_INSTANCE_SUPPORT
+#define powerState (GMOS_INSTANCE_CURRENT->powerState)
+#else
+static gmosPowerState_t powerState;
+#endif
+
+// Specifies the supply current for each power state in microamps.
+static const uint32_t powerStateCurrents [GMOS_POWER_STATE_COUNT] = {
+    GMOS_CONFIG_POWER_ACTIVE_CURRENT,
+    GMOS_CONFIG_POWER_SAVE_CURRENT,
+    GMOS_CONFIG_POWER_DEEP_SLEEP_CURRENT };
+
+/*
+ * Accumulates the time spent in the current power state and then
+ * switches to the new power state.
+ */
+static void gmosPowerStateChange (uint8_t newState)
+{
+    uint32_t currentTime = gmosPalGetTimer ();
+    powerState.residencyTicks [powerState.currentState] +=
+        (uint32_t) (currentTime - powerState.stateChangeTime);
+    powerState.stateChangeTime = currentTime;
+    powerState.currentState = newState;
+}
+
+/*
+ * Records the wakeup reason on exit from a power save or deep sleep
+ * state.
+ */
+static void gmosPowerWakeup (void)
+{
+    int32_t wakeDelta = (int32_t)
+        (gmosPalGetTimer () - powerState.idleWakeTime);
+    if (wakeDelta >= 0) {
+        powerState.timerWakeCount += 1;
+    } else {
+        powerState.eventWakeCount += 1;
+    }
+    powerState.wakeTask = NULL;
+    powerState.wakePending = true;
+}
+
+/*
+ * Implements the lifecycle monitor handler used to track power state
+ * transitions.
+ */
+static bool gmosPowerLifecycleHandler (
+    gmosLifecycleStatus_t lifecycleStatus)
+{
+    switch (lifecycleStatus) {
+        case SCHEDULER_ENTER_POWER_SAVE :
+            gmosPowerStateChange (GMOS_POWER_STATE_POWER_SAVE);
+            break;
+        case SCHEDULER_ENTER_DEEP_SLEEP :
+            gmosPowerStateChange (GMOS_POWER_STATE_DEEP_SLEEP);
+            break;
+        case SCHEDULER_EXIT_POWER_SAVE :
+        case SCHEDULER_EXIT_DEEP_SLEEP :
+            gmosPowerStateChange (GMOS_POWER_STATE_ACTIVE);
+            gmosPowerWakeup ();
+            break;
+        default :
+            break;
+    }
+    return true;
+}
+
+/*
+ * Initialises power state residency accounting on startup.
+ */
+void gmosPowerInit (void)
+{
+    memset (&powerState, 0, sizeof (gmosPowerState_t));
+    powerState.stateChangeTime = gmosPalGetTimer ();
+    powerState.currentState = GMOS_POWER_STATE_ACTIVE;
+    gmosLifecycleAddMonitor (&(powerState.lifecycleMonitor),
+        gmosPowerLifecycleHandler);
+}
+
+/*
+ * Accesses the accumulated power state residency statistics.
+ */
+void gmosPowerGetStats (gmosPowerStats_t* powerStats)
+{
+    uint64_t chargeMicroampSeconds = 0;
+    uint_fast8_t i;
+
+    // Copy the accumulated residency times, including the time spent
+    // in the current power state.
+    for (i = 0; i < GMOS_POWER_STATE_COUNT; i++) {
+        powerStats->residencyTicks [i] = powerState.residencyTicks [i];
+    }
+    powerStats->residencyTicks [powerState.currentState] += (uint32_t)
+        (gmosPalGetTimer () - powerState.stateChangeTime);
+    powerStats->timerWakeCount = powerState.timerWakeCount;
+    powerStats->eventWakeCount = powerState.eventWakeCount;
+
+    // Derive the energy estimate from the supply current and residency
+    // time for each power state.
+    for (i = 0; i < GMOS_POWER_STATE_COUNT; i++) {
+        chargeMicroampSeconds += (powerStats->residencyTicks [i] *
+            powerStateCurrents [i]) / GMOS_CONFIG_SYSTEM_TIMER_FREQUENCY;
+    }
+    powerStats->energyMicrojoules = (chargeMicroampSeconds *
+        GMOS_CONFIG_POWER_SUPPLY_VOLTAGE) / 1000;
+}
+
+/*
+ * Accesses the task state for the first task that was run after the
+ * most recent wakeup.
+ */
+gmosTaskState_t* gmosPowerGetWakeTask (void)
+{
+    return powerState.wakeTask;
+}
+
+/*
+ * Accesses the number of times that a task was the first task to be
+ * run after a wakeup.
+ */
+uint32_t gmosPowerTaskGetWakes (gmosTaskState_t* task)
+{
+    return task->wakeCount;
+}
+
+/*
+ * Writes the accumulated power state residency statistics to the
+ * debug log. Residency times are converted to milliseconds.
+ */
+void gmosPowerLogStats (void)
+{
+    gmosPowerStats_t powerStats;
+    const char* taskName;
+
+    gmosPowerGetStats (&powerStats);
+    taskName = (powerState.wakeTask == NULL) ? "<none>" :
+        (powerState.wakeTask->taskName == NULL) ? "<unnamed>" :
+        powerState.wakeTask->taskName;
+    GMOS_LOG (LOG_INFO, "Power state residency statistics:");
+    GMOS_LOG_FMT (LOG_INFO,
+        "  active %ldms, power save %ldms, deep sleep %ldms",
+        (long) GMOS_TICKS_TO_MS (powerStats.residencyTicks [
+            GMOS_POWER_STATE_ACTIVE]),
+        (long) GMOS_TICKS_TO_MS (powerStats.residencyTicks [
+            GMOS_POWER_STATE_POWER_SAVE]),
+        (long) GMOS_TICKS_TO_MS (powerStats.residencyTicks [
+            GMOS_POWER_STATE_DEEP_SLEEP]));
+    GMOS_LOG_FMT (LOG_INFO,
+        "  wakeups timer %ld, event %ld, last wake task %s",
+        (long) powerStats.timerWakeCount,
+        (long) powerStats.eventWakeCount, taskName);
+    GMOS_LOG_FMT (LOG_INFO, "  estimated energy %ldmJ",
+        (long) ((powerStats.energyMicrojoules + 500) / 1000));
+}
+
+/*
+ * Records the wakeup time requested by the scheduler when it enters an
+ * idle period.
+ */
+void gmosPowerIdleRequest (uint32_t idleDuration)
+{
+    powerState.idleWakeTime = gmosPalGetTimer () + idleDuration;
+}
+
+/*
+ * Records the first task to run after a wakeup.
+ */
+void gmosPowerTaskRun (gmosTaskState_t* task)
+{
+    if (powerState.wakePending) {
+        powerState.wakePending = false;
+        powerState.wakeTask = task;
+        task->wakeCount += 1;
+    }
+}
+
+#endif // GMOS_CONFIG_POWER_RESIDENCY
@@ -0,0 +1,122 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements the GubbinsMOS hot path profiling probes.
+ */
+
+#include "gmos-config.h"
+
+// The profiling probes are only compiled if configured.
+#if GMOS_CONFIG_PROFILE_ENABLE
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "gmos-platform.h"
+#include "gmos-profile.h"
+
+// Check that there is space for all the built in probes.
+#if (GMOS_CONFIG_PROFILE_PROBE_COUNT < GMOS_PROFILE_ID_APP_FIRST)
+#error "The profiling probe count is too small for the built in probes."
+#endif
+
+// Specifies the profiling probe table.
+static gmosProfileStats_t profileTable [
+    GMOS_CONFIG_PROFILE_PROBE_COUNT];
+
+/*
+ * Adds a new execution time measurement to the statistics for the
+ * specified profiling probe.
+ */
+void gmosProfileRecord (uint_fast8_t probeId, uint32_t runCycles)
+{
+    gmosProfileStats_t* probeStats;
+
+    if (probeId >= GMOS_CONFIG_PROFILE_PROBE_COUNT) {
+        return;
+    }
+
+    // Update the probe statistics with interrupts disabled.
+    gmosPalMutexLock ();
+    probeStats = &(profileTable [probeId]);
+    if ((probeStats->runCount == 0) ||
+        (runCycles < probeStats->minCycles)) {
+        probeStats->minCycles = runCycles;
+    }
+    if (runCycles > probeStats->maxCycles) {
+        probeStats->maxCycles = runCycles;
+    }
+    probeStats->totalCycles += runCycles;
+    probeStats->runCount += 1;
+    gmosPalMutexUnlock ();
+}
+
+/*
+ * Accesses the accumulated statistics for the specified profiling
+ * probe.
+ */
+bool gmosProfileGetStats (
+    uint_fast8_t probeId, gmosProfileStats_t* probeStats)
+{
+    if (probeId >= GMOS_CONFIG_PROFILE_PROBE_COUNT) {
+        return false;
+    }
+    gmosPalMutexLock ();
+    *probeStats = profileTable [probeId];
+    gmosPalMutexUnlock ();
+    return true;
+}
+
+/*
+ * Resets the accumulated statistics for all profiling probes.
+ */
+void gmosProfileReset (void)
+{
+    gmosPalMutexLock ();
+    memset (profileTable, 0, sizeof (profileTable));
+    gmosPalMutexUnlock ();
+}
+
+/*
+ * Writes the accumulated statistics for all profiling probes that have
+ * been run to the debug log.
+ */
+void gmosProfileLogStats (void)
+{
+    gmosProfileStats_t probeStats;
+    uint_fast8_t i;
+
+    GMOS_LOG_FMT (LOG_INFO, "Profiling probe statistics (%ld Hz):",
+        (long) GMOS_CONFIG_PAL_CYCLE_COUNTER_FREQUENCY);
+    for (i = 0; i < GMOS_CONFIG_PROFILE_PROBE_COUNT; i++) {
+        gmosProfileGetStats (i, &probeStats);
+        if (probeStats.runCount == 0) {
+            continue;
+        }
+        GMOS_LOG_FMT (LOG_INFO,
+            "  probe %d: runs %ld, min %ld, max %ld, mean %ld",
+            (int) i, (long) probeStats.runCount,
+            (long) probeStats.minCycles, (long) probeStats.maxCycles,
+            (long) (probeStats.totalCycles / probeStats.runCount));
+    }
+}
+
+#endif // GMOS_CONFIG_PROFILE_ENABLE
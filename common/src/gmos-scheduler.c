@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2024 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,7 +26,12 @@
 
 #include "gmos-platform.h"
 #include "gmos-scheduler.h"
+#include "gmos-mempool.h"
 #include "gmos-events.h"
+#include "gmos-deferred.h"
+#include "gmos-trace.h"
+#include "gmos-power.h"
+#include "gmos-instance.h"
 
 // Define the internal task state encodings.
 #define TASK_STATE_INITIALISING 0x00
@@ -37,26 +42,32 @@
 #define TASK_STATE_SUSPENDED    0x05
 #define TASK_STATE_BUSY_WAIT    0x06
 
-// Specifies the start of the scheduled task list.
-static gmosTaskState_t* scheduledTasks = NULL;
+// Check for a valid number of task priority levels.
+#if (GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS < 1) || \
+    (GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS > 8)
+#error "Unsupported number of scheduler task priority levels."
+#endif
 
-// Specifies the start of the background task list.
-static gmosTaskState_t* backgroundTasks = NULL;
+// Specify the local timing wheel dimension aliases.
+#if GMOS_CONFIG_SCHEDULER_TIMING_WHEEL
+#define WHEEL_SLOT_BITS   GMOS_SCHEDULER_WHEEL_SLOT_BITS
+#define WHEEL_SLOT_COUNT  GMOS_SCHEDULER_WHEEL_SLOT_COUNT
+#define WHEEL_SLOT_MASK   (WHEEL_SLOT_COUNT - 1)
+#define WHEEL_LEVEL_COUNT GMOS_SCHEDULER_WHEEL_LEVEL_COUNT
+#endif
 
-// Specifies the start of the ready task list.
-static gmosTaskState_t* readyTaskListHead = NULL;
-
-// Specifies the end of the ready task list.
-static gmosTaskState_t* readyTaskListEnd = NULL;
-
-// Specifies the currently executing task.
-static gmosTaskState_t* currentTask = NULL;
-
-// Specifies the head of the scheduler lifecycle monitor list.
-static gmosLifecycleMonitor_t* lifecycleMonitors = NULL;
-
-// Tracks the number of 'stay awake' requests.
-static uint32_t stayAwakeCounter = 0;
+// Specifies the scheduler state. This is either allocated statically
+// or selected from the current GubbinsMOS instance.
+#if GMOS_CONFIG_INSTANCE_SUPPORT
+#define schedulerState (GMOS_INSTANCE_CURRENT->schedulerState)
+#elif (GMOS_CONFIG_SCHEDULER_PROFILING && \
+    (GMOS_CONFIG_SCHEDULER_PROFILING_LOG_INTERVAL > 0))
+static gmosSchedulerState_t schedulerState = {
+    .nextStatsLogTime = GMOS_MS_TO_TICKS (
+        1000 * GMOS_CONFIG_SCHEDULER_PROFILING_LOG_INTERVAL) };
+#else
+static gmosSchedulerState_t schedulerState;
+#endif
 
 /*
  * Adds a task to the list of tasks that are ready for immediate
@@ -64,26 +75,701 @@ static uint32_t stayAwakeCounter = 0;
  */
 static void gmosSchedulerMakeTaskReady (gmosTaskState_t* taskState)
 {
+#if (GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS > 1)
+    uint_fast8_t priority = taskState->taskPriority;
+#else
+    uint_fast8_t priority = 0;
+#endif
+
+    // When profiling, tasks that are not being released from the
+    // scheduled or background queues use the current time as their
+    // nominal ready time.
+#if GMOS_CONFIG_SCHEDULER_PROFILING
+    if ((taskState->taskState != TASK_STATE_SCHEDULED) &&
+        (taskState->taskState != TASK_STATE_BACKGROUND)) {
+        taskState->timestamp = (int32_t) gmosPalGetTimer ();
+    }
+#endif
+
     taskState->taskState = TASK_STATE_READY;
     taskState->nextTask = NULL;
-    if (readyTaskListHead == NULL) {
-        readyTaskListHead = taskState;
-        readyTaskListEnd = taskState;
+    if (schedulerState.readyTaskListHead [priority] == NULL) {
+        schedulerState.readyTaskListHead [priority] = taskState;
+        schedulerState.readyTaskListEnd [priority] = taskState;
+        schedulerState.readyTaskMask |= (1U << priority);
     } else {
-        readyTaskListEnd->nextTask = taskState;
-        readyTaskListEnd = taskState;
+        schedulerState.readyTaskListEnd [priority]->nextTask =
+            taskState;
+        schedulerState.readyTaskListEnd [priority] = taskState;
+    }
+}
+
+/*
+ * Removes the next task to be run from the ready task lists. Tasks are
+ * selected in priority order, except that a lowest priority task will
+ * be selected if the starvation limit has been reached. Returns a null
+ * reference if there are no ready tasks.
+ */
+static gmosTaskState_t* gmosSchedulerGetReadyTask (void)
+{
+    gmosTaskState_t* readyTask;
+    uint_fast8_t priority;
+
+    // Select the highest priority level with ready tasks.
+    if (schedulerState.readyTaskMask == 0) {
+        return NULL;
+    }
+    priority = __builtin_ctz (schedulerState.readyTaskMask);
+
+    // Run a lowest priority task if they have been waiting for too
+    // many higher priority tasks to complete.
+#if (GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS > 1)
+    if ((schedulerState.readyTaskMask &
+        (1U << GMOS_TASK_PRIORITY_LOWEST)) == 0) {
+        schedulerState.starvationCounter = 0;
+    } else if (priority != GMOS_TASK_PRIORITY_LOWEST) {
+        schedulerState.starvationCounter += 1;
+        if (schedulerState.starvationCounter >
+            GMOS_CONFIG_SCHEDULER_STARVATION_LIMIT) {
+            priority = GMOS_TASK_PRIORITY_LOWEST;
+            schedulerState.starvationCounter = 0;
+        }
+    }
+#endif
+
+    // Pop the next task from the head of the selected ready task list.
+    readyTask = schedulerState.readyTaskListHead [priority];
+    schedulerState.readyTaskListHead [priority] = readyTask->nextTask;
+    if (schedulerState.readyTaskListHead [priority] == NULL) {
+        schedulerState.readyTaskMask &= ~(1U << priority);
+    }
+    return readyTask;
+}
+
+/*
+ * Links a task into a task queue list at the specified list position.
+ * The task back references are also updated if constant time task
+ * removal is enabled.
+ */
+static inline void gmosSchedulerLinkTask (
+    gmosTaskState_t** taskLinkPtr, gmosTaskState_t* taskState)
+{
+    taskState->nextTask = *taskLinkPtr;
+#if GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+    taskState->prevTaskPtr = taskLinkPtr;
+    if (taskState->nextTask != NULL) {
+        taskState->nextTask->prevTaskPtr = &(taskState->nextTask);
     }
+#endif
+    *taskLinkPtr = taskState;
 }
 
+#if GMOS_CONFIG_SCHEDULER_TIMING_WHEEL
+
+/*
+ * Places a task in the appropriate timing wheel slot, based on the
+ * difference between the task timestamp and the wheel base time. Tasks
+ * with timestamps that precede the base time are placed in the current
+ * level zero slot. Newly inserted tasks are appended to the end of the
+ * slot list and redistributed tasks are added to the start of the slot
+ * list, which preserves FIFO ordering for tasks with the same
+ * timestamp.
+ */
+static void gmosSchedulerWheelPlaceTask (gmosTaskQueue_t* queue,
+    gmosTaskState_t* taskState, bool appendTask)
+{
+    uint32_t timestamp = (uint32_t) taskState->timestamp;
+    uint32_t timeDelta = timestamp - queue->baseTime;
+    gmosTaskState_t** taskLinkPtr;
+    uint_fast8_t level = 0;
+    uint_fast8_t slot;
+
+    // Clamp overdue tasks to the current base time.
+    if (((int32_t) timeDelta) < 0) {
+        timestamp = queue->baseTime;
+        timeDelta = 0;
+    }
+
+    // Select the lowest wheel level that spans the required delay.
+    while ((level < WHEEL_LEVEL_COUNT - 1) &&
+        ((timeDelta >> (WHEEL_SLOT_BITS * (level + 1))) != 0)) {
+        level += 1;
+    }
+
+    // Update the earliest task timestamp for higher level slots.
+    slot = (timestamp >> (WHEEL_SLOT_BITS * level)) & WHEEL_SLOT_MASK;
+    if (level > 0) {
+        if (queue->slots [level][slot] == NULL) {
+            queue->slotDeadlines [level][slot] = timestamp;
+            queue->staleDeadlineMasks [level] &= ~(1U << slot);
+        } else if (((int32_t)
+            (timestamp - queue->slotDeadlines [level][slot])) < 0) {
+            queue->slotDeadlines [level][slot] = timestamp;
+        }
+    }
+
+    // Add the task to the selected slot list, updating the slot list
+    // end reference if required.
+    taskLinkPtr = &(queue->slots [level][slot]);
+    if (appendTask && (*taskLinkPtr != NULL)) {
+        taskLinkPtr = queue->slotEnds [level][slot];
+    }
+    gmosSchedulerLinkTask (taskLinkPtr, taskState);
+    if (taskState->nextTask == NULL) {
+        queue->slotEnds [level][slot] = &(taskState->nextTask);
+    }
+    queue->slotMasks [level] |= (1U << slot);
+#if GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+    taskState->wheelSlot = (level << WHEEL_SLOT_BITS) | slot;
+#endif
+}
+
+/*
+ * Finds the first occupied slot for a given timing wheel level, in
+ * processing order. For levels above zero, the slot for the current
+ * base time has already been redistributed, so the search starts at the
+ * following slot. Any occupancy bits for slots that have been emptied
+ * by task removal are cleared. Returns false if there are no occupied
+ * slots at the specified level.
+ */
+static bool gmosSchedulerWheelFirstSlot (gmosTaskQueue_t* queue,
+    uint_fast8_t level, uint_fast8_t* slot, uint_fast8_t* slotSteps)
+{
+    uint_fast16_t slotMask = queue->slotMasks [level];
+    uint_fast16_t rotatedMask;
+    uint_fast8_t firstSlot;
+
+    firstSlot = (queue->baseTime >> (WHEEL_SLOT_BITS * level)) &
+        WHEEL_SLOT_MASK;
+    if (level > 0) {
+        firstSlot = (firstSlot + 1) & WHEEL_SLOT_MASK;
+    }
+
+    // Rotate the slot mask so that bit zero corresponds to the next
+    // slot to be processed. Stale occupancy bits are discarded until an
+    // occupied slot is found.
+    while (slotMask != 0) {
+        rotatedMask = (uint16_t) ((((uint32_t) slotMask) >> firstSlot) |
+            (((uint32_t) slotMask) << (WHEEL_SLOT_COUNT - firstSlot)));
+        *slotSteps = __builtin_ctz (rotatedMask);
+        *slot = (firstSlot + *slotSteps) & WHEEL_SLOT_MASK;
+        if (queue->slots [level][*slot] != NULL) {
+            return true;
+        }
+        slotMask &= ~(1U << *slot);
+        queue->slotMasks [level] = slotMask;
+    }
+    return false;
+}
+
+/*
+ * Determines the next timing wheel action time. This is either the
+ * timestamp for the next occupied level zero slot or the time at which
+ * the contents of an occupied higher level slot need to be redistributed
+ * to the lower levels. Returns false if the timing wheel is empty.
+ */
+static bool gmosSchedulerWheelNextTime (
+    gmosTaskQueue_t* queue, uint32_t* nextTime)
+{
+    uint32_t baseTime = queue->baseTime;
+    uint32_t earliestTime = baseTime;
+    uint32_t actionTime;
+    uint_fast8_t slotSteps;
+    uint_fast8_t slot;
+    uint_fast8_t shift;
+    uint_fast8_t level;
+    bool wheelEmpty = true;
+
+    for (level = 0; level < WHEEL_LEVEL_COUNT; level++) {
+        if (!gmosSchedulerWheelFirstSlot (queue, level, &slot, &slotSteps)) {
+            continue;
+        }
+
+        // Derive the action time from the number of slot steps.
+        shift = WHEEL_SLOT_BITS * level;
+        if (level == 0) {
+            actionTime = baseTime + slotSteps;
+        } else {
+            actionTime = (baseTime & ~((((uint32_t) 1) << shift) - 1)) +
+                (((uint32_t) (slotSteps + 1)) << shift);
+        }
+        if (wheelEmpty || (((int32_t) (actionTime - earliestTime)) < 0)) {
+            earliestTime = actionTime;
+            wheelEmpty = false;
+        }
+    }
+    *nextTime = earliestTime;
+    return !wheelEmpty;
+}
+
+/*
+ * Gets the earliest task timestamp for an occupied timing wheel slot
+ * above level zero. If a task has been removed from the slot since the
+ * earliest timestamp was last updated, the slot task list is searched
+ * in order to recalculate it.
+ */
+static uint32_t gmosSchedulerWheelSlotDeadline (gmosTaskQueue_t* queue,
+    uint_fast8_t level, uint_fast8_t slot)
+{
+    gmosTaskState_t* taskState;
+    uint32_t deadline;
+
+    if ((queue->staleDeadlineMasks [level] & (1U << slot)) != 0) {
+        taskState = queue->slots [level][slot];
+        deadline = (uint32_t) taskState->timestamp;
+        while (taskState != NULL) {
+            if (((int32_t)
+                (((uint32_t) taskState->timestamp) - deadline)) < 0) {
+                deadline = (uint32_t) taskState->timestamp;
+            }
+            taskState = taskState->nextTask;
+        }
+        queue->slotDeadlines [level][slot] = deadline;
+        queue->staleDeadlineMasks [level] &= ~(1U << slot);
+    }
+    return queue->slotDeadlines [level][slot];
+}
+
+/*
+ * Determines the earliest task timestamp held in the timing wheel. All
+ * tasks in a level zero slot share the same timestamp, and the earliest
+ * task timestamp is recorded for each higher level slot. Slots later in
+ * the processing order for a given level can only hold later
+ * timestamps, so only the first occupied slot at each level needs to
+ * be checked. Returns false if the timing wheel is empty.
+ */
+static bool gmosSchedulerWheelNextDeadline (
+    gmosTaskQueue_t* queue, uint32_t* deadline)
+{
+    uint32_t baseTime = queue->baseTime;
+    uint32_t earliestTime = baseTime;
+    uint32_t slotDeadline;
+    uint_fast8_t slotSteps;
+    uint_fast8_t slot;
+    uint_fast8_t level;
+    bool wheelEmpty = true;
+
+    // Tasks that were overdue on insertion are held in the slot for
+    // the current base time, so timestamps are compared relative to
+    // the base time in order to avoid wrapping issues.
+    for (level = 0; level < WHEEL_LEVEL_COUNT; level++) {
+        if (!gmosSchedulerWheelFirstSlot (queue, level, &slot, &slotSteps)) {
+            continue;
+        }
+        if (level == 0) {
+            slotDeadline = baseTime + slotSteps;
+        } else {
+            slotDeadline =
+                gmosSchedulerWheelSlotDeadline (queue, level, slot);
+        }
+        if (wheelEmpty || (((int32_t) (slotDeadline - baseTime)) <
+            ((int32_t) (earliestTime - baseTime)))) {
+            earliestTime = slotDeadline;
+            wheelEmpty = false;
+        }
+    }
+    *deadline = earliestTime;
+    return !wheelEmpty;
+}
+
+/*
+ * Marks the earliest task timestamp for a timing wheel slot as stale
+ * if the specified task is being removed from the slot and may hold
+ * the earliest timestamp.
+ */
+static inline void gmosSchedulerWheelRemoveDeadline (
+    gmosTaskQueue_t* queue, gmosTaskState_t* taskState,
+    uint_fast8_t level, uint_fast8_t slot)
+{
+    if ((level > 0) && (((uint32_t) taskState->timestamp) ==
+        queue->slotDeadlines [level][slot])) {
+        queue->staleDeadlineMasks [level] |= (1U << slot);
+    }
+}
+
+/*
+ * Inserts a task into a timing wheel task queue. The wheel base time
+ * is reset to the current system time if the wheel is empty. Stale
+ * slot occupancy bits may prevent the reset, but this only means that
+ * the task may be placed in a higher wheel level than necessary.
+ */
+static void gmosSchedulerQueueInsert (
+    gmosTaskQueue_t* queue, gmosTaskState_t* taskState)
+{
+    uint_fast16_t slotMasks = 0;
+    uint_fast8_t level;
+
+    for (level = 0; level < WHEEL_LEVEL_COUNT; level++) {
+        slotMasks |= queue->slotMasks [level];
+    }
+    if (slotMasks == 0) {
+        queue->baseTime = gmosPalGetTimer ();
+    }
+    gmosSchedulerWheelPlaceTask (queue, taskState, true);
+}
+
+#if !GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+
 /*
- * Inserts a new task into a task queue, ordered according to the
- * specified timestamps. Uses the supplied task status to determine
- * the task queue to use and the associated scheduling timestamp.
+ * Removes a task from a timing wheel task queue, returning a boolean
+ * value to indicate whether the task was found in the queue.
+ */
+static bool gmosSchedulerQueueRemove (
+    gmosTaskQueue_t* queue, gmosTaskState_t* taskState)
+{
+    gmosTaskState_t** taskSearchPtr;
+    uint_fast8_t level;
+    uint_fast8_t slot;
+
+    // Search all the occupied slots for the task.
+    for (level = 0; level < WHEEL_LEVEL_COUNT; level++) {
+        for (slot = 0; slot < WHEEL_SLOT_COUNT; slot++) {
+            if ((queue->slotMasks [level] & (1U << slot)) == 0) {
+                continue;
+            }
+            taskSearchPtr = &(queue->slots [level][slot]);
+            while (*taskSearchPtr != NULL) {
+                if (*taskSearchPtr == taskState) {
+                    *taskSearchPtr = taskState->nextTask;
+                    gmosSchedulerWheelRemoveDeadline (
+                        queue, taskState, level, slot);
+                    if (queue->slots [level][slot] == NULL) {
+                        queue->slotMasks [level] &= ~(1U << slot);
+                    } else if (taskState->nextTask == NULL) {
+                        queue->slotEnds [level][slot] = taskSearchPtr;
+                    }
+                    return true;
+                }
+                taskSearchPtr = &((*taskSearchPtr)->nextTask);
+            }
+        }
+    }
+    return false;
+}
+
+#endif // GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+
+/*
+ * Processes a timing wheel task queue, marking all tasks that have
+ * reached their scheduled execution time as ready to run. Advances
+ * the wheel base time from one action time to the next, redistributing
+ * higher level slots to the lower levels as required. Tasks in a
+ * redistributed slot were always inserted before any tasks with the
+ * same timestamp that are already held in the lower levels, so they
+ * are added to the start of the lower level slot lists in their
+ * original order.
+ */
+static void gmosSchedulerQueueProcess (
+    gmosTaskQueue_t* queue, uint32_t currentTime)
+{
+    gmosTaskState_t* taskList;
+    gmosTaskState_t* taskState;
+    gmosTaskState_t* reversedList;
+    uint32_t actionTime;
+    uint_fast8_t shift;
+    uint_fast8_t level;
+    uint_fast8_t slot;
+
+    while (true) {
+
+        // Move the base time up to the current time if there are no
+        // pending actions.
+        // The base time is never moved backwards, since the queue may
+        // previously have been processed using a future time value.
+        if ((!gmosSchedulerWheelNextTime (queue, &actionTime)) ||
+            (((int32_t) (actionTime - currentTime)) > 0)) {
+            if (((int32_t) (currentTime - queue->baseTime)) > 0) {
+                queue->baseTime = currentTime;
+            }
+            break;
+        }
+        queue->baseTime = actionTime;
+
+        // Redistribute the higher level slots that are aligned with the
+        // action time, starting with the lowest level. Tasks from the
+        // higher levels are older, so they are redistributed last in
+        // order to place them ahead of tasks with the same timestamp.
+        // Tasks are never redistributed into the current slot at a
+        // higher level.
+        for (level = 1; level < WHEEL_LEVEL_COUNT; level++) {
+            shift = WHEEL_SLOT_BITS * level;
+            if ((actionTime & ((((uint32_t) 1) << shift) - 1)) != 0) {
+                break;
+            }
+            slot = (actionTime >> shift) & WHEEL_SLOT_MASK;
+            taskList = queue->slots [level][slot];
+            queue->slots [level][slot] = NULL;
+            queue->slotMasks [level] &= ~(1U << slot);
+            reversedList = NULL;
+            while (taskList != NULL) {
+                taskState = taskList;
+                taskList = taskState->nextTask;
+                taskState->nextTask = reversedList;
+                reversedList = taskState;
+            }
+            while (reversedList != NULL) {
+                taskState = reversedList;
+                reversedList = taskState->nextTask;
+                gmosSchedulerWheelPlaceTask (queue, taskState, false);
+            }
+        }
+
+        // Mark all the tasks in the current level zero slot as ready.
+        slot = actionTime & WHEEL_SLOT_MASK;
+        taskList = queue->slots [0][slot];
+        queue->slots [0][slot] = NULL;
+        queue->slotMasks [0] &= ~(1U << slot);
+        while (taskList != NULL) {
+            taskState = taskList;
+            taskList = taskState->nextTask;
+            gmosSchedulerMakeTaskReady (taskState);
+        }
+    }
+}
+
+/*
+ * Gets the time until the earliest task timestamp in the timing wheel,
+ * expressed as an integer number of system ticks. Any higher level
+ * slots that are due for redistribution before then will be processed
+ * on the next call to the queue processing function, so there is no
+ * need to wake early for them.
+ */
+static int32_t gmosSchedulerQueueDelay (
+    gmosTaskQueue_t* queue, uint32_t currentTime)
+{
+    uint32_t nextTime;
+    int32_t pendingTaskDelay;
+
+    if (gmosSchedulerWheelNextDeadline (queue, &nextTime)) {
+        pendingTaskDelay = (int32_t) (nextTime - currentTime);
+    } else {
+        pendingTaskDelay = INT32_MAX;
+    }
+    return pendingTaskDelay;
+}
+
+#if (GMOS_CONFIG_SCHEDULER_TIMER_SLACK > 0)
+
+/*
+ * Extends the delay until the next task deadline in the timing wheel
+ * so that any other task deadlines in the timer slack window are
+ * merged with the same wakeup. This checks the occupied level zero
+ * slots and the earliest task timestamps for the first occupied slot
+ * at each higher level, which have already been brought up to date
+ * when determining the next task deadline.
+ */
+static int32_t gmosSchedulerQueueCoalesce (
+    gmosTaskQueue_t* queue, uint32_t currentTime, int32_t delay)
+{
+    uint32_t windowStart = currentTime + (uint32_t) delay;
+    uint32_t windowEnd =
+        windowStart + GMOS_CONFIG_SCHEDULER_TIMER_SLACK;
+    uint32_t slotDeadline;
+    uint_fast8_t slotSteps;
+    uint_fast8_t slot;
+    uint_fast8_t level;
+
+    for (level = 0; level < WHEEL_LEVEL_COUNT; level++) {
+        if (!gmosSchedulerWheelFirstSlot (queue, level, &slot, &slotSteps)) {
+            continue;
+        }
+
+        // Select the latest occupied level zero slot in the window.
+        if (level == 0) {
+            for (slot = slotSteps; slot <= WHEEL_SLOT_MASK; slot++) {
+                slotDeadline = queue->baseTime + slot;
+                if (((int32_t) (slotDeadline - windowEnd)) > 0) {
+                    break;
+                }
+                if (queue->slots [0][slotDeadline & WHEEL_SLOT_MASK] !=
+                    NULL) {
+                    windowStart = slotDeadline;
+                }
+            }
+            continue;
+        }
+
+        // Select the earliest higher level slot deadline if it lies
+        // later in the window.
+        slotDeadline = queue->slotDeadlines [level][slot];
+        if ((((int32_t) (slotDeadline - windowStart)) > 0) &&
+            (((int32_t) (slotDeadline - windowEnd)) <= 0)) {
+            windowStart = slotDeadline;
+        }
+    }
+    return (int32_t) (windowStart - currentTime);
+}
+
+#endif // GMOS_CONFIG_SCHEDULER_TIMER_SLACK
+
+#else // GMOS_CONFIG_SCHEDULER_TIMING_WHEEL
+
+/*
+ * Inserts a task into a sorted list task queue, ordered according to
+ * the task timestamps.
+ */
+static void gmosSchedulerQueueInsert (
+    gmosTaskQueue_t* queue, gmosTaskState_t* taskState)
+{
+    gmosTaskState_t** taskSearchPtr = &(queue->taskList);
+
+    // Search from the start of the task list for the correct insertion
+    // point. Timestamp comparisons use unsigned arithmetic so that they
+    // remain valid when the system timer wraps.
+    while (*taskSearchPtr != NULL) {
+        if (((int32_t) (((uint32_t) (*taskSearchPtr)->timestamp) -
+            ((uint32_t) taskState->timestamp))) > 0) {
+            break;
+        } else {
+            taskSearchPtr = &((*taskSearchPtr)->nextTask);
+        }
+    }
+
+    // Insert the task into the list.
+    gmosSchedulerLinkTask (taskSearchPtr, taskState);
+}
+
+#if !GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+
+/*
+ * Removes a task from a sorted list task queue, returning a boolean
+ * value to indicate whether the task was found in the queue.
+ */
+static bool gmosSchedulerQueueRemove (
+    gmosTaskQueue_t* queue, gmosTaskState_t* taskState)
+{
+    gmosTaskState_t** taskSearchPtr = &(queue->taskList);
+
+    // Search for the task in the queue.
+    while (*taskSearchPtr != NULL) {
+        if (*taskSearchPtr == taskState) {
+            *taskSearchPtr = taskState->nextTask;
+            return true;
+        } else {
+            taskSearchPtr = &((*taskSearchPtr)->nextTask);
+        }
+    }
+    return false;
+}
+
+#endif // GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+
+/*
+ * Processes a sorted list task queue, marking all tasks that have
+ * reached their scheduled execution time as ready to run.
+ */
+static void gmosSchedulerQueueProcess (
+    gmosTaskQueue_t* queue, uint32_t currentTime)
+{
+    gmosTaskState_t* pendingTask = queue->taskList;
+
+    while ((pendingTask != NULL) && (((int32_t)
+        (((uint32_t) pendingTask->timestamp) - currentTime)) <= 0)) {
+        queue->taskList = pendingTask->nextTask;
+#if GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+        if (queue->taskList != NULL) {
+            queue->taskList->prevTaskPtr = &(queue->taskList);
+        }
+#endif
+        gmosSchedulerMakeTaskReady (pendingTask);
+        pendingTask = queue->taskList;
+    }
+}
+
+/*
+ * Gets the time until the next pending task is due to run, expressed
+ * as an integer number of system ticks. Negative values imply that the
+ * task is overdue.
+ */
+static int32_t gmosSchedulerQueueDelay (
+    gmosTaskQueue_t* queue, uint32_t currentTime)
+{
+    gmosTaskState_t* pendingTask = queue->taskList;
+    int32_t pendingTaskDelay;
+
+    if (pendingTask != NULL) {
+        pendingTaskDelay = (int32_t)
+            (((uint32_t) pendingTask->timestamp) - currentTime);
+    } else {
+        pendingTaskDelay = INT32_MAX;
+    }
+    return pendingTaskDelay;
+}
+
+#if (GMOS_CONFIG_SCHEDULER_TIMER_SLACK > 0)
+
+/*
+ * Extends the delay until the next pending task is due to run so that
+ * any other task deadlines in the timer slack window are merged with
+ * the same wakeup. This selects the latest task timestamp in the slack
+ * window that follows the first task timestamp.
+ */
+static int32_t gmosSchedulerQueueCoalesce (
+    gmosTaskQueue_t* queue, uint32_t currentTime, int32_t delay)
+{
+    gmosTaskState_t* pendingTask = queue->taskList;
+    uint32_t windowEnd = currentTime + (uint32_t) delay +
+        GMOS_CONFIG_SCHEDULER_TIMER_SLACK;
+
+    while ((pendingTask != NULL) && (((int32_t)
+        (((uint32_t) pendingTask->timestamp) - windowEnd)) <= 0)) {
+        delay = (int32_t)
+            (((uint32_t) pendingTask->timestamp) - currentTime);
+        pendingTask = pendingTask->nextTask;
+    }
+    return delay;
+}
+
+#endif // GMOS_CONFIG_SCHEDULER_TIMER_SLACK
+
+#endif // GMOS_CONFIG_SCHEDULER_TIMING_WHEEL
+
+#if GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+
+/*
+ * Removes a task from a task queue in constant time, using the task
+ * back reference to unlink it. The task state must already have been
+ * checked to ensure that the task is held in the specified queue. For
+ * the timing wheel, any slot occupancy bits that become stale are
+ * cleared the next time the wheel is processed.
+ */
+static bool gmosSchedulerQueueRemove (
+    gmosTaskQueue_t* queue, gmosTaskState_t* taskState)
+{
+    gmosTaskState_t* nextTask = taskState->nextTask;
+
+    *(taskState->prevTaskPtr) = nextTask;
+    if (nextTask != NULL) {
+        nextTask->prevTaskPtr = taskState->prevTaskPtr;
+    }
+
+    // Update the slot list end reference when removing the last task
+    // from a timing wheel slot, and check for removal of the earliest
+    // task in a higher level slot.
+#if GMOS_CONFIG_SCHEDULER_TIMING_WHEEL
+    else {
+        queue->slotEnds [taskState->wheelSlot >> WHEEL_SLOT_BITS]
+            [taskState->wheelSlot & WHEEL_SLOT_MASK] =
+            taskState->prevTaskPtr;
+    }
+    gmosSchedulerWheelRemoveDeadline (queue, taskState,
+        taskState->wheelSlot >> WHEEL_SLOT_BITS,
+        taskState->wheelSlot & WHEEL_SLOT_MASK);
+#endif
+    return true;
+}
+
+#endif // GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+
+/*
+ * Inserts a task into the appropriate task queue. Uses the supplied
+ * task status to determine the task queue to use and the associated
+ * scheduling timestamp.
  */
 static void gmosSchedulerInsertTask (
     gmosTaskState_t* taskState, gmosTaskStatus_t taskStatus)
 {
-    gmosTaskState_t** taskSearchPtr;
+    gmosTaskQueue_t* taskQueue;
 
     // Add immediate tasks to the ready task list.
     if (taskStatus == GMOS_TASK_RUN_IMMEDIATE) {
@@ -103,29 +789,18 @@ static void gmosSchedulerInsertTask (
     // queue.
     if ((taskStatus & 0x80000000) == 0) {
         taskState->taskState = TASK_STATE_SCHEDULED;
-        taskSearchPtr = &scheduledTasks;
+        taskQueue = &schedulerState.scheduledTasks;
     } else {
         taskState->taskState = TASK_STATE_BACKGROUND;
-        taskSearchPtr = &backgroundTasks;
+        taskQueue = &schedulerState.backgroundTasks;
     }
 
     // Calculate the timestamp from the delay field of the task status.
-    taskState->timestamp = (int32_t) gmosPalGetTimer();
-    taskState->timestamp += (int32_t) (taskStatus & 0x7FFFFFFF);
-
-    // Search from the start of the task list for the correct insertion
-    // point.
-    while (*taskSearchPtr != NULL) {
-        if (((*taskSearchPtr)->timestamp - taskState->timestamp) > 0) {
-            break;
-        } else {
-            taskSearchPtr = &((*taskSearchPtr)->nextTask);
-        }
-    }
+    taskState->timestamp = (int32_t)
+        (gmosPalGetTimer () + (taskStatus & 0x7FFFFFFF));
 
-    // Insert the task into the list.
-    taskState->nextTask = *taskSearchPtr;
-    *taskSearchPtr = taskState;
+    // Insert the task into the selected queue.
+    gmosSchedulerQueueInsert (taskQueue, taskState);
 }
 
 /*
@@ -134,67 +809,151 @@ static void gmosSchedulerInsertTask (
  */
 static void gmosSchedulerRemoveTask (gmosTaskState_t* taskState)
 {
-    gmosTaskState_t** taskSearchPtr;
+    gmosTaskQueue_t* taskQueue;
 
     // Select the appropriate queue for removing the task.
     if (taskState->taskState == TASK_STATE_SCHEDULED) {
-        taskSearchPtr = &scheduledTasks;
+        taskQueue = &schedulerState.scheduledTasks;
     } else if (taskState->taskState == TASK_STATE_BACKGROUND) {
-        taskSearchPtr = &backgroundTasks;
+        taskQueue = &schedulerState.backgroundTasks;
     } else {
         return;
     }
 
-    // Search for the task in the queue.
-    while (*taskSearchPtr != NULL) {
-        if (*taskSearchPtr == taskState) {
-            taskState->taskState = TASK_STATE_SUSPENDED;
-            *taskSearchPtr = taskState->nextTask;
-            break;
-        } else {
-            taskSearchPtr = &((*taskSearchPtr)->nextTask);
-        }
+    // Remove the task from the queue.
+    if (gmosSchedulerQueueRemove (taskQueue, taskState)) {
+        taskState->taskState = TASK_STATE_SUSPENDED;
     }
 }
 
+#if GMOS_CONFIG_SCHEDULER_PROFILING
+
 /*
- * Gets the next pending task from a given task list if it is ready
- * to run.
+ * Updates the task profiling statistics after running a task.
  */
-static gmosTaskState_t* gmosSchedulerGetPendingTask (
-    gmosTaskState_t** taskListPtr)
+static void gmosSchedulerUpdateStats (gmosTaskState_t* taskState,
+    uint32_t runCycles, uint32_t lateTicks)
 {
-    gmosTaskState_t* pendingTask = *taskListPtr;
-    int32_t currentTime = (int32_t) gmosPalGetTimer();
+    gmosTaskStats_t* taskStats = &(taskState->taskStats);
 
-    if (pendingTask != NULL) {
-        if ((pendingTask->timestamp - currentTime) <= 0) {
-            *taskListPtr = pendingTask->nextTask;
+    taskStats->runCount += 1;
+    taskStats->runCycles += runCycles;
+    taskStats->lateTicks += lateTicks;
+    if (runCycles > taskStats->maxRunCycles) {
+        taskStats->maxRunCycles = runCycles;
+    }
+    if (lateTicks > taskStats->maxLateTicks) {
+        taskStats->maxLateTicks = lateTicks;
+    }
+}
+
+#endif // GMOS_CONFIG_SCHEDULER_PROFILING
+
+#if GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+
+/*
+ * Converts a task execution budget in microseconds to the equivalent
+ * number of cycle counter ticks, saturating on overflow.
+ */
+static uint32_t gmosSchedulerBudgetCycles (uint32_t budgetMicros)
+{
+    uint64_t budgetCycles = ((uint64_t) budgetMicros *
+        GMOS_CONFIG_PAL_CYCLE_COUNTER_FREQUENCY) / 1000000;
+    return (budgetCycles > UINT32_MAX) ?
+        UINT32_MAX : (uint32_t) budgetCycles;
+}
+
+/*
+ * Checks the task execution time against the task execution budget
+ * after running a task, triggering the scheduler watchdog on
+ * persistent overruns.
+ */
+static void gmosSchedulerCheckBudget (gmosTaskState_t* taskState,
+    uint32_t runCycles)
+{
+    gmosSchedulerOverrunStats_t* overrunStats =
+        &(schedulerState.overrunStats);
+    const char* taskName;
+    uint32_t runTime;
+
+    // Clear the consecutive overrun count if the task was within its
+    // execution budget.
+    overrunStats->runCount += 1;
+    if ((taskState->budgetCycles == 0) ||
+        (runCycles <= taskState->budgetCycles)) {
+        taskState->overrunStreak = 0;
+        return;
+    }
+
+    // Record and log the overrun.
+    overrunStats->overrunCount += 1;
+    taskState->overrunCount += 1;
+    if (taskState->overrunStreak < UINT16_MAX) {
+        taskState->overrunStreak += 1;
+    }
+    taskName = (taskState->taskName != NULL) ?
+        taskState->taskName : "<unnamed>";
+    runTime = (uint32_t) ((runCycles * (uint64_t) 1000000) /
+        GMOS_CONFIG_PAL_CYCLE_COUNTER_FREQUENCY);
+    GMOS_LOG_FMT (LOG_WARNING,
+        "Task %s exceeded execution budget : run time %ldus",
+        taskName, (long) runTime);
+
+    // Trigger the scheduler watchdog on persistent overruns.
+#if (GMOS_CONFIG_SCHEDULER_OVERRUN_LIMIT > 0)
+    if (taskState->overrunStreak >=
+        GMOS_CONFIG_SCHEDULER_OVERRUN_LIMIT) {
+        overrunStats->watchdogCount += 1;
+        taskState->overrunStreak = 0;
+        if (schedulerState.watchdogFn != NULL) {
+            schedulerState.watchdogFn (taskState);
         } else {
-            pendingTask = NULL;
+            GMOS_ASSERT_FAIL ("Persistent task budget overrun.");
         }
     }
-    return pendingTask;
+#endif
 }
 
+#endif // GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+
 /*
- * Gets the time until the next pending task is due to run, expressed
- * as an integer number of system ticks. Negative values imply that the
- * task is overdue.
+ * Runs the next idle worker with pending work, selecting idle workers
+ * in turn. Returns 'false' if no idle workers have pending work.
  */
-static int32_t gmosSchedulerGetPendingTaskDelay (
-    gmosTaskState_t** taskListPtr)
+static bool gmosSchedulerRunIdleWorker (uint32_t idleTime)
 {
-    gmosTaskState_t* pendingTask = *taskListPtr;
-    int32_t currentTime = (int32_t) gmosPalGetTimer();
-    int32_t pendingTaskDelay;
+    gmosIdleWorker_t* idleWorker = schedulerState.nextIdleWorker;
+    gmosIdleWorker_t* firstWorker;
+    uint32_t budget;
 
-    if (pendingTask != NULL) {
-        pendingTaskDelay = pendingTask->timestamp - currentTime;
-    } else {
-        pendingTaskDelay = INT32_MAX;
+    // Search the idle worker list for the next worker with pending
+    // work, wrapping around to the start of the list if required.
+    if (idleWorker == NULL) {
+        idleWorker = schedulerState.idleWorkers;
+        if (idleWorker == NULL) {
+            return false;
+        }
     }
-    return pendingTaskDelay;
+    firstWorker = idleWorker;
+    while (!idleWorker->workPending) {
+        idleWorker = idleWorker->nextWorker;
+        if (idleWorker == NULL) {
+            idleWorker = schedulerState.idleWorkers;
+        }
+        if (idleWorker == firstWorker) {
+            return false;
+        }
+    }
+
+    // Run the selected idle worker within the available budget.
+    budget = GMOS_MS_TO_TICKS (GMOS_CONFIG_SCHEDULER_IDLE_WORK_BUDGET);
+    if (budget > idleTime) {
+        budget = idleTime;
+    }
+    schedulerState.nextIdleWorker = idleWorker->nextWorker;
+    idleWorker->workPending =
+        idleWorker->workerFn (idleWorker->workerData, budget);
+    return true;
 }
 
 /*
@@ -219,13 +978,47 @@ void gmosSchedulerStart (void)
 uint32_t gmosSchedulerStep (void)
 {
     uint32_t execDelay = 0;
+    uint32_t currentTime;
+    uint32_t backgroundTime;
     gmosTaskState_t* queuedTask;
+#if GMOS_CONFIG_HOST_OS_SUPPORT
+    bool hostOsUnlock = false;
+#endif
 
     // Lock out host operating system access while the scheduler is
-    // active.
-    if (GMOS_CONFIG_HOST_OS_SUPPORT) {
+    // active. The lock is held over a batch of active scheduler steps,
+    // so it is only claimed at the start of each new batch. Nested
+    // scheduler steps that are run by busy waiting tasks always run
+    // with the lock held by the outermost scheduler step.
+#if GMOS_CONFIG_HOST_OS_SUPPORT
+    schedulerState.hostOsStepDepth += 1;
+    if ((schedulerState.hostOsStepDepth == 1) &&
+        (!schedulerState.hostOsLocked)) {
         while (!gmosPalHostOsMutexLock (0xFFFF)) {};
+        schedulerState.hostOsLocked = true;
+        schedulerState.hostOsBatchCount = 0;
+        schedulerState.hostOsBatchStartTime = gmosPalGetTimer ();
+    }
+#endif
+
+    // Record the end of any previous idle period in the trace buffer.
+    if (schedulerState.schedulerIdle) {
+        GMOS_TRACE (GMOS_TRACE_IDLE_EXIT, NULL, 0);
+    }
+
+    // Run any deferred calls that have been posted by interrupt service
+    // routines or other processor cores. These may notify event
+    // consumer tasks, so they are run before processing the event
+    // queue. The standard deferred call queues are always processed by
+    // core zero.
+#if (GMOS_CONFIG_DEFERRED_CALL_QUEUES > 0)
+    if (GMOS_PAL_CORE_ID == 0) {
+        gmosDeferredCallProcess ();
     }
+#endif
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+    gmosInstanceCoreCallProcess ();
+#endif
 
     // Process waiting event consumer tasks, marking them ready to run.
     queuedTask = gmosEventGetNextConsumer ();
@@ -238,49 +1031,157 @@ uint32_t gmosSchedulerStep (void)
         queuedTask = gmosEventGetNextConsumer ();
     }
 
-    // Process scheduled tasks, marking them ready to run if required.
-    queuedTask = gmosSchedulerGetPendingTask (&scheduledTasks);
-    while (queuedTask != NULL) {
-        gmosSchedulerMakeTaskReady (queuedTask);
-        queuedTask = gmosSchedulerGetPendingTask (&scheduledTasks);
+    // Process scheduled and background tasks, marking them ready to run
+    // if required. On the first step after an idle period, background
+    // tasks that are due within the timer slack window are merged with
+    // the current wakeup.
+    currentTime = gmosPalGetTimer ();
+    backgroundTime = currentTime;
+    if (schedulerState.schedulerIdle) {
+        backgroundTime += GMOS_CONFIG_SCHEDULER_TIMER_SLACK;
+        schedulerState.schedulerIdle = false;
     }
+    gmosSchedulerQueueProcess (
+        &schedulerState.scheduledTasks, currentTime);
+    gmosSchedulerQueueProcess (
+        &schedulerState.backgroundTasks, backgroundTime);
 
-    // Process background tasks, marking them ready to run if required.
-    queuedTask = gmosSchedulerGetPendingTask (&backgroundTasks);
-    while (queuedTask != NULL) {
-        gmosSchedulerMakeTaskReady (queuedTask);
-        queuedTask = gmosSchedulerGetPendingTask (&backgroundTasks);
+    // Periodically write the profiling statistics to the debug log.
+#if GMOS_CONFIG_SCHEDULER_PROFILING && \
+    (GMOS_CONFIG_SCHEDULER_PROFILING_LOG_INTERVAL > 0)
+    if (((int32_t)
+        (currentTime - schedulerState.nextStatsLogTime)) >= 0) {
+        schedulerState.nextStatsLogTime = currentTime +
+            GMOS_MS_TO_TICKS (
+                1000 * GMOS_CONFIG_SCHEDULER_PROFILING_LOG_INTERVAL);
+        gmosSchedulerLogStats ();
     }
+#endif
 
     // Run the next task in the ready task queue.
-    if (readyTaskListHead != NULL) {
+    queuedTask = gmosSchedulerGetReadyTask ();
+    if (queuedTask != NULL) {
         gmosTaskStatus_t taskStatus;
+#if GMOS_CONFIG_SCHEDULER_PROFILING || \
+    GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+        uint32_t runCycles;
+#endif
+#if GMOS_CONFIG_SCHEDULER_PROFILING
+        uint32_t lateTicks;
+        int32_t lateness;
 
-        // Pop the next task from the head of the ready task list.
-        currentTask = readyTaskListHead;
-        readyTaskListHead = currentTask->nextTask;
+        // Derive the scheduling latency, ignoring any tasks which
+        // became ready after the current time was sampled.
+        lateness = (int32_t)
+            (currentTime - ((uint32_t) queuedTask->timestamp));
+        lateTicks = (lateness < 0) ? 0 : (uint32_t) lateness;
+#endif
+#if GMOS_CONFIG_SCHEDULER_PROFILING || \
+    GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+        runCycles = gmosPalGetCycleCount ();
+#endif
+        schedulerState.currentTask = queuedTask;
+
+        // Record the first task to run after a wakeup.
+#if GMOS_CONFIG_POWER_RESIDENCY
+        gmosPowerTaskRun (queuedTask);
+#endif
 
         // Mark the task as active during execution.
-        currentTask->taskState = TASK_STATE_ACTIVE;
-        taskStatus = currentTask->taskTickFn (currentTask->taskData);
+        queuedTask->taskState = TASK_STATE_ACTIVE;
+        GMOS_TRACE (GMOS_TRACE_TASK_START, queuedTask, 0);
+        taskStatus = queuedTask->taskTickFn (queuedTask->taskData);
+        GMOS_TRACE (GMOS_TRACE_TASK_STOP, queuedTask, taskStatus);
+
+        // Update the profiling statistics for the task.
+#if GMOS_CONFIG_SCHEDULER_PROFILING || \
+    GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+        runCycles = gmosPalGetCycleCount () - runCycles;
+#endif
+#if GMOS_CONFIG_SCHEDULER_PROFILING
+        gmosSchedulerUpdateStats (queuedTask, runCycles, lateTicks);
+#endif
 
         // Place the task back in the appropriate task list.
-        gmosSchedulerInsertTask (currentTask, taskStatus);
-        currentTask = NULL;
+        gmosSchedulerInsertTask (queuedTask, taskStatus);
+        schedulerState.currentTask = NULL;
+
+        // Check the task execution time against its budget. This is
+        // done after the task has been requeued, so that the task
+        // state is consistent if the scheduler watchdog is triggered.
+#if GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+        gmosSchedulerCheckBudget (queuedTask, runCycles);
+#endif
     }
 
     // Calculate the idle period if no tasks are ready. Implement busy
     // waiting if one or more scheduler stay awake requests are
-    // currently active.
-    else if (stayAwakeCounter == 0) {
-        int32_t delay = gmosSchedulerGetPendingTaskDelay (&scheduledTasks);
+    // currently active. The idle period is extended to the latest
+    // scheduled task deadline in the timer slack window, so that all
+    // the scheduled tasks in the window will be run after a single
+    // wakeup.
+    else if (schedulerState.stayAwakeCounter == 0) {
+        uint32_t idleTime = gmosPalGetTimer ();
+        int32_t delay = gmosSchedulerQueueDelay (
+            &schedulerState.scheduledTasks, idleTime);
+#if (GMOS_CONFIG_SCHEDULER_TIMER_SLACK > 0)
+        if ((delay > 0) &&
+            (delay <= INT32_MAX - GMOS_CONFIG_SCHEDULER_TIMER_SLACK)) {
+            delay = gmosSchedulerQueueCoalesce (
+                &schedulerState.scheduledTasks, idleTime, delay);
+        }
+#endif
         execDelay = (delay < 0) ? 0 : (uint32_t) delay;
+
+        // Run pending idle work instead of entering the idle state if
+        // the idle period is long enough. The scheduler will then be
+        // stepped again immediately.
+        if ((execDelay >= GMOS_MS_TO_TICKS (
+            GMOS_CONFIG_SCHEDULER_IDLE_WORK_MIN_TIME)) &&
+            gmosSchedulerRunIdleWorker (execDelay)) {
+            execDelay = 0;
+        }
     }
 
-    // Allow host operating system access while the scheduler is idle.
-    if (GMOS_CONFIG_HOST_OS_SUPPORT) {
+    // Record the start of an idle period in the trace buffer.
+    if (execDelay > 0) {
+        schedulerState.schedulerIdle = true;
+        GMOS_TRACE (GMOS_TRACE_IDLE_ENTER, NULL, execDelay);
+#if GMOS_CONFIG_POWER_RESIDENCY
+        gmosPowerIdleRequest (execDelay);
+#endif
+    }
+
+    // Allow host operating system access while the scheduler is idle
+    // or when the current batch of active scheduler steps has reached
+    // its step count or time limit. Nested scheduler steps never
+    // release the lock, since it is still required by the outermost
+    // scheduler step on return.
+#if GMOS_CONFIG_HOST_OS_SUPPORT
+    schedulerState.hostOsStepDepth -= 1;
+    if (schedulerState.hostOsStepDepth > 0) {
+        return execDelay;
+    }
+    schedulerState.hostOsBatchCount += 1;
+    if (execDelay > 0) {
+        hostOsUnlock = true;
+    } else if (schedulerState.hostOsBatchCount >=
+        GMOS_CONFIG_HOST_OS_LOCK_BATCH_SIZE) {
+        hostOsUnlock = true;
+    }
+#if (GMOS_CONFIG_HOST_OS_LOCK_BATCH_TIME > 0)
+    else {
+        uint32_t batchTime = gmosPalGetTimer () -
+            schedulerState.hostOsBatchStartTime;
+        hostOsUnlock = (batchTime >= GMOS_MS_TO_TICKS (
+            GMOS_CONFIG_HOST_OS_LOCK_BATCH_TIME)) ? true : false;
+    }
+#endif
+    if (hostOsUnlock && schedulerState.hostOsLocked) {
+        schedulerState.hostOsLocked = false;
         gmosPalHostOsMutexUnlock ();
     }
+#endif
     return execDelay;
 }
 
@@ -289,15 +1190,99 @@ uint32_t gmosSchedulerStep (void)
  */
 void gmosSchedulerTaskStart (gmosTaskState_t* newTask)
 {
+#if GMOS_CONFIG_SCHEDULER_PROFILING
+    gmosTaskState_t* startedTask = schedulerState.startedTaskList;
+
+    // Add the task to the list of started tasks and reset the profiling
+    // statistics. Tasks which are restarted are only added once.
+    while ((startedTask != NULL) && (startedTask != newTask)) {
+        startedTask = startedTask->nextStartedTask;
+    }
+    if (startedTask == NULL) {
+        newTask->nextStartedTask = schedulerState.startedTaskList;
+        schedulerState.startedTaskList = newTask;
+    }
+    newTask->taskStats = (gmosTaskStats_t) { 0 };
+    newTask->taskState = TASK_STATE_INITIALISING;
+#endif
+
+#if (GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS > 1)
+    newTask->taskPriority = GMOS_TASK_PRIORITY_DEFAULT;
+#endif
+#if GMOS_CONFIG_INSTANCE_SUPPORT
+    newTask->taskInstance = GMOS_INSTANCE_CURRENT;
+#endif
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+    newTask->taskCore = GMOS_PAL_CORE_ID;
+    newTask->resumePosted = false;
+#endif
+#if GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+    newTask->budgetCycles = gmosSchedulerBudgetCycles (
+        GMOS_CONFIG_SCHEDULER_TASK_BUDGET_DEFAULT);
+    newTask->overrunCount = 0;
+    newTask->overrunStreak = 0;
+#endif
+#if GMOS_CONFIG_POWER_RESIDENCY
+    newTask->wakeCount = 0;
+#endif
+#if GMOS_CONFIG_MEMPOOL_TELEMETRY
+    newTask->mempoolOwner = GMOS_MEMPOOL_OWNER_OTHER;
+#endif
     gmosSchedulerMakeTaskReady (newTask);
 }
 
+/*
+ * Implements the handler for task resume requests that have been
+ * posted from other processor cores. This runs on the core that owns
+ * the resumed task.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+static void gmosSchedulerTaskResumeHandler (void* callData)
+{
+    gmosTaskState_t* resumedTask = (gmosTaskState_t*) callData;
+    resumedTask->resumePosted = false;
+    gmosSchedulerTaskResume (resumedTask);
+}
+#endif
+
 /*
  * Resumes scheduling of a suspended or delayed task, making it ready
- * for scheduler execution.
+ * for scheduler execution. When multiple scheduler cores are
+ * configured, tasks that run on other cores are resumed by posting a
+ * resume request to the core that runs the task. At most one request
+ * is outstanding for each task at any given time. For single core
+ * instance support, tasks that run on other instances are resumed by
+ * temporarily selecting the instance that runs the task.
  */
 void gmosSchedulerTaskResume (gmosTaskState_t* resumedTask)
 {
+#if GMOS_CONFIG_INSTANCE_SUPPORT && (GMOS_CONFIG_SCHEDULER_CORES == 1)
+    gmosInstance_t* currentInstance = GMOS_INSTANCE_CURRENT;
+    if ((resumedTask->taskInstance != NULL) &&
+        (resumedTask->taskInstance != currentInstance)) {
+        gmosInstanceSelect (resumedTask->taskInstance);
+        gmosSchedulerTaskResume (resumedTask);
+        gmosInstanceSelect (currentInstance);
+        return;
+    }
+#endif
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+    if (resumedTask->taskCore != GMOS_PAL_CORE_ID) {
+        bool postRequest;
+        gmosPalMutexLock ();
+        postRequest = !resumedTask->resumePosted;
+        resumedTask->resumePosted = true;
+        gmosPalMutexUnlock ();
+        if (postRequest) {
+            bool postOk = gmosInstanceCoreCallPost (
+                resumedTask->taskCore, gmosSchedulerTaskResumeHandler,
+                resumedTask);
+            GMOS_ASSERT (ASSERT_FAILURE, postOk,
+                "Failed to post cross-core task resume request.");
+        }
+        return;
+    }
+#endif
     if ((resumedTask->taskState != TASK_STATE_READY) &&
         (resumedTask->taskState != TASK_STATE_ACTIVE)) {
         gmosSchedulerRemoveTask (resumedTask);
@@ -305,26 +1290,89 @@ void gmosSchedulerTaskResume (gmosTaskState_t* resumedTask)
     }
 }
 
+/*
+ * Sets the scheduling priority level for a task.
+ */
+void gmosSchedulerTaskSetPriority (
+    gmosTaskState_t* task, uint8_t taskPriority)
+{
+#if (GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS > 1)
+    if (taskPriority > GMOS_TASK_PRIORITY_LOWEST) {
+        taskPriority = GMOS_TASK_PRIORITY_LOWEST;
+    }
+
+    // Tasks that are already in a ready task list remain in that list,
+    // so the new priority level is applied when they are next queued.
+    task->taskPriority = taskPriority;
+#endif
+}
+
+/*
+ * Sets the execution budget for a task.
+ */
+void gmosSchedulerTaskSetBudget (
+    gmosTaskState_t* task, uint32_t budgetMicros)
+{
+#if GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+    task->budgetCycles = gmosSchedulerBudgetCycles (budgetMicros);
+    task->overrunStreak = 0;
+#endif
+}
+
 /*
  * Places the current task in a busy wait state, which allows other
  * scheduled tasks to execute while holding the state of the current
  * task on the call stack.
  */
-void gmosSchedulerTaskBusyWait (void)
+uint32_t gmosSchedulerTaskBusyWait (void)
 {
     gmosTaskState_t* idleTask;
+    uint32_t execDelay;
 
     // Set the current task to busy waiting.
-    currentTask->taskState = TASK_STATE_BUSY_WAIT;
-    idleTask = currentTask;
-    currentTask = NULL;
+    schedulerState.currentTask->taskState = TASK_STATE_BUSY_WAIT;
+    idleTask = schedulerState.currentTask;
+    schedulerState.currentTask = NULL;
 
     // Perform a single scheduler processing step.
-    gmosSchedulerStep ();
+    execDelay = gmosSchedulerStep ();
 
     // Set the busy waiting task to active.
-    currentTask = idleTask;
-    currentTask->taskState = TASK_STATE_ACTIVE;
+    schedulerState.currentTask = idleTask;
+    schedulerState.currentTask->taskState = TASK_STATE_ACTIVE;
+    return execDelay;
+}
+
+/*
+ * Places the device in the idle state while the current task is busy
+ * waiting. The host OS mutex is held by the outermost scheduler step
+ * during busy waits, so it is released for the duration of the idle
+ * period and then claimed again before returning to the waiting task.
+ */
+void gmosSchedulerTaskBusyIdle (uint32_t idleTime)
+{
+#if GMOS_CONFIG_HOST_OS_SUPPORT
+    bool hostOsRelock = schedulerState.hostOsLocked;
+
+    if (hostOsRelock) {
+        schedulerState.hostOsLocked = false;
+        gmosPalHostOsMutexUnlock ();
+    }
+#endif
+
+    // Enter the platform idle state.
+    gmosPalIdle (idleTime);
+
+    // Claim the host OS mutex again, starting a new batch of active
+    // scheduler steps.
+#if GMOS_CONFIG_HOST_OS_SUPPORT
+    if (hostOsRelock) {
+        while (!gmosPalHostOsMutexLock (0xFFFF)) {};
+        schedulerState.hostOsLocked = true;
+        schedulerState.hostOsBatchCount = 0;
+        schedulerState.hostOsBatchStartTime = gmosPalGetTimer ();
+    }
+#endif
 }
 
 /*
@@ -332,9 +1380,10 @@ void gmosSchedulerTaskBusyWait (void)
  */
 void gmosSchedulerStayAwake (void)
 {
-    GMOS_ASSERT (ASSERT_FAILURE, (stayAwakeCounter < UINT32_MAX),
+    GMOS_ASSERT (ASSERT_FAILURE,
+        (schedulerState.stayAwakeCounter < UINT32_MAX),
         "Scheduler wake counter overflow detected");
-    stayAwakeCounter += 1;
+    schedulerState.stayAwakeCounter += 1;
 }
 
 /*
@@ -342,9 +1391,9 @@ void gmosSchedulerStayAwake (void)
  */
 void gmosSchedulerCanSleep (void)
 {
-    GMOS_ASSERT (ASSERT_FAILURE, (stayAwakeCounter > 0),
+    GMOS_ASSERT (ASSERT_FAILURE, (schedulerState.stayAwakeCounter > 0),
         "Scheduler wake counter underflow detected");
-    stayAwakeCounter -= 1;
+    schedulerState.stayAwakeCounter -= 1;
 }
 
 /*
@@ -352,7 +1401,7 @@ void gmosSchedulerCanSleep (void)
  */
 gmosTaskState_t* gmosSchedulerCurrentTask (void)
 {
-    return currentTask;
+    return schedulerState.currentTask;
 }
 
 /*
@@ -383,6 +1432,103 @@ gmosTaskStatus_t gmosSchedulerPrioritise (
     return (taskStatusA < taskStatusB) ? taskStatusA : taskStatusB;
 }
 
+#if GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+
+/*
+ * Accesses the total number of execution budget overruns for a task.
+ */
+uint32_t gmosSchedulerTaskGetOverruns (gmosTaskState_t* task)
+{
+    return task->overrunCount;
+}
+
+/*
+ * Accesses the scheduler execution budget overrun statistics.
+ */
+void gmosSchedulerGetOverrunStats (
+    gmosSchedulerOverrunStats_t* overrunStats)
+{
+    *overrunStats = schedulerState.overrunStats;
+}
+
+/*
+ * Sets the scheduler watchdog handler.
+ */
+void gmosSchedulerSetWatchdog (gmosSchedulerWatchdogFn_t watchdogFn)
+{
+    schedulerState.watchdogFn = watchdogFn;
+}
+
+#endif // GMOS_CONFIG_SCHEDULER_TASK_BUDGET
+
+#if GMOS_CONFIG_SCHEDULER_PROFILING
+
+/*
+ * Iterates over the list of started tasks, accessing the profiling
+ * statistics for each task in turn.
+ */
+bool gmosSchedulerGetStats (
+    gmosTaskState_t** taskIterator, gmosTaskStats_t* taskStats)
+{
+    gmosTaskState_t* nextTask;
+
+    // Select the next task in the started task list.
+    if (*taskIterator == NULL) {
+        nextTask = schedulerState.startedTaskList;
+    } else {
+        nextTask = (*taskIterator)->nextStartedTask;
+    }
+    if (nextTask == NULL) {
+        return false;
+    }
+
+    // Copy the task statistics.
+    *taskStats = nextTask->taskStats;
+    *taskIterator = nextTask;
+    return true;
+}
+
+/*
+ * Writes the profiling statistics for all started tasks to the debug
+ * log. Execution times are converted to microseconds.
+ */
+void gmosSchedulerLogStats (void)
+{
+    gmosTaskState_t* taskIterator = NULL;
+    gmosTaskStats_t taskStats;
+    const char* taskName;
+    uint32_t meanRunTime;
+    uint32_t maxRunTime;
+    uint32_t meanLateTime;
+    uint32_t maxLateTime;
+
+    GMOS_LOG (LOG_INFO, "Scheduler task profiling statistics:");
+    while (gmosSchedulerGetStats (&taskIterator, &taskStats)) {
+        taskName = (taskIterator->taskName != NULL) ?
+            taskIterator->taskName : "<unnamed>";
+        if (taskStats.runCount == 0) {
+            meanRunTime = 0;
+            meanLateTime = 0;
+        } else {
+            meanRunTime = (uint32_t) (((taskStats.runCycles /
+                taskStats.runCount) * 1000000) /
+                GMOS_CONFIG_PAL_CYCLE_COUNTER_FREQUENCY);
+            meanLateTime = GMOS_TICKS_TO_MS (
+                taskStats.lateTicks / taskStats.runCount);
+        }
+        maxRunTime = (uint32_t) ((taskStats.maxRunCycles *
+            (uint64_t) 1000000) / GMOS_CONFIG_PAL_CYCLE_COUNTER_FREQUENCY);
+        maxLateTime = GMOS_TICKS_TO_MS (taskStats.maxLateTicks);
+        GMOS_LOG_FMT (LOG_INFO,
+            "  %s : runs %ld, mean %ldus, max %ldus, "
+            "latency mean %ldms, max %ldms", taskName,
+            (long) taskStats.runCount, (long) meanRunTime,
+            (long) maxRunTime, (long) meanLateTime, (long) maxLateTime);
+    }
+}
+
+#endif // GMOS_CONFIG_SCHEDULER_PROFILING
+
 /*
  * Adds a scheduler lifecycle monitor to receive notifications of
  * scheduler lifecycle management events. The new monitor is added to
@@ -392,8 +1538,30 @@ void gmosLifecycleAddMonitor (gmosLifecycleMonitor_t* lifecycleMonitor,
     bool (*handlerFunction) (gmosLifecycleStatus_t))
 {
     lifecycleMonitor->handlerFn = handlerFunction;
-    lifecycleMonitor->nextMonitor = lifecycleMonitors;
-    lifecycleMonitors = lifecycleMonitor;
+    lifecycleMonitor->nextMonitor = schedulerState.lifecycleMonitors;
+    schedulerState.lifecycleMonitors = lifecycleMonitor;
+}
+
+/*
+ * Adds an idle worker to the scheduler. The new idle worker is added to
+ * the head of the list.
+ */
+void gmosSchedulerIdleWorkerAdd (gmosIdleWorker_t* idleWorker,
+    bool (*workerFunction) (void*, uint32_t), void* workerData)
+{
+    idleWorker->workerFn = workerFunction;
+    idleWorker->workerData = workerData;
+    idleWorker->workPending = true;
+    idleWorker->nextWorker = schedulerState.idleWorkers;
+    schedulerState.idleWorkers = idleWorker;
+}
+
+/*
+ * Indicates that an idle worker has pending work.
+ */
+void gmosSchedulerIdleWorkerRequest (gmosIdleWorker_t* idleWorker)
+{
+    idleWorker->workPending = true;
 }
 
 /*
@@ -405,7 +1573,8 @@ bool gmosLifecycleNotify
     (gmosLifecycleStatus_t lifecycleStatus)
 {
     bool retVal = true;
-    gmosLifecycleMonitor_t* currentMonitor = lifecycleMonitors;
+    gmosLifecycleMonitor_t* currentMonitor =
+        schedulerState.lifecycleMonitors;
     while (currentMonitor != NULL) {
         retVal &= currentMonitor->handlerFn (lifecycleStatus);
         currentMonitor = currentMonitor->nextMonitor;
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2025 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,6 +28,8 @@
 #include "gmos-scheduler.h"
 #include "gmos-mempool.h"
 #include "gmos-streams.h"
+#include "gmos-trace.h"
+#include "gmos-profile.h"
 
 // Use the standard 'memcpy' function for stream data transfer.
 #if GMOS_CONFIG_STREAMS_USE_MEMCPY
@@ -62,6 +64,22 @@ static gmosMempoolSegment_t* gmosStreamSegmentListEnd (gmosStream_t* stream)
     return segment;
 }
 
+/*
+ * Gets the size of the final memory pool segment in the segment list.
+ * This will always be the standard segment size unless large memory
+ * pool segments are in use.
+ */
+static inline uint_fast16_t gmosStreamSegmentListEndSize (
+    gmosStream_t* stream)
+{
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    return gmosMempoolGetSegmentSize (gmosStreamSegmentListEnd (stream));
+#else
+    (void) stream;
+    return GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
+#endif
+}
+
 /*
  * Performs a one-time initialisation of a GubbinsMOS byte stream. This
  * should be called during initialisation to set up the byte stream for
@@ -115,12 +133,13 @@ uint16_t gmosStreamGetWriteCapacity (gmosStream_t* stream)
     if (stream->segmentList == NULL) {
         maxFreeBytes = 0;
     } else {
-        maxFreeBytes = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE -
+        maxFreeBytes = gmosStreamSegmentListEndSize (stream) -
             stream->writeOffset;
     }
 
     // The number of free bytes is increased by the number of available
-    // memory pool segments.
+    // memory pool segments. Any free large segments are not included,
+    // so this is a conservative estimate when they are in use.
     maxFreeBytes += GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE *
         ((uint32_t) gmosMempoolSegmentsAvailable ());
 
@@ -158,7 +177,8 @@ uint16_t gmosStreamGetPushBackCapacity (gmosStream_t* stream)
     }
 
     // The number of free bytes is increased by the number of available
-    // memory pool segments.
+    // memory pool segments. Any free large segments are not included,
+    // so this is a conservative estimate when they are in use.
     maxFreeBytes += GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE *
         ((uint32_t) gmosMempoolSegmentsAvailable ());
 
@@ -183,50 +203,53 @@ static void gmosStreamCommonWrite (gmosStream_t* stream,
     uint_fast16_t copySize;
     uint8_t* copyPtr;
     gmosMempoolSegment_t* segment;
+    GMOS_PROFILE_BEGIN (GMOS_PROFILE_ID_STREAM_WRITE);
 
-    // Allocate a new segment if the stream is empty, otherwise select
-    // the end of the segment list.
+    // Allocate new segments for all the write data if the stream is
+    // empty. Otherwise select the end of the segment list and allocate
+    // new segments for any data that does not fit in the final
+    // segment. Allocating all the segments together allows large
+    // memory pool segments to be used for bulk writes.
     if (stream->segmentList == NULL) {
-        segment = gmosMempoolAlloc ();
-        segment->nextSegment = NULL;
+        segment = gmosMempoolAllocCapacity (writeSize);
         stream->segmentList = segment;
         stream->size = 0;
         stream->writeOffset = 0;
         stream->readOffset = 0;
     } else {
         segment = gmosStreamSegmentListEnd (stream);
+        copySize = gmosMempoolGetSegmentSize (segment) -
+            stream->writeOffset;
+        if (writeSize > copySize) {
+            segment->nextSegment =
+                gmosMempoolAllocCapacity (writeSize - copySize);
+        }
     }
 
-    // Write data into the initial segment if there is space.
-    copySize = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE - stream->writeOffset;
-    if (writeSize < copySize) {
-        copySize = writeSize;
-    }
-    if (copySize > 0) {
+    // Write data into successive segments, starting with any space in
+    // the initial segment.
+    while (true) {
+        copySize = gmosMempoolGetSegmentSize (segment) -
+            stream->writeOffset;
+        if (remainingBytes < copySize) {
+            copySize = remainingBytes;
+        }
         copyPtr = segment->data.bytes + stream->writeOffset;
         STREAM_COPY (copyPtr, sourcePtr, copySize);
         remainingBytes -= copySize;
         sourcePtr += copySize;
         stream->writeOffset += copySize;
         stream->size += copySize;
-    }
 
-    // Write data into subsequent newly allocated segments.
-    while (remainingBytes > 0) {
-        segment->nextSegment = gmosMempoolAlloc ();
-        segment = segment->nextSegment;
-        segment->nextSegment = NULL;
-        copySize = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
-        if (remainingBytes < copySize) {
-            copySize = remainingBytes;
+        // Select the next newly allocated segment if required.
+        if (remainingBytes == 0) {
+            break;
         }
-        copyPtr = segment->data.bytes;
-        STREAM_COPY (copyPtr, sourcePtr, copySize);
-        remainingBytes -= copySize;
-        sourcePtr += copySize;
-        stream->writeOffset = copySize;
-        stream->size += copySize;
+        segment = segment->nextSegment;
+        stream->writeOffset = 0;
     }
+    GMOS_PROFILE_END (GMOS_PROFILE_ID_STREAM_WRITE);
+    GMOS_TRACE (GMOS_TRACE_STREAM_WRITE, stream, writeSize);
 
     // Reschedule the suspended consumer task if required.
     if (stream->consumerTask != NULL) {
@@ -327,7 +350,7 @@ bool gmosStreamWriteByte (gmosStream_t* stream, uint8_t writeByte)
     }
 
     // Append a new segment to the segment list if required.
-    if (stream->writeOffset == GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) {
+    if (stream->writeOffset == gmosMempoolGetSegmentSize (segment)) {
         segment->nextSegment = gmosMempoolAlloc ();
         segment = segment->nextSegment;
         segment->nextSegment = NULL;
@@ -339,6 +362,7 @@ bool gmosStreamWriteByte (gmosStream_t* stream, uint8_t writeByte)
     *writePtr = writeByte;
     stream->writeOffset += 1;
     stream->size += 1;
+    GMOS_TRACE (GMOS_TRACE_STREAM_WRITE, stream, 1);
 
     // Reschedule the suspended consumer task if required.
     if (stream->consumerTask != NULL) {
@@ -363,7 +387,8 @@ static void gmosStreamCommonRead (gmosStream_t* stream,
 
     // Iterate from the start of the segment list.
     while (remainingBytes > 0) {
-        copySize = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE - stream->readOffset;
+        copySize = gmosMempoolGetSegmentSize (segment) -
+            stream->readOffset;
         if (remainingBytes < copySize) {
             copySize = remainingBytes;
         }
@@ -377,7 +402,8 @@ static void gmosStreamCommonRead (gmosStream_t* stream,
         // Release the current memory pool segment if required. If this
         // is the last segment, the segment list will take the null
         // reference from the next segment pointer.
-        if ((stream->readOffset == GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) ||
+        if ((stream->readOffset ==
+            gmosMempoolGetSegmentSize (segment)) ||
             (stream->size == 0)) {
             stream->segmentList = segment->nextSegment;
             stream->readOffset = 0;
@@ -385,6 +411,7 @@ static void gmosStreamCommonRead (gmosStream_t* stream,
             segment = stream->segmentList;
         }
     }
+    GMOS_TRACE (GMOS_TRACE_STREAM_READ, stream, readSize);
 }
 
 /*
@@ -487,11 +514,12 @@ bool gmosStreamReadByte (gmosStream_t* stream, uint8_t* readByte)
     *readByte = *readPtr;
     stream->readOffset += 1;
     stream->size -= 1;
+    GMOS_TRACE (GMOS_TRACE_STREAM_READ, stream, 1);
 
     // Release the current memory pool segment if required. If this is
     // the last segment, the segment list will take the null reference
     // from the next segment pointer.
-    if ((stream->readOffset == GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) ||
+    if ((stream->readOffset == gmosMempoolGetSegmentSize (segment)) ||
         (stream->size == 0)) {
         stream->segmentList = segment->nextSegment;
         stream->readOffset = 0;
@@ -508,6 +536,7 @@ bool gmosStreamPeekByte (gmosStream_t* stream,
     uint8_t* peekByte, uint16_t offset)
 {
     uint_fast16_t residualOffset;
+    uint_fast16_t segmentSize;
     gmosMempoolSegment_t* segment;
 
     // Determine if there is data available.
@@ -520,13 +549,15 @@ bool gmosStreamPeekByte (gmosStream_t* stream,
     segment = stream->segmentList;
 
     // Search for the memory segment containing the data.
-    while (residualOffset >= GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) {
-        residualOffset -= GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
+    segmentSize = gmosMempoolGetSegmentSize (segment);
+    while (residualOffset >= segmentSize) {
+        residualOffset -= segmentSize;
         segment = segment->nextSegment;
+        segmentSize = gmosMempoolGetSegmentSize (segment);
     }
 
     // Copy the data from the selected memory segment.
-    *peekByte = segment->data.bytes [residualOffset];
+    *peekByte = *(segment->data.bytes + residualOffset);
     return true;
 }
 
@@ -559,8 +590,8 @@ bool gmosStreamPushBack (gmosStream_t* stream,
         segment->nextSegment = NULL;
         stream->segmentList = segment;
         stream->size = 0;
-        stream->writeOffset = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
-        stream->readOffset = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
+        stream->writeOffset = gmosMempoolGetSegmentSize (segment);
+        stream->readOffset = stream->writeOffset;
     } else {
         segment = stream->segmentList;
     }
@@ -585,12 +616,12 @@ bool gmosStreamPushBack (gmosStream_t* stream,
         stream->segmentList = gmosMempoolAlloc ();
         stream->segmentList->nextSegment = segment;
         segment = stream->segmentList;
-        copySize = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
+        copySize = gmosMempoolGetSegmentSize (segment);
         if (remainingBytes < copySize) {
             copySize = remainingBytes;
         }
         sourcePtr -= copySize;
-        copyOffset = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE - copySize;
+        copyOffset = gmosMempoolGetSegmentSize (segment) - copySize;
         copyPtr = segment->data.bytes + copyOffset;
         STREAM_COPY (copyPtr, sourcePtr, copySize);
         remainingBytes -= copySize;
@@ -0,0 +1,190 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements the GubbinsMOS callback timers using a single sorted list
+ * of active timers that is serviced by a shared timer task.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gmos-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-timers.h"
+#include "gmos-instance.h"
+
+// Specifies the callback timer state. This is either allocated
+// statically or selected from the current GubbinsMOS instance.
+#if GMOS_CONFIG_INSTANCE_SUPPORT
+#define timerState (GMOS_INSTANCE_CURRENT->timerState)
+#else
+static gmosTimerState_t timerState;
+#endif
+
+/*
+ * Inserts a timer into the active timer list, after any other timers
+ * with the same expiry time.
+ */
+static void gmosTimerInsert (gmosTimer_t* timer)
+{
+    gmosTimer_t** timerPtr = &(timerState.activeTimers);
+
+    while ((*timerPtr != NULL) && (((int32_t)
+        (timer->expiryTime - (*timerPtr)->expiryTime)) >= 0)) {
+        timerPtr = &((*timerPtr)->nextTimer);
+    }
+    timer->nextTimer = *timerPtr;
+    *timerPtr = timer;
+}
+
+/*
+ * Removes a timer from the active timer list.
+ */
+static void gmosTimerRemove (gmosTimer_t* timer)
+{
+    gmosTimer_t** timerPtr = &(timerState.activeTimers);
+
+    while (*timerPtr != NULL) {
+        if (*timerPtr == timer) {
+            *timerPtr = timer->nextTimer;
+            break;
+        }
+        timerPtr = &((*timerPtr)->nextTimer);
+    }
+    timer->nextTimer = timer;
+}
+
+/*
+ * Implements the shared timer task, which runs the callback functions
+ * for all expired timers and then reschedules itself for the next
+ * timer expiry time.
+ */
+static gmosTaskStatus_t gmosTimerTaskFn (void* nullData)
+{
+    gmosTimer_t* timer;
+    uint32_t currentTime = gmosPalGetTimer ();
+    int32_t delay;
+    (void) nullData;
+
+    while (timerState.activeTimers != NULL) {
+        timer = timerState.activeTimers;
+        delay = (int32_t) (timer->expiryTime - currentTime);
+        if (delay > 0) {
+            return GMOS_TASK_RUN_LATER ((uint32_t) delay);
+        }
+
+        // Remove the expired timer from the active timer list. Periodic
+        // timers are requeued before running the callback, so that the
+        // callback may stop or restart the timer. Any missed periods
+        // are skipped if the timer task has been delayed.
+        timerState.activeTimers = timer->nextTimer;
+        timer->nextTimer = timer;
+        if (timer->timerPeriod != 0) {
+            timer->expiryTime += timer->timerPeriod;
+            if (((int32_t) (timer->expiryTime - currentTime)) <= 0) {
+                timer->expiryTime = currentTime + timer->timerPeriod;
+            }
+            gmosTimerInsert (timer);
+        }
+        timer->timerFn (timer->timerData);
+    }
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Adds a timer to the active timer list using the specified expiry
+ * time, starting or waking the shared timer task if required.
+ */
+static void gmosTimerSchedule (gmosTimer_t* timer, uint32_t expiryTime)
+{
+    gmosTaskState_t* timerTask = &(timerState.timerTask);
+
+    if (timer->nextTimer != timer) {
+        gmosTimerRemove (timer);
+    }
+    timer->expiryTime = expiryTime;
+    gmosTimerInsert (timer);
+
+    // Start the shared timer task on first use. Otherwise the timer
+    // task only needs to be resumed if the new timer is at the head of
+    // the active timer list.
+    if (!timerState.timerTaskStarted) {
+        timerTask->taskTickFn = gmosTimerTaskFn;
+        timerTask->taskData = NULL;
+        timerTask->taskName = GMOS_PLATFORM_STRING_WRAPPER ("Timers");
+        gmosSchedulerTaskStart (timerTask);
+        timerState.timerTaskStarted = true;
+    } else if (timerState.activeTimers == timer) {
+        gmosSchedulerTaskResume (timerTask);
+    }
+}
+
+/*
+ * Initialises a callback timer on startup.
+ */
+void gmosTimerInit (gmosTimer_t* timer,
+    gmosTimerFn_t timerFn, void* timerData)
+{
+    timer->timerFn = timerFn;
+    timer->timerData = timerData;
+    timer->nextTimer = timer;
+    timer->timerPeriod = 0;
+}
+
+/*
+ * Starts a one-shot callback timer.
+ */
+void gmosTimerStart (gmosTimer_t* timer, uint32_t delay)
+{
+    timer->timerPeriod = 0;
+    gmosTimerSchedule (timer, gmosPalGetTimer () + delay);
+}
+
+/*
+ * Starts a periodic callback timer.
+ */
+void gmosTimerStartPeriodic (gmosTimer_t* timer, uint32_t period)
+{
+    GMOS_ASSERT (ASSERT_ERROR, (period > 0),
+        "Periodic timers require a non-zero timer period.");
+    timer->timerPeriod = period;
+    gmosTimerSchedule (timer, gmosPalGetTimer () + period);
+}
+
+/*
+ * Stops a callback timer.
+ */
+bool gmosTimerStop (gmosTimer_t* timer)
+{
+    if (timer->nextTimer == timer) {
+        return false;
+    }
+    gmosTimerRemove (timer);
+    return true;
+}
+
+/*
+ * Determines whether a callback timer is currently running.
+ */
+bool gmosTimerIsRunning (gmosTimer_t* timer)
+{
+    return (timer->nextTimer != timer) ? true : false;
+}
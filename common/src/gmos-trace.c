@@ -0,0 +1,259 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements the GubbinsMOS timeline trace recorder.
+ */
+
+#include "gmos-config.h"
+
+// The trace recorder is only compiled if configured.
+#if GMOS_CONFIG_TRACE_ENABLE
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-instance.h"
+#include "gmos-trace.h"
+
+// Check that the trace buffer size is a power of two.
+#if ((GMOS_CONFIG_TRACE_BUFFER_SIZE & \
+    (GMOS_CONFIG_TRACE_BUFFER_SIZE - 1)) != 0)
+#error "The trace buffer size must be a power of two."
+#endif
+
+// Specifies the bit mask used to derive ring buffer indices.
+#define TRACE_BUFFER_MASK (GMOS_CONFIG_TRACE_BUFFER_SIZE - 1)
+
+// Trace records are claimed using an atomic increment of the record
+// count if the target supports lock free 32-bit atomic operations.
+// Otherwise the platform mutex is used to serialise trace records.
+#if defined (__GCC_ATOMIC_INT_LOCK_FREE) && \
+    (__GCC_ATOMIC_INT_LOCK_FREE == 2) && (__SIZEOF_INT__ == 4)
+#define TRACE_LOCK_FREE true
+#else
+#define TRACE_LOCK_FREE false
+#endif
+
+// Specifies the format used for object references in the trace dump.
+// Pointers that are wider than 32 bits are written as two 32-bit
+// values, since not all platform 'printf' implementations support
+// long long integers.
+#if (UINTPTR_MAX > UINT32_MAX)
+#define TRACE_OBJECT_FMT "%08lx%08lx"
+#define TRACE_OBJECT_ARGS(_object_)                                    \
+    (unsigned long) ((uint32_t) (((uintptr_t) (_object_)) >> 32)),    \
+    (unsigned long) ((uint32_t) ((uintptr_t) (_object_)))
+#else
+#define TRACE_OBJECT_FMT "%08lx"
+#define TRACE_OBJECT_ARGS(_object_)                                    \
+    (unsigned long) ((uint32_t) ((uintptr_t) (_object_)))
+#endif
+
+// Specifies the trace ring buffer for each processor core.
+static gmosTraceRecord_t traceBuffers
+    [GMOS_CONFIG_SCHEDULER_CORES] [GMOS_CONFIG_TRACE_BUFFER_SIZE];
+
+// Specifies the total number of trace records written on each
+// processor core. The ring buffer index is derived from the low order
+// bits.
+static uint32_t traceCounts [GMOS_CONFIG_SCHEDULER_CORES];
+
+// Specifies whether trace recording is currently enabled.
+static volatile bool traceEnabled = true;
+
+/*
+ * Adds a new record to the trace ring buffer for the current processor
+ * core. The caller must hold the platform mutex lock unless lock free
+ * trace recording is supported. Records written concurrently from
+ * different execution contexts on the same core may be placed in the
+ * trace buffer slightly out of timestamp order.
+ */
+void gmosTraceRecordLocked (uint8_t recordType,
+    const void* object, uint32_t value)
+{
+    uint8_t coreId = GMOS_PAL_CORE_ID;
+    gmosTraceRecord_t* record;
+    uint32_t recordIndex;
+
+    if (!traceEnabled) {
+        return;
+    }
+#if TRACE_LOCK_FREE
+    recordIndex = __atomic_fetch_add (
+        &(traceCounts [coreId]), 1, __ATOMIC_RELAXED);
+#else
+    recordIndex = traceCounts [coreId];
+    traceCounts [coreId] += 1;
+#endif
+    record = &(traceBuffers [coreId] [recordIndex & TRACE_BUFFER_MASK]);
+    record->object = object;
+    record->timestamp = gmosPalGetCycleCount ();
+    record->value = value;
+    record->recordType = recordType;
+}
+
+/*
+ * Adds a new record to the trace ring buffer.
+ */
+void gmosTraceRecord (uint8_t recordType,
+    const void* object, uint32_t value)
+{
+    if (!traceEnabled) {
+        return;
+    }
+
+    // Write the trace record with interrupts disabled if lock free
+    // trace recording is not supported.
+#if TRACE_LOCK_FREE
+    gmosTraceRecordLocked (recordType, object, value);
+#else
+    gmosPalMutexLock ();
+    gmosTraceRecordLocked (recordType, object, value);
+    gmosPalMutexUnlock ();
+#endif
+}
+
+/*
+ * Enables or disables trace recording.
+ */
+void gmosTraceSetEnabled (bool enabled)
+{
+    traceEnabled = enabled;
+}
+
+/*
+ * Determines whether a task start record for the specified task occurs
+ * before the specified trace record, scanning the trace records for
+ * all preceding processor cores and then the earlier trace records for
+ * the current processor core.
+ */
+static bool gmosTraceTaskSeen (const uint32_t* firstRecords,
+    uint8_t recordCore, uint32_t recordIndex, const void* task)
+{
+    gmosTraceRecord_t* record;
+    uint32_t lastRecord;
+    uint32_t i;
+    uint8_t coreId;
+
+    for (coreId = 0; coreId <= recordCore; coreId++) {
+        lastRecord = (coreId == recordCore) ?
+            recordIndex : traceCounts [coreId];
+        for (i = firstRecords [coreId]; i != lastRecord; i++) {
+            record = &(traceBuffers [coreId] [i & TRACE_BUFFER_MASK]);
+            if ((record->recordType == GMOS_TRACE_TASK_START) &&
+                (record->object == task)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*
+ * Writes the contents of the trace ring buffers to the debug log. The
+ * trace records for all processor cores are merged in timestamp order.
+ * Task names are written after the trace records for each task that
+ * has a task start record in the trace buffers.
+ */
+void gmosTraceDump (void)
+{
+    bool wasEnabled = traceEnabled;
+    uint32_t firstRecords [GMOS_CONFIG_SCHEDULER_CORES];
+    uint32_t nextRecords [GMOS_CONFIG_SCHEDULER_CORES];
+    uint32_t i;
+    uint8_t coreId;
+    uint8_t nextCore;
+    gmosTraceRecord_t* record;
+    gmosTraceRecord_t* nextRecord;
+    gmosTaskState_t* task;
+
+    // Suspend trace recording while writing the trace.
+    traceEnabled = false;
+    __sync_synchronize ();
+    for (coreId = 0; coreId < GMOS_CONFIG_SCHEDULER_CORES; coreId++) {
+        if (traceCounts [coreId] > GMOS_CONFIG_TRACE_BUFFER_SIZE) {
+            firstRecords [coreId] =
+                traceCounts [coreId] - GMOS_CONFIG_TRACE_BUFFER_SIZE;
+        } else {
+            firstRecords [coreId] = 0;
+        }
+        nextRecords [coreId] = firstRecords [coreId];
+    }
+
+    // Write the trace records in order, selecting the earliest of the
+    // next trace records for each processor core.
+    GMOS_LOG_FMT (LOG_INFO, "GMOS-TRACE BEGIN %ld",
+        (long) GMOS_CONFIG_PAL_CYCLE_COUNTER_FREQUENCY);
+    while (true) {
+        nextRecord = NULL;
+        nextCore = 0;
+        for (coreId = 0; coreId < GMOS_CONFIG_SCHEDULER_CORES; coreId++) {
+            if (nextRecords [coreId] == traceCounts [coreId]) {
+                continue;
+            }
+            record = &(traceBuffers [coreId]
+                [nextRecords [coreId] & TRACE_BUFFER_MASK]);
+            if ((nextRecord == NULL) || ((int32_t)
+                (record->timestamp - nextRecord->timestamp) < 0)) {
+                nextRecord = record;
+                nextCore = coreId;
+            }
+        }
+        if (nextRecord == NULL) {
+            break;
+        }
+        nextRecords [nextCore] += 1;
+        GMOS_LOG_FMT (LOG_INFO,
+            "GMOS-TRACE R %02x %08lx " TRACE_OBJECT_FMT " %08lx",
+            nextRecord->recordType,
+            (unsigned long) nextRecord->timestamp,
+            TRACE_OBJECT_ARGS (nextRecord->object),
+            (unsigned long) nextRecord->value);
+    }
+
+    // Write the task names, skipping duplicate task references.
+    for (coreId = 0; coreId < GMOS_CONFIG_SCHEDULER_CORES; coreId++) {
+        for (i = firstRecords [coreId]; i != traceCounts [coreId]; i++) {
+            record = &(traceBuffers [coreId] [i & TRACE_BUFFER_MASK]);
+            if ((record->recordType != GMOS_TRACE_TASK_START) ||
+                (gmosTraceTaskSeen (
+                    firstRecords, coreId, i, record->object))) {
+                continue;
+            }
+            task = (gmosTaskState_t*) record->object;
+            if (task->taskName != NULL) {
+                GMOS_LOG_FMT (LOG_INFO,
+                    "GMOS-TRACE N " TRACE_OBJECT_FMT " %s",
+                    TRACE_OBJECT_ARGS (task), task->taskName);
+            }
+        }
+    }
+    GMOS_LOG (LOG_INFO, "GMOS-TRACE END");
+
+    // Clear the trace buffers and restore trace recording.
+    for (coreId = 0; coreId < GMOS_CONFIG_SCHEDULER_CORES; coreId++) {
+        traceCounts [coreId] = 0;
+    }
+    traceEnabled = wasEnabled;
+}
+
+#endif // GMOS_CONFIG_TRACE_ENABLE
@@ -0,0 +1,282 @@
+#!/usr/bin/env python3
+
+#
+# The Gubbins Microcontroller Operating System
+#
+# Copyright 2026 Zynaptic Limited
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+# implied. See the License for the specific language governing
+# permissions and limitations under the License.
+#
+
+#
+# This tool is used to convert GubbinsMOS timeline trace dumps into the
+# Chrome trace event JSON format, which can be viewed using the Perfetto
+# UI or the Chrome 'about:tracing' page. Trace dumps are extracted from
+# captured debug console logs, as generated by the 'gmosTraceDump'
+# function. If the log contains multiple trace dumps, only the last
+# complete trace dump is converted.
+#
+
+import re
+import sys
+import json
+import argparse
+
+#
+# Specifies the trace record type encodings. These must match the
+# values in the 'gmosTraceRecordType_t' enumeration.
+#
+TRACE_TASK_START = 0x01
+TRACE_TASK_STOP = 0x02
+TRACE_EVENT_SET = 0x03
+TRACE_STREAM_WRITE = 0x04
+TRACE_STREAM_READ = 0x05
+TRACE_IDLE_ENTER = 0x06
+TRACE_IDLE_EXIT = 0x07
+TRACE_ISR_ENTER = 0x08
+TRACE_ISR_EXIT = 0x09
+TRACE_USER_MARKER = 0x0A
+
+#
+# Specifies the timeline track identifiers.
+#
+TRACK_TASKS = 1
+TRACK_IDLE = 2
+TRACK_EVENTS = 3
+TRACK_STREAMS = 4
+TRACK_ISRS = 5
+TRACK_MARKERS = 6
+
+trackNames = {
+    TRACK_TASKS: "Tasks",
+    TRACK_IDLE: "Idle",
+    TRACK_EVENTS: "Events",
+    TRACK_STREAMS: "Streams",
+    TRACK_ISRS: "Interrupts",
+    TRACK_MARKERS: "Markers",
+}
+
+#
+# Specifies the regular expressions used to match the trace dump lines.
+# These may be preceded by arbitrary log message prefixes.
+#
+beginPattern = re.compile(r"GMOS-TRACE BEGIN (\d+)")
+recordPattern = re.compile(
+    r"GMOS-TRACE R ([0-9a-fA-F]+) ([0-9a-fA-F]+) "
+    + r"([0-9a-fA-F]+) ([0-9a-fA-F]+)"
+)
+namePattern = re.compile(r"GMOS-TRACE N ([0-9a-fA-F]+) (.*?)\s*$")
+endPattern = re.compile(r"GMOS-TRACE END")
+
+
+#
+# Extracts the command line arguments.
+#
+def parseCommandLine():
+    parser = argparse.ArgumentParser(
+        description="This script is used to convert GubbinsMOS trace "
+        + "dumps into Chrome trace event JSON files.",
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+    )
+    parser.add_argument(
+        "--log_file",
+        default="-",
+        help="the captured debug log file, or '-' for standard input",
+    )
+    parser.add_argument(
+        "--json_file",
+        default="-",
+        help="the generated JSON output file, or '-' for standard output",
+    )
+    args = parser.parse_args()
+    return args
+
+
+#
+# Extracts the last complete trace dump from the log file lines. This
+# returns the cycle counter frequency, the list of trace records and
+# the dictionary of task names.
+#
+def extractTraceDump(logLines):
+    traceDump = None
+    inDump = False
+    for line in logLines:
+        match = beginPattern.search(line)
+        if match:
+            frequency = int(match.group(1))
+            records = []
+            names = {}
+            inDump = True
+            continue
+        if not inDump:
+            continue
+        match = recordPattern.search(line)
+        if match:
+            records.append(
+                (
+                    int(match.group(1), 16),
+                    int(match.group(2), 16),
+                    int(match.group(3), 16),
+                    int(match.group(4), 16),
+                )
+            )
+            continue
+        match = namePattern.search(line)
+        if match:
+            names[int(match.group(1), 16)] = match.group(2)
+            continue
+        if endPattern.search(line):
+            traceDump = (frequency, records, names)
+            inDump = False
+    return traceDump
+
+
+#
+# Converts the list of trace records into a list of trace events. The
+# 32-bit cycle counter timestamps are unwrapped and converted to
+# microseconds relative to the first trace record. Timestamp differences
+# are treated as signed values, since records written concurrently may
+# be slightly out of order. Any end events for which the matching begin
+# event has been overwritten in the trace ring buffer are discarded.
+#
+def convertRecords(frequency, records, names):
+    traceEvents = []
+    trackDepths = {}
+    lastCycles = None
+    totalCycles = 0
+
+    # Add the track names as metadata events.
+    for trackId, trackName in trackNames.items():
+        traceEvents.append(
+            {
+                "name": "thread_name",
+                "ph": "M",
+                "pid": 1,
+                "tid": trackId,
+                "args": {"name": trackName},
+            }
+        )
+
+    # Process each trace record in turn.
+    for recordType, cycles, objectId, value in records:
+        if lastCycles is not None:
+            deltaCycles = (cycles - lastCycles) & 0xFFFFFFFF
+            if deltaCycles >= 0x80000000:
+                deltaCycles -= 0x100000000
+            totalCycles += deltaCycles
+        lastCycles = cycles
+        timestamp = (totalCycles * 1000000.0) / frequency
+        objectName = names.get(objectId, "0x%08x" % objectId)
+        event = {"pid": 1, "ts": timestamp}
+
+        if recordType == TRACE_TASK_START:
+            event.update({"name": objectName, "ph": "B", "tid": TRACK_TASKS})
+        elif recordType == TRACE_TASK_STOP:
+            event.update(
+                {
+                    "name": objectName,
+                    "ph": "E",
+                    "tid": TRACK_TASKS,
+                    "args": {"status": "0x%08x" % value},
+                }
+            )
+        elif recordType == TRACE_IDLE_ENTER:
+            event.update(
+                {
+                    "name": "Idle",
+                    "ph": "B",
+                    "tid": TRACK_IDLE,
+                    "args": {"requested_ticks": value},
+                }
+            )
+        elif recordType == TRACE_IDLE_EXIT:
+            event.update({"name": "Idle", "ph": "E", "tid": TRACK_IDLE})
+        elif recordType == TRACE_EVENT_SET:
+            event.update(
+                {
+                    "name": "Event " + objectName,
+                    "ph": "i",
+                    "s": "t",
+                    "tid": TRACK_EVENTS,
+                    "args": {"bits": "0x%08x" % value},
+                }
+            )
+        elif recordType in (TRACE_STREAM_WRITE, TRACE_STREAM_READ):
+            direction = "Write" if recordType == TRACE_STREAM_WRITE else "Read"
+            event.update(
+                {
+                    "name": "Stream " + direction + " " + objectName,
+                    "ph": "i",
+                    "s": "t",
+                    "tid": TRACK_STREAMS,
+                    "args": {"size": value},
+                }
+            )
+        elif recordType == TRACE_ISR_ENTER:
+            event.update({"name": objectName, "ph": "B", "tid": TRACK_ISRS})
+        elif recordType == TRACE_ISR_EXIT:
+            event.update({"name": objectName, "ph": "E", "tid": TRACK_ISRS})
+        else:
+            event.update(
+                {
+                    "name": "Marker " + objectName,
+                    "ph": "i",
+                    "s": "t",
+                    "tid": TRACK_MARKERS,
+                    "args": {"type": recordType, "value": value},
+                }
+            )
+
+        # Track the begin and end event nesting for each track.
+        depth = trackDepths.get(event["tid"], 0)
+        if event["ph"] == "B":
+            trackDepths[event["tid"]] = depth + 1
+        elif event["ph"] == "E":
+            if depth == 0:
+                continue
+            trackDepths[event["tid"]] = depth - 1
+        traceEvents.append(event)
+    return traceEvents
+
+
+#
+# Provides the main script entry point.
+#
+def main():
+    args = parseCommandLine()
+
+    # Read the captured log file.
+    if args.log_file == "-":
+        logLines = sys.stdin.readlines()
+    else:
+        with open(args.log_file, "r", errors="replace") as logFile:
+            logLines = logFile.readlines()
+
+    # Extract and convert the trace dump.
+    traceDump = extractTraceDump(logLines)
+    if traceDump is None:
+        sys.exit("No complete trace dump found in log file.")
+    frequency, records, names = traceDump
+    traceEvents = convertRecords(frequency, records, names)
+    traceJson = json.dumps({"traceEvents": traceEvents}, indent=1)
+
+    # Write the generated JSON data.
+    if args.json_file == "-":
+        print(traceJson)
+    else:
+        with open(args.json_file, "w") as jsonFile:
+            jsonFile.write(traceJson)
+
+
+if __name__ == "__main__":
+    main()
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2025 Zynaptic Limited
+ * Copyright 2025-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,6 +27,7 @@
 
 #include "gmos-config.h"
 #include "gmos-platform.h"
+#include "gmos-mempool.h"
 #include "gmos-buffers.h"
 #include "gmos-streams.h"
 #include "gmos-network-links.h"
@@ -608,6 +609,8 @@ bool gmosMbedtlsClientInit (gmosMbedtlsClient_t* mbedtlsClient,
     gmosMbedtlsClientWorkerTask_start (
         &(mbedtlsClient->mbedtlsWorkerTask), mbedtlsClient,
         GMOS_TASK_NAME_WRAPPER ("MbedTLS Client"));
+    gmosMempoolSetTaskOwner (&(mbedtlsClient->mbedtlsWorkerTask),
+        GMOS_MEMPOOL_OWNER_TLS);
     return true;
 }
 
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022-2025 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -32,6 +32,7 @@
 #include "gmos-config.h"
 #include "gmos-platform.h"
 #include "gmos-scheduler.h"
+#include "gmos-mempool.h"
 #include "gmos-network.h"
 #include "gmos-driver-tcpip.h"
 #include "gmos-tcpip-config.h"
@@ -179,23 +180,27 @@ typedef struct gmosTcpipDhcpRxMessage_t {
 static uint8_t gmosTcpipBroadcastAddr [] = { 255, 255, 255, 255 };
 
 /*
- * Parses a received DHCP message options segment.
+ * Parses a received DHCP message options segment. This uses a buffer
+ * cursor, so that the buffer segment list is not walked from the start
+ * for each option field.
  */
 static inline bool gmosTcpipDhcpClientParseRxMessageOptions (
-    gmosTcpipDhcpClient_t* dhcpClient, gmosBuffer_t* rxBuffer,
+    gmosTcpipDhcpClient_t* dhcpClient, gmosBufferCursor_t* rxCursor,
     gmosTcpipDhcpRxMessage_t* rxMessage, uint16_t optOffset,
     uint16_t optLimit)
 {
     uint8_t optId;
     uint8_t optSize;
-    uint32_t optValueU32;
     uint8_t optValidMask;
 
     // Loop over all options in the option segment.
+    if (!gmosBufferCursorSeek (rxCursor, optOffset)) {
+        return false;
+    }
     while (optOffset < optLimit) {
 
         // Read the option ID and process basic tags.
-        gmosBufferRead (rxBuffer, optOffset, &optId, 1);
+        gmosBufferCursorReadU8 (rxCursor, &optId);
         optOffset += 1;
         if (optId == GMOS_TCPIP_DHCP_MESSAGE_OPTION_LIST_END) {
             return true;
@@ -205,7 +210,7 @@ static inline bool gmosTcpipDhcpClientParseRxMessageOptions (
 
         // Check for a valid option length that does not exceed the
         // option range.
-        if ((!gmosBufferRead (rxBuffer, optOffset, &optSize, 1)) ||
+        if ((!gmosBufferCursorReadU8 (rxCursor, &optSize)) ||
             (optOffset + optSize + 1 >= optLimit)) {
             return false;
         }
@@ -220,8 +225,8 @@ static inline bool gmosTcpipDhcpClientParseRxMessageOptions (
                     GMOS_TCPIP_DHCP_MESSAGE_OPTION_FLAG_OVERLOAD_FIELDS;
                 if ((optSize == 1) &&
                     ((rxMessage->optValidFlags & optValidMask) == 0)) {
-                    gmosBufferRead (rxBuffer,
-                        optOffset, &(rxMessage->optOverload), 1);
+                    gmosBufferCursorReadU8 (rxCursor,
+                        &(rxMessage->optOverload));
                     rxMessage->optValidFlags |= optValidMask;
                 }
                 break;
@@ -232,8 +237,8 @@ static inline bool gmosTcpipDhcpClientParseRxMessageOptions (
                     GMOS_TCPIP_DHCP_MESSAGE_OPTION_FLAG_MESSAGE_TYPE;
                 if ((optSize == 1) &&
                     ((rxMessage->optValidFlags & optValidMask) == 0)) {
-                    gmosBufferRead (rxBuffer,
-                        optOffset, &(rxMessage->messageType), 1);
+                    gmosBufferCursorReadU8 (rxCursor,
+                        &(rxMessage->messageType));
                     rxMessage->optValidFlags |= optValidMask;
                 }
                 break;
@@ -244,10 +249,8 @@ static inline bool gmosTcpipDhcpClientParseRxMessageOptions (
                     GMOS_TCPIP_DHCP_MESSAGE_OPTION_FLAG_LEASE_TIME;
                 if ((optSize == 4) &&
                     ((rxMessage->optValidFlags & optValidMask) == 0)) {
-                    gmosBufferRead (rxBuffer, optOffset,
-                        (uint8_t*) &optValueU32, 4);
-                    rxMessage->leaseTime =
-                        GMOS_TCPIP_STACK_NTOHL (optValueU32);
+                    gmosBufferCursorReadU32Be (rxCursor,
+                        &(rxMessage->leaseTime));
                     rxMessage->optValidFlags |= optValidMask;
                 }
                 break;
@@ -258,7 +261,7 @@ static inline bool gmosTcpipDhcpClientParseRxMessageOptions (
                     GMOS_TCPIP_DHCP_MESSAGE_OPTION_FLAG_GATEWAY_ROUTERS;
                 if ((optSize >= 4) &&
                     ((rxMessage->optValidFlags & optValidMask) == 0)) {
-                    gmosBufferRead (rxBuffer, optOffset,
+                    gmosBufferCursorRead (rxCursor,
                         (uint8_t*) &rxMessage->gatewayAddr, 4);
                     rxMessage->optValidFlags |= optValidMask;
                 }
@@ -270,7 +273,7 @@ static inline bool gmosTcpipDhcpClientParseRxMessageOptions (
                     GMOS_TCPIP_DHCP_MESSAGE_OPTION_FLAG_SERVER_ID;
                 if ((optSize == 4) &&
                     ((rxMessage->optValidFlags & optValidMask) == 0)) {
-                    gmosBufferRead (rxBuffer, optOffset,
+                    gmosBufferCursorRead (rxCursor,
                         (uint8_t*) &rxMessage->dhcpServerAddr, 4);
                     rxMessage->optValidFlags |= optValidMask;
                 }
@@ -282,7 +285,7 @@ static inline bool gmosTcpipDhcpClientParseRxMessageOptions (
                     GMOS_TCPIP_DHCP_MESSAGE_OPTION_FLAG_SUBNET_MASK;
                 if ((optSize == 4) &&
                     ((rxMessage->optValidFlags & optValidMask) == 0)) {
-                    gmosBufferRead (rxBuffer, optOffset,
+                    gmosBufferCursorRead (rxCursor,
                         (uint8_t*) &rxMessage->subnetMask, 4);
                     rxMessage->optValidFlags |= optValidMask;
                 }
@@ -295,13 +298,13 @@ static inline bool gmosTcpipDhcpClientParseRxMessageOptions (
                 if ((rxMessage->optValidFlags &
                     GMOS_TCPIP_DHCP_MESSAGE_OPTION_FLAG_DNS1_SERVER) == 0) {
                     if (optSize >= 4) {
-                        gmosBufferRead (rxBuffer, optOffset,
+                        gmosBufferCursorRead (rxCursor,
                             (uint8_t*) &rxMessage->dns1ServerAddr, 4);
                         rxMessage->optValidFlags |=
                             GMOS_TCPIP_DHCP_MESSAGE_OPTION_FLAG_DNS1_SERVER;
                     }
                     if (optSize >= 8) {
-                        gmosBufferRead (rxBuffer, optOffset + 4,
+                        gmosBufferCursorRead (rxCursor,
                             (uint8_t*) &rxMessage->dns2ServerAddr, 4);
                         rxMessage->optValidFlags |=
                             GMOS_TCPIP_DHCP_MESSAGE_OPTION_FLAG_DNS2_SERVER;
@@ -309,7 +312,7 @@ static inline bool gmosTcpipDhcpClientParseRxMessageOptions (
                 } else if ((rxMessage->optValidFlags &
                     GMOS_TCPIP_DHCP_MESSAGE_OPTION_FLAG_DNS2_SERVER) == 0) {
                     if (optSize >= 4) {
-                        gmosBufferRead (rxBuffer, optOffset,
+                        gmosBufferCursorRead (rxCursor,
                             (uint8_t*) &rxMessage->dns2ServerAddr, 4);
                         rxMessage->optValidFlags |=
                             GMOS_TCPIP_DHCP_MESSAGE_OPTION_FLAG_DNS2_SERVER;
@@ -320,6 +323,7 @@ static inline bool gmosTcpipDhcpClientParseRxMessageOptions (
 
         // Set the offset to the next option ID.
         optOffset += optSize;
+        gmosBufferCursorSeek (rxCursor, optOffset);
     }
     return false;
 }
@@ -333,10 +337,10 @@ static bool gmosTcpipDhcpClientParseRxMessage (
 {
     gmosDriverTcpip_t* tcpipDriver = dhcpClient->tcpipStack->tcpipDriver;
     uint16_t rxLength = gmosBufferGetSize (rxBuffer);
+    gmosBufferCursor_t rxCursor;
     uint8_t* ethMacAddr;
     uint8_t rxData [6];
     uint32_t rxDataU32;
-    uint32_t expectedValue;
     uint16_t optOffset;
     uint16_t optLimit;
     uint8_t optSegment;
@@ -353,36 +357,39 @@ static bool gmosTcpipDhcpClientParseRxMessage (
     }
 
     // Check that the message is marked as a 'boot reply' with an
-    // Ethernet hardware type and zero hops.
-    expectedValue = GMOS_TCPIP_STACK_HTONL (0x02010600);
-    gmosBufferRead (rxBuffer, 0, (uint8_t*) &rxDataU32, 4);
-    if (rxDataU32 != expectedValue) {
-        return false;
-    }
-
-    // Check for a valid options header magic number.
-    expectedValue = GMOS_TCPIP_STACK_HTONL (0x63825363);
-    gmosBufferRead (rxBuffer, 236, (uint8_t*) &rxDataU32, 4);
-    if (rxDataU32 != expectedValue) {
+    // Ethernet hardware type and zero hops. The header fields are read
+    // in order using a buffer cursor.
+    gmosBufferCursorInit (&rxCursor, rxBuffer, 0);
+    gmosBufferCursorReadU32Be (&rxCursor, &rxDataU32);
+    if (rxDataU32 != 0x02010600) {
         return false;
     }
 
     // Check for matching 'xid' field. This uses native byte order.
-    expectedValue = dhcpClient->dhcpXid;
-    gmosBufferRead (rxBuffer, 4, (uint8_t*) &rxDataU32, 4);
-    if (rxDataU32 != expectedValue) {
+    gmosBufferCursorRead (&rxCursor, (uint8_t*) &rxDataU32, 4);
+    if (rxDataU32 != dhcpClient->dhcpXid) {
         return false;
     }
 
+    // Read the common header fields.
+    gmosBufferCursorSeek (&rxCursor, 16);
+    gmosBufferCursorRead (&rxCursor,
+        (uint8_t*) &rxMessage->assignedAddr, 4);
+
     // Check for matching 'chaddr' field.
     ethMacAddr = gmosDriverTcpipGetMacAddr (tcpipDriver);
-    gmosBufferRead (rxBuffer, 28, rxData, 6);
+    gmosBufferCursorSeek (&rxCursor, 28);
+    gmosBufferCursorRead (&rxCursor, rxData, 6);
     if (memcmp (rxData, ethMacAddr, 6) != 0) {
         return false;
     }
 
-    // Read the common header fields.
-    gmosBufferRead (rxBuffer, 16, (uint8_t*) &rxMessage->assignedAddr, 4);
+    // Check for a valid options header magic number.
+    gmosBufferCursorSeek (&rxCursor, 236);
+    gmosBufferCursorReadU32Be (&rxCursor, &rxDataU32);
+    if (rxDataU32 != 0x63825363) {
+        return false;
+    }
 
     // Process the three potential options segments in turn.
     for (optSegment = 0; optSegment < 3; optSegment++) {
@@ -415,8 +422,8 @@ static bool gmosTcpipDhcpClientParseRxMessage (
 
         // Process the selected option segment.
         if (optOffset != 0) {
-            if (!gmosTcpipDhcpClientParseRxMessageOptions (
-                dhcpClient, rxBuffer, rxMessage, optOffset, optLimit)) {
+            if (!gmosTcpipDhcpClientParseRxMessageOptions (dhcpClient,
+                &rxCursor, rxMessage, optOffset, optLimit)) {
                 return false;
             }
         }
@@ -1582,6 +1589,8 @@ bool gmosTcpipDhcpClientInit (gmosTcpipDhcpClient_t* dhcpClient,
     dhcpWorkerTask->taskName =
         GMOS_TASK_NAME_WRAPPER ("TCP/IP DHCP Client");
     gmosSchedulerTaskStart (dhcpWorkerTask);
+    gmosMempoolSetTaskOwner (dhcpWorkerTask,
+        GMOS_MEMPOOL_OWNER_NETWORK);
 
     return true;
 }
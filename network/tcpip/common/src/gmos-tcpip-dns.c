@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -30,6 +30,7 @@
 #include "gmos-platform.h"
 #include "gmos-buffers.h"
 #include "gmos-scheduler.h"
+#include "gmos-mempool.h"
 #include "gmos-tcpip-config.h"
 #include "gmos-tcpip-stack.h"
 #include "gmos-tcpip-dns.h"
@@ -372,28 +373,28 @@ static inline uint8_t gmosTcpipDnsClientCacheMatchString (
 }
 
 /*
- * Perform a DNS name buffer match against a cache table entry.
+ * Perform a DNS name buffer match against a cache table entry. The DNS
+ * name is read from the current position of the specified buffer
+ * cursor, which will be advanced past the DNS name on success.
  */
 static inline uint8_t gmosTcpipDnsClientCacheMatchBuffer (
-    gmosBuffer_t* dnsCacheBuffer, gmosBuffer_t* dnsNameBuffer,
-    uint16_t dnsNameBufferOffset)
+    gmosBuffer_t* dnsCacheBuffer, gmosBufferCursor_t* dnsNameCursor)
 {
+    gmosBufferCursor_t cacheCursor;
     uint8_t cacheLabelSize;
     uint8_t dnsNameLabelSize;
     uint8_t cacheLabelData [64];
     uint8_t dnsNameLabelData [64];
-    size_t cacheBufferOffset;
     uint8_t matchLength;
 
     // Attempt to read the size of the first cache label. This will
     // always fail for an empty cache entry.
-    cacheBufferOffset = sizeof (gmosTcpipDnsCacheEntry_t);
-    if (!gmosBufferRead (dnsCacheBuffer,
-        cacheBufferOffset, &cacheLabelSize, 1)) {
+    if ((!gmosBufferCursorInit (&cacheCursor, dnsCacheBuffer,
+        sizeof (gmosTcpipDnsCacheEntry_t))) ||
+        (!gmosBufferCursorReadU8 (&cacheCursor, &cacheLabelSize))) {
         return 0;
     }
-    if (!gmosBufferRead (dnsNameBuffer,
-        dnsNameBufferOffset, &dnsNameLabelSize, 1)) {
+    if (!gmosBufferCursorReadU8 (dnsNameCursor, &dnsNameLabelSize)) {
         return 0;
     }
 
@@ -411,14 +412,12 @@ static inline uint8_t gmosTcpipDnsClientCacheMatchBuffer (
 
         // Read the next DNS label from the cache buffer and the name
         // buffer, including the next length byte.
-        cacheBufferOffset += 1;
-        if (!gmosBufferRead (dnsCacheBuffer, cacheBufferOffset,
+        if (!gmosBufferCursorRead (&cacheCursor,
             cacheLabelData, cacheLabelSize + 1)) {
             matchLength = 0;
             break;
         }
-        dnsNameBufferOffset += 1;
-        if (!gmosBufferRead (dnsNameBuffer, dnsNameBufferOffset,
+        if (!gmosBufferCursorRead (dnsNameCursor,
             dnsNameLabelData, dnsNameLabelSize + 1)) {
             matchLength = 0;
             break;
@@ -433,8 +432,6 @@ static inline uint8_t gmosTcpipDnsClientCacheMatchBuffer (
 
         // Get the next cache label length.
         matchLength += 1 + cacheLabelSize;
-        dnsNameBufferOffset += cacheLabelSize;
-        cacheBufferOffset += cacheLabelSize;
         cacheLabelSize = cacheLabelData [cacheLabelSize];
         dnsNameLabelSize = dnsNameLabelData [dnsNameLabelSize];
 
@@ -821,38 +818,35 @@ static inline gmosTaskStatus_t gmosTcpipDnsClientCacheProcess (
 }
 
 /*
- * Skip over a DNS name in a response message.
+ * Skip over a DNS name in a response message, advancing the payload
+ * cursor to the octet following the DNS name.
  */
-static inline uint16_t gmosTcpipDnsClientResponseSkipDnsName (
-    gmosBuffer_t* payload, uint16_t payloadOffset)
+static inline bool gmosTcpipDnsClientResponseSkipDnsName (
+    gmosBufferCursor_t* payloadCursor)
 {
     uint8_t segmentSize;
 
     // Read the size of each label segment in turn.
     while (true) {
-        if (!gmosBufferRead (payload, payloadOffset, &segmentSize, 1)) {
-            payloadOffset = 0;
-            break;
+        if (!gmosBufferCursorReadU8 (payloadCursor, &segmentSize)) {
+            return false;
         }
 
         // Check for single octet empty label at the end of a DNS name.
         if (segmentSize == 0) {
-            payloadOffset += 1;
-            break;
+            return true;
         }
 
         // Check for a two octet pointer at the end of a list of labels.
         else if ((segmentSize & 0xC0) == 0xC0) {
-            payloadOffset += 2;
-            break;
+            return gmosBufferCursorSkip (payloadCursor, 1);
         }
 
-        // Update the offset for a conventional label.
-        else {
-            payloadOffset += 1 + segmentSize;
+        // Skip over a conventional label.
+        else if (!gmosBufferCursorSkip (payloadCursor, segmentSize)) {
+            return false;
         }
     }
-    return payloadOffset;
 }
 
 /*
@@ -864,6 +858,7 @@ static inline uint16_t gmosTcpipDnsClientResponseCheckHeader (
     gmosBuffer_t* payloadBuffer, gmosBuffer_t* dnsCacheBuffer,
     gmosTcpipDnsCacheEntry_t* dnsCacheEntry, uint8_t* nextState)
 {
+    gmosBufferCursor_t payloadCursor;
     uint8_t dnsHeader [12];
     uint8_t queryData [4];
     uint8_t responseCode;
@@ -882,8 +877,10 @@ static inline uint16_t gmosTcpipDnsClientResponseCheckHeader (
     }
 #endif
 
-    // Extract the common header fields.
-    if (!gmosBufferRead (payloadBuffer, 0,
+    // Extract the common header fields. A buffer cursor is used to read
+    // the header and query section fields in order.
+    gmosBufferCursorInit (&payloadCursor, payloadBuffer, 0);
+    if (!gmosBufferCursorRead (&payloadCursor,
         dnsHeader, sizeof (dnsHeader))) {
         return 0;
     }
@@ -923,19 +920,17 @@ static inline uint16_t gmosTcpipDnsClientResponseCheckHeader (
         return 0;
     }
     payloadSize = gmosBufferGetSize (payloadBuffer);
-    payloadOffset = sizeof (dnsHeader);
 
     // Match the DNS name against the contents of the cache buffer.
     matchSize = gmosTcpipDnsClientCacheMatchBuffer (
-        dnsCacheBuffer, payloadBuffer, payloadOffset);
+        dnsCacheBuffer, &payloadCursor);
     if (matchSize == 0) {
         *nextState = GMOS_TCPIP_DNS_CACHE_ENTRY_STATE_NOT_VALID;
         return 0;
     }
-    payloadOffset += matchSize;
 
     // Match the expected record type and Internet class fields.
-    if (!gmosBufferRead (payloadBuffer, payloadOffset,
+    if (!gmosBufferCursorRead (&payloadCursor,
         queryData, sizeof (queryData))) {
         return 0;
     }
@@ -943,7 +938,7 @@ static inline uint16_t gmosTcpipDnsClientResponseCheckHeader (
         (queryData [2] != 0x00) || (queryData [3] != 0x01)) {
         return 0;
     }
-    payloadOffset += 4;
+    payloadOffset = gmosBufferCursorGetOffset (&payloadCursor);
 
     // Remove the header and question section from the payload buffer.
     if (payloadOffset >= payloadSize) {
@@ -963,7 +958,7 @@ static inline void gmosTcpipDnsClientResponseScanRecords (
     gmosBuffer_t* payload, gmosTcpipDnsCacheEntry_t* dnsCacheEntry,
     uint16_t anCount, uint8_t* nextState)
 {
-    uint16_t payloadOffset;
+    gmosBufferCursor_t payloadCursor;
     uint8_t resourceRecord [10];
     uint8_t resolvedAddr [GMOS_CONFIG_TCPIP_DNS_MAX_ADDR_SIZE];
     uint16_t recordDataSize;
@@ -982,25 +977,23 @@ static inline void gmosTcpipDnsClientResponseScanRecords (
     }
 #endif
 
-    // Scan each answer record in turn.
-    payloadOffset = 0;
+    // Scan each answer record in turn, using a buffer cursor to track
+    // the current record position.
+    gmosBufferCursorInit (&payloadCursor, payload, 0);
     aTypeRecordCount = 0;
     while (anCount > 0) {
 
         // Skip over the DNS name - this is assumed to be valid and
         // will not be checked.
-        payloadOffset = gmosTcpipDnsClientResponseSkipDnsName (
-            payload, payloadOffset);
-        if (payloadOffset == 0) {
+        if (!gmosTcpipDnsClientResponseSkipDnsName (&payloadCursor)) {
             return;
         }
 
         // Read the common resource record fields.
-        if (!gmosBufferRead (payload, payloadOffset,
+        if (!gmosBufferCursorRead (&payloadCursor,
             resourceRecord, sizeof (resourceRecord))) {
             return;
         }
-        payloadOffset += sizeof (resourceRecord);
 
         // The DNS records form a 'tree' of canonical name references
         // with 'A' or 'AAAA' records at the leaf nodes. Therefore it is
@@ -1010,7 +1003,7 @@ static inline void gmosTcpipDnsClientResponseScanRecords (
         if ((resourceRecord [0] == 0) &&
             (resourceRecord [1] == recordType) &&
             (resourceRecord [2] == 0) && (resourceRecord [3] == 1)) {
-            if (!gmosBufferRead (payload, payloadOffset,
+            if (!gmosBufferCursorPeek (&payloadCursor,
                 resolvedAddr, resolvedAddrSize)) {
                 return;
             }
@@ -1049,7 +1042,9 @@ static inline void gmosTcpipDnsClientResponseScanRecords (
         // Update the payload offset to the start of the next record.
         recordDataSize = ((uint16_t) (resourceRecord [8]) << 8);
         recordDataSize += (uint16_t) (resourceRecord [9]);
-        payloadOffset += recordDataSize;
+        if (!gmosBufferCursorSkip (&payloadCursor, recordDataSize)) {
+            return;
+        }
         anCount -= 1;
     }
 }
@@ -1260,6 +1255,7 @@ bool gmosTcpipDnsClientInit (gmosTcpipDnsClient_t* dnsClient,
     dnsWorkerTask->taskName =
         GMOS_TASK_NAME_WRAPPER ("TCP/IP DNS Client");
     gmosSchedulerTaskStart (dnsWorkerTask);
+    gmosMempoolSetTaskOwner (dnsWorkerTask, GMOS_MEMPOOL_OWNER_NETWORK);
 
     return true;
 }
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2024-2025 Zynaptic Limited
+ * Copyright 2024-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -31,6 +31,7 @@
 #include "gmos-config.h"
 #include "gmos-platform.h"
 #include "gmos-scheduler.h"
+#include "gmos-mempool.h"
 #include "gmos-buffers.h"
 #include "gmos-network.h"
 #include "gmos-network-links.h"
@@ -370,6 +371,7 @@ bool gmosTcpipLinkInit (gmosTcpipLink_t* tcpipLink,
     workerTask->taskName =
         GMOS_TASK_NAME_WRAPPER ("TCP/IP Network Link");
     gmosSchedulerTaskStart (workerTask);
+    gmosMempoolSetTaskOwner (workerTask, GMOS_MEMPOOL_OWNER_NETWORK);
     return true;
 }
 
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -114,6 +114,9 @@ typedef struct gmosNalTcpipState_t {
     // Specify the timestamp used for PHY connection state polling.
     uint16_t phyPollTimestamp;
 
+    // Allocate the buffer span list for buffer based transfers.
+    gmosBufferSpan_t spiBufferSpans [WIZNET_SPI_ADAPTOR_SPAN_COUNT];
+
     // Specify the current offset for buffer based transfers.
     uint16_t spiBufferOffset;
 
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022-2024 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -177,6 +177,10 @@ typedef struct wiznetSpiAdaptorCmd_t {
 // of SPI commands.
 #define WIZNET_SPI_ADAPTOR_STREAM_SIZE (2 * GMOS_CONFIG_TCPIP_MAX_SOCKETS)
 
+// Specify the maximum number of buffer spans that may be transferred
+// in a single chained SPI transaction.
+#define WIZNET_SPI_ADAPTOR_SPAN_COUNT 8
+
 // Define the SPI command streams to use the command data type.
 GMOS_STREAM_DEFINITION (wiznetSpiAdaptorStream, wiznetSpiAdaptorCmd_t)
 
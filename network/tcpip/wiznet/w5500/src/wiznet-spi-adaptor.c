@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022-2024 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -86,7 +86,8 @@ static inline gmosDriverSpiStatus_t wiznetSpiAdaptorTransferBytes (
 }
 
 /*
- * Implement buffer based transfers using the non-blocking API.
+ * Implement buffer based transfers using the non-blocking API. The
+ * buffer segments are transferred as a single chained SPI transaction.
  */
 static inline gmosDriverSpiStatus_t wiznetSpiAdaptorTransferBuffer (
     gmosDriverTcpip_t* tcpipStack)
@@ -95,55 +96,43 @@ static inline gmosDriverSpiStatus_t wiznetSpiAdaptorTransferBuffer (
     gmosNalTcpipState_t* nalData = tcpipStack->nalData;
     wiznetSpiAdaptorCmd_t* spiCommand = &(nalData->spiCommand);
     gmosBuffer_t* dataBuffer = &(spiCommand->data.buffer);
-    gmosMempoolSegment_t* mempoolSegment;
+    gmosBufferSpan_t* spanList = nalData->spiBufferSpans;
     uint16_t transferOffset;
-    uint8_t* transferPtr;
     uint16_t transferSize;
+    uint8_t spanCount;
+    uint8_t i;
 
-    // Get the memory pool segment to use for the next transfer.
+    // Get the list of buffer spans to use for the next transfer. Very
+    // long buffers may require more than one chained transfer.
     transferOffset = nalData->spiBufferOffset;
-    mempoolSegment = gmosBufferGetSegment (dataBuffer, transferOffset);
-    if (mempoolSegment == NULL) {
+    spanCount = gmosBufferGetSpans (dataBuffer, transferOffset,
+        dataBuffer->bufferSize - transferOffset, spanList,
+        WIZNET_SPI_ADAPTOR_SPAN_COUNT);
+    if (spanCount == 0) {
         return GMOS_DRIVER_SPI_STATUS_DRIVER_ERROR;
     }
 
-    // In most cases, the data transfer pointer will be set to the
-    // beginning of the memory pool segment and the transfer request
-    // will be sized accordingly.
-    transferPtr = mempoolSegment->data.bytes;
-    transferSize = dataBuffer->bufferSize - transferOffset;
-    if (transferSize > GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) {
-        transferSize = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE;
-    }
-
-    // An adjustment is required if the buffer contents are not aligned
-    // to the start of the first memory segment.
-    if ((transferOffset == 0) && (dataBuffer->bufferOffset != 0)) {
-        transferPtr += dataBuffer->bufferOffset;
-        if (transferSize + dataBuffer->bufferOffset >
-            GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) {
-            transferSize = GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE -
-                dataBuffer->bufferOffset;
-        }
-    }
-
     // Initiate a non-blocking SPI write if requested.
     if ((spiCommand->control & WIZNET_SPI_ADAPTOR_CTRL_WRITE_ENABLE) != 0) {
-        if (!gmosDriverSpiIoWrite (nalConfig->spiInterface,
-            transferPtr, transferSize)) {
+        if (!gmosDriverSpiIoWriteSpans (nalConfig->spiInterface,
+            spanList, spanCount)) {
             return GMOS_DRIVER_SPI_STATUS_NOT_READY;
         }
     }
 
     // Alternatively initiate a non-blocking SPI read.
     else {
-        if (!gmosDriverSpiIoRead (nalConfig->spiInterface,
-            transferPtr, transferSize)) {
+        if (!gmosDriverSpiIoReadSpans (nalConfig->spiInterface,
+            spanList, spanCount)) {
             return GMOS_DRIVER_SPI_STATUS_NOT_READY;
         }
     }
 
     // Update the transfer offset on initiating the transfer.
+    transferSize = 0;
+    for (i = 0; i < spanCount; i++) {
+        transferSize += spanList [i].size;
+    }
     nalData->spiBufferOffset += transferSize;
     return GMOS_DRIVER_SPI_STATUS_SUCCESS;
 }
@@ -390,12 +379,16 @@ bool gmosNalTcpipWiznetSpiInit (gmosDriverTcpip_t* tcpipStack)
     nalData->wiznetAdaptorState = WIZNET_SPI_ADAPTOR_STATE_INIT;
 
     // Initialise the worker task and schedule it for immediate
-    // execution.
+    // execution. The worker task services the WIZnet interrupt line and
+    // command stream, so it is assigned the highest priority level.
     spiWorkerTask->taskTickFn = wiznetSpiAdaptorWorkerTaskFn;
     spiWorkerTask->taskData = tcpipStack;
     spiWorkerTask->taskName =
         GMOS_TASK_NAME_WRAPPER ("WIZnet SPI Driver Task");
     gmosSchedulerTaskStart (spiWorkerTask);
+    gmosSchedulerTaskSetPriority (spiWorkerTask,
+        GMOS_TASK_PRIORITY_HIGHEST);
+    gmosMempoolSetTaskOwner (spiWorkerTask, GMOS_MEMPOOL_OWNER_NETWORK);
 
     return true;
 }
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2021 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -103,6 +103,15 @@
 #define GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER 16
 #endif
 
+/**
+ * This configuration option disables constant time task removal from
+ * the scheduler task queues, since ATMEGA applications typically only
+ * use a small number of tasks and RAM is at a premium.
+ */
+#ifndef GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL
+#define GMOS_CONFIG_SCHEDULER_FAST_TASK_REMOVAL false
+#endif
+
 // Wrap message strings for storage in the ATMEGA flash memory area.
 #include "avr/pgmspace.h"
 #define GMOS_PLATFORM_STRING_WRAPPER(_message_) \
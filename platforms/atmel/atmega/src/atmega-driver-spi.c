@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2021 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -84,7 +84,6 @@ static bool gmosDriverSpiPalTransfer (gmosDriverSpiBus_t* spiInterface)
 static void gmosDriverSpiPalComplete (gmosDriverSpiBus_t* spiInterface)
 {
     uint32_t eventFlags;
-    gmosEvent_t* completionEvent;
 
     // Set the GubbinsMOS event flags to indicate successful completion.
     eventFlags = spiInterfaceData->transferSize;
@@ -92,10 +91,10 @@ static void gmosDriverSpiPalComplete (gmosDriverSpiBus_t* spiInterface)
     eventFlags |= GMOS_DRIVER_SPI_EVENT_COMPLETION_FLAG |
         GMOS_DRIVER_SPI_STATUS_SUCCESS;
 
-    // Disable the SPI interface and send the completion event.
+    // Disable the SPI interface and signal completion. This may start
+    // the next transfer in a chained transaction.
     SPCR &= ~((1 << SPIE) | (1 << SPE));
-    completionEvent = &(spiInterfaceData->device->completionEvent);
-    gmosEventAssignBits (completionEvent, eventFlags);
+    gmosDriverSpiIoNotifyComplete (spiInterfaceData, eventFlags);
 }
 
 /*
@@ -0,0 +1,46 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the DHCP message parsing benchmark application
+ * configuration options. The memory pool segment size is selected
+ * using the test build variant compiler options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the benchmark.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Specify a memory pool that can hold the DHCP message with the
+ * smallest segment size.
+ */
+#define GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER 128
+
+/*
+ * Specify the number of padding options to add to the DHCP message and
+ * the number of times the message is parsed.
+ */
+#define GMOS_BENCH_OPTION_COUNT 250
+#define GMOS_BENCH_PARSE_COUNT 50000
+
+#endif // GMOS_APP_CONFIG_H
@@ -0,0 +1,195 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a benchmark for the DHCP client received message parser.
+ * A DHCP offer of approximately 1 KB is assembled, with the supported
+ * options interleaved with a large number of unrecognised options that
+ * must be skipped. The mean host execution time for parsing the
+ * message is reported, so that the impact of the memory pool segment
+ * size can be compared across the benchmark build variants. All times
+ * include the host timer overhead.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-buffers.h"
+#include "gmos-test.h"
+
+// Include the DHCP client implementation, which provides the static
+// message parsing function.
+#include "gmos-tcpip-dhcp.c"
+
+// Specify the DHCP transaction ID and client MAC address.
+#define BENCH_DHCP_XID 0x12345678
+static uint8_t benchMacAddr [] = { 0x02, 0x00, 0x00, 0x12, 0x34, 0x56 };
+
+// Allocate the DHCP client, TCP/IP stack and message buffer state.
+static gmosTcpipStack_t benchTcpipStack;
+static gmosTcpipDhcpClient_t benchDhcpClient;
+static gmosBuffer_t benchBuffer;
+static gmosTaskState_t benchTask;
+
+/*
+ * Provides the TCP/IP driver MAC address, which is used to check the
+ * DHCP message client hardware address field.
+ */
+uint8_t* gmosDriverTcpipGetMacAddr (gmosDriverTcpip_t* tcpipDriver)
+{
+    return benchMacAddr;
+}
+
+/*
+ * Appends a DHCP option to the message buffer.
+ */
+static void benchAppendOption (uint8_t optId,
+    const uint8_t* optData, uint8_t optSize)
+{
+    GMOS_TEST_CHECK (gmosBufferAppend (&benchBuffer, &optId, 1));
+    GMOS_TEST_CHECK (gmosBufferAppend (&benchBuffer, &optSize, 1));
+    GMOS_TEST_CHECK (gmosBufferAppend (&benchBuffer, optData, optSize));
+}
+
+/*
+ * Assembles the DHCP offer message in the message buffer.
+ */
+static void benchBuildOffer (void)
+{
+    static const uint8_t optMessageType [] = { 2 };
+    static const uint8_t optAddr [] = { 192, 168, 1, 1 };
+    static const uint8_t optSubnet [] = { 255, 255, 255, 0 };
+    static const uint8_t optLease [] = { 0x00, 0x01, 0x51, 0x80 };
+    static const uint8_t optDnsServers [] = {
+        192, 168, 1, 2, 192, 168, 1, 3 };
+    static const uint8_t optUnused [] = { 0xA5 };
+    uint8_t header [240];
+    uint32_t xid = BENCH_DHCP_XID;
+    uint16_t i;
+
+    // Assemble the fixed header fields.
+    memset (header, 0, sizeof (header));
+    header [0] = 0x02;
+    header [1] = 0x01;
+    header [2] = 0x06;
+    memcpy (&(header [4]), &xid, 4);
+    memcpy (&(header [16]), optAddr, 4);
+    memcpy (&(header [28]), benchMacAddr, 6);
+    header [236] = 0x63;
+    header [237] = 0x82;
+    header [238] = 0x53;
+    header [239] = 0x63;
+    GMOS_TEST_CHECK (gmosBufferAppend (&benchBuffer, header, 240));
+
+    // Interleave the supported options with unrecognised options.
+    for (i = 0; i < GMOS_BENCH_OPTION_COUNT; i++) {
+        switch (i) {
+            case 10 :
+                benchAppendOption (
+                    GMOS_TCPIP_DHCP_MESSAGE_OPTION_MESSAGE_TYPE,
+                    optMessageType, 1);
+                break;
+            case 50 :
+                benchAppendOption (
+                    GMOS_TCPIP_DHCP_MESSAGE_OPTION_SERVER_ID,
+                    optAddr, 4);
+                break;
+            case 90 :
+                benchAppendOption (
+                    GMOS_TCPIP_DHCP_MESSAGE_OPTION_SUBNET_MASK,
+                    optSubnet, 4);
+                break;
+            case 130 :
+                benchAppendOption (
+                    GMOS_TCPIP_DHCP_MESSAGE_OPTION_GATEWAY_ROUTERS,
+                    optAddr, 4);
+                break;
+            case 170 :
+                benchAppendOption (
+                    GMOS_TCPIP_DHCP_MESSAGE_OPTION_LEASE_TIME,
+                    optLease, 4);
+                break;
+            case 210 :
+                benchAppendOption (
+                    GMOS_TCPIP_DHCP_MESSAGE_OPTION_DNS_SERVERS,
+                    optDnsServers, 8);
+                break;
+            default :
+                benchAppendOption (224, optUnused, 1);
+                break;
+        }
+    }
+    benchAppendOption (GMOS_TCPIP_DHCP_MESSAGE_OPTION_LIST_END, NULL, 0);
+}
+
+/*
+ * Implements the benchmark task, which parses the DHCP offer message
+ * the specified number of times and then reports the mean parse time.
+ */
+static gmosTaskStatus_t benchTaskFn (void* nullData)
+{
+    gmosTcpipDhcpRxMessage_t rxMessage;
+    uint64_t startNanos;
+    uint64_t totalNanos;
+    uint32_t parseCount = 0;
+    uint32_t i;
+
+    // Time the message parsing.
+    startNanos = gmosTestGetHostNanos ();
+    for (i = 0; i < GMOS_BENCH_PARSE_COUNT; i++) {
+        if (gmosTcpipDhcpClientParseRxMessage (
+            &benchDhcpClient, &benchBuffer, &rxMessage)) {
+            parseCount += 1;
+        }
+    }
+    totalNanos = gmosTestGetHostNanos () - startNanos;
+
+    // Check the results of the final parse.
+    GMOS_TEST_CHECK (parseCount == GMOS_BENCH_PARSE_COUNT);
+    GMOS_TEST_CHECK (rxMessage.messageType ==
+        GMOS_TCPIP_DHCP_MESSAGE_TYPE_OFFER);
+    GMOS_TEST_CHECK (rxMessage.optValidFlags == 0xFD);
+    GMOS_TEST_CHECK (rxMessage.leaseTime == 86400);
+    GMOS_LOG_FMT (LOG_INFO,
+        "DHCP offer : %ld bytes, segment size %ld, %ld ns per parse.",
+        (long) gmosBufferGetSize (&benchBuffer),
+        (long) GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE,
+        (long) (totalNanos / GMOS_BENCH_PARSE_COUNT));
+    gmosBufferReset (&benchBuffer, 0);
+    gmosTestComplete ("dhcp-parse-bench");
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Sets up the benchmark application.
+ */
+void gmosAppInit (void)
+{
+    benchDhcpClient.tcpipStack = &benchTcpipStack;
+    benchDhcpClient.dhcpXid = BENCH_DHCP_XID;
+    gmosBufferInit (&benchBuffer);
+    benchBuildOffer ();
+    benchTask.taskTickFn = benchTaskFn;
+    benchTask.taskData = NULL;
+    benchTask.taskName = "Benchmark";
+    gmosSchedulerTaskStart (&benchTask);
+}
@@ -0,0 +1,29 @@
+#
+# The Gubbins Microcontroller Operating System
+#
+# Copyright 2026 Zynaptic Limited
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+# implied. See the License for the specific language governing
+# permissions and limitations under the License.
+#
+
+#
+# This is the makefile fragment for building the event queue append
+# benchmark application.
+#
+
+# List all the application object files that need to be built.
+APP_OBJ_FILE_NAMES = \
+	event-queue-bench.o
+
+# Include the common test application build rules.
+include ${GMOS_GIT_DIR}/platforms/linux/posix/tests/test-build.mk
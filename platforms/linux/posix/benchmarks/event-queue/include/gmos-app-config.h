@@ -0,0 +1,49 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the event queue append benchmark application
+ * configuration options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the benchmark.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Run the benchmark in virtual time, so that the event queue is
+ * drained between benchmark iterations without any idle delay.
+ */
+#define GMOS_CONFIG_POSIX_VIRTUAL_TIME true
+
+/*
+ * Specify the maximum number of pending events to use.
+ */
+#define GMOS_BENCH_MAX_EVENT_COUNT 1000
+
+/*
+ * Specify the number of event notifications to measure for each
+ * number of pending events.
+ */
+#define GMOS_BENCH_NOTIFY_COUNT 200000
+
+#endif // GMOS_APP_CONFIG_H
@@ -0,0 +1,174 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a benchmark for the event queue append operation, which
+ * runs with the platform mutex held. On each benchmark iteration, the
+ * event bits are set for a number of events with no pending events in
+ * the queue, so that each event is appended to the queue. The event
+ * bits are then set again for all the events while they are still
+ * pending, which exercises the duplicate detection path. The mean and
+ * 99.9th percentile host execution times are reported for 1, 10, 100
+ * and 1000 pending events. The percentile is used as a measure of the
+ * worst case execution time, since the maximum is dominated by host
+ * scheduling jitter. All times include the host timer overhead.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-events.h"
+#include "gmos-test.h"
+
+// Specify the numbers of pending events to benchmark.
+static const uint16_t benchEventCounts [] = { 1, 10, 100, 1000 };
+#define BENCH_PHASE_COUNT \
+    (sizeof (benchEventCounts) / sizeof (benchEventCounts [0]))
+
+// Specify the timing histogram bucket width and bucket count. The last
+// bucket is used for all execution times beyond the histogram range.
+#define BENCH_BUCKET_NANOS 16
+#define BENCH_BUCKET_COUNT 1024
+
+// Specify the timing statistics for a set of event notifications.
+typedef struct benchStats_t {
+    uint64_t totalNanos;
+    uint32_t count;
+    uint32_t buckets [BENCH_BUCKET_COUNT];
+} benchStats_t;
+
+// Allocate the benchmark events and task state.
+static gmosEvent_t benchEvents [GMOS_BENCH_MAX_EVENT_COUNT];
+static gmosTaskState_t consumerTask;
+static gmosTaskState_t benchTask;
+
+// Specify the benchmark progress state.
+static uint8_t benchPhase = 0;
+static benchStats_t appendStats;
+static benchStats_t duplicateStats;
+
+/*
+ * Implements the event consumer task. The event bits are not used, so
+ * the task is just suspended again.
+ */
+static gmosTaskStatus_t benchConsumerTaskFn (void* nullData)
+{
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Sets the event bits for the specified number of events, updating
+ * the timing statistics for each event notification.
+ */
+static void benchNotifyEvents (uint16_t eventCount, benchStats_t* stats)
+{
+    uint64_t startNanos;
+    uint64_t callNanos;
+    uint32_t bucket;
+    uint16_t i;
+
+    for (i = 0; i < eventCount; i++) {
+        startNanos = gmosTestGetHostNanos ();
+        gmosEventSetBits (&(benchEvents [i]), 1);
+        callNanos = gmosTestGetHostNanos () - startNanos;
+        bucket = (uint32_t) (callNanos / BENCH_BUCKET_NANOS);
+        if (bucket >= BENCH_BUCKET_COUNT) {
+            bucket = BENCH_BUCKET_COUNT - 1;
+        }
+        stats->buckets [bucket] += 1;
+        stats->totalNanos += callNanos;
+        stats->count += 1;
+    }
+}
+
+/*
+ * Logs the timing statistics for a set of event notifications and then
+ * resets them.
+ */
+static void benchLogStats (const char* name, uint16_t eventCount,
+    benchStats_t* stats)
+{
+    uint32_t countLimit = stats->count - (stats->count / 1000);
+    uint32_t countTotal = 0;
+    uint32_t bucket;
+
+    // Find the bucket containing the 99.9th percentile.
+    for (bucket = 0; bucket < BENCH_BUCKET_COUNT - 1; bucket++) {
+        countTotal += stats->buckets [bucket];
+        if (countTotal >= countLimit) {
+            break;
+        }
+    }
+    GMOS_LOG_FMT (LOG_INFO,
+        "%s, %4ld pending : mean %4ld ns, 99.9%% < %5ld ns.",
+        name, (long) eventCount,
+        (long) (stats->totalNanos / stats->count),
+        (long) ((bucket + 1) * BENCH_BUCKET_NANOS));
+    memset (stats, 0, sizeof (benchStats_t));
+}
+
+/*
+ * Implements the benchmark task. Each task run performs one benchmark
+ * iteration. The task is then delayed, which allows the scheduler to
+ * drain the event queue before the next iteration.
+ */
+static gmosTaskStatus_t benchTaskFn (void* nullData)
+{
+    uint16_t eventCount = benchEventCounts [benchPhase];
+
+    // Run the next benchmark iteration.
+    benchNotifyEvents (eventCount, &appendStats);
+    benchNotifyEvents (eventCount, &duplicateStats);
+    if (appendStats.count < GMOS_BENCH_NOTIFY_COUNT) {
+        return GMOS_TASK_RUN_LATER (1);
+    }
+
+    // Report the results at the end of each benchmark phase.
+    benchLogStats ("Append   ", eventCount, &appendStats);
+    benchLogStats ("Duplicate", eventCount, &duplicateStats);
+    benchPhase += 1;
+    if (benchPhase < BENCH_PHASE_COUNT) {
+        return GMOS_TASK_RUN_LATER (1);
+    }
+    gmosTestComplete ("event-queue-bench");
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Sets up the benchmark application.
+ */
+void gmosAppInit (void)
+{
+    uint16_t i;
+
+    consumerTask.taskTickFn = benchConsumerTaskFn;
+    consumerTask.taskData = NULL;
+    consumerTask.taskName = "Consumer";
+    gmosSchedulerTaskStart (&consumerTask);
+    for (i = 0; i < GMOS_BENCH_MAX_EVENT_COUNT; i++) {
+        gmosEventInit (&(benchEvents [i]), &consumerTask);
+    }
+    benchTask.taskTickFn = benchTaskFn;
+    benchTask.taskData = NULL;
+    benchTask.taskName = "Benchmark";
+    gmosSchedulerTaskStart (&benchTask);
+}
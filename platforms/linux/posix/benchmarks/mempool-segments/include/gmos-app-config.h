@@ -0,0 +1,47 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the memory pool segment size benchmark application
+ * configuration options. The standard and large segment sizes are
+ * selected using the test build variant compiler options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the benchmark.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Specify a memory pool that can hold the complete message mix with
+ * the smallest standard segment size.
+ */
+#define GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER 256
+#define GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER 8
+
+/*
+ * Specify the size of the record used for the field read benchmark and
+ * the number of passes over the record to measure.
+ */
+#define GMOS_BENCH_RECORD_SIZE 1500
+#define GMOS_BENCH_PASS_COUNT 2000
+
+#endif // GMOS_APP_CONFIG_H
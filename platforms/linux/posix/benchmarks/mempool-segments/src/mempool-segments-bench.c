@@ -0,0 +1,172 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a benchmark for the memory pool segment size options. The
+ * first part reports the memory efficiency for a mix of message sizes,
+ * which is the total message size as a percentage of the allocated
+ * segment capacity. The second part reports the number of segments
+ * used to hold a large record and the mean host execution time for a
+ * pass over the record that reads each 4 byte field in turn. All times
+ * include the host timer overhead.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-mempool.h"
+#include "gmos-buffers.h"
+#include "gmos-test.h"
+
+// Specify the message sizes used for the memory efficiency benchmark.
+static const uint16_t benchMessageSizes [] = {
+    3, 12, 40, 100, 300, 600, 1500 };
+#define BENCH_MESSAGE_COUNT \
+    (sizeof (benchMessageSizes) / sizeof (benchMessageSizes [0]))
+
+// Allocate the benchmark buffers and task state.
+static gmosBuffer_t benchBuffers [BENCH_MESSAGE_COUNT];
+static gmosTaskState_t benchTask;
+
+// Allocate the benchmark data area.
+static uint8_t benchData [GMOS_BENCH_RECORD_SIZE];
+
+/*
+ * Determines the number of segments and the total segment capacity
+ * used by a buffer.
+ */
+static uint16_t benchBufferSegments (
+    gmosBuffer_t* buffer, uint32_t* capacity)
+{
+    gmosMempoolSegment_t* segment;
+    uint16_t segmentCount = 0;
+
+    *capacity = 0;
+    for (segment = buffer->segmentList;
+        segment != NULL; segment = segment->nextSegment) {
+        *capacity += gmosMempoolGetSegmentSize (segment);
+        segmentCount += 1;
+    }
+    return segmentCount;
+}
+
+/*
+ * Reports the memory efficiency for the message mix.
+ */
+static void benchMessageMix (void)
+{
+    uint32_t totalBytes = 0;
+    uint32_t totalCapacity = 0;
+    uint32_t capacity;
+    uint16_t segmentCount = 0;
+    uint8_t i;
+
+    for (i = 0; i < BENCH_MESSAGE_COUNT; i++) {
+        GMOS_TEST_CHECK (gmosBufferAppend (
+            &(benchBuffers [i]), benchData, benchMessageSizes [i]));
+        segmentCount += benchBufferSegments (
+            &(benchBuffers [i]), &capacity);
+        totalBytes += benchMessageSizes [i];
+        totalCapacity += capacity;
+    }
+    GMOS_LOG_FMT (LOG_INFO,
+        "Message mix : %ld bytes, %ld segments, capacity %ld, "
+        "efficiency %ld.%ld%%.", (long) totalBytes, (long) segmentCount,
+        (long) totalCapacity, (long) (totalBytes * 100 / totalCapacity),
+        (long) ((totalBytes * 1000 / totalCapacity) % 10));
+    for (i = 0; i < BENCH_MESSAGE_COUNT; i++) {
+        gmosBufferReset (&(benchBuffers [i]), 0);
+    }
+}
+
+/*
+ * Reports the time taken to read all the 4 byte fields in a record.
+ */
+static void benchRecordRead (void)
+{
+    gmosBuffer_t* buffer = &(benchBuffers [0]);
+    uint64_t startNanos;
+    uint64_t totalNanos;
+    uint32_t capacity;
+    uint32_t checksum = 0;
+    uint16_t segmentCount;
+    uint16_t offset;
+    uint16_t i;
+    uint8_t field [4];
+
+    for (offset = 0; offset < GMOS_BENCH_RECORD_SIZE; offset++) {
+        benchData [offset] = (uint8_t) offset;
+    }
+    GMOS_TEST_CHECK (gmosBufferAppend (
+        buffer, benchData, GMOS_BENCH_RECORD_SIZE));
+    segmentCount = benchBufferSegments (buffer, &capacity);
+
+    // Time the read passes over the record.
+    startNanos = gmosTestGetHostNanos ();
+    for (i = 0; i < GMOS_BENCH_PASS_COUNT; i++) {
+        for (offset = 0; offset + 4 <= GMOS_BENCH_RECORD_SIZE;
+            offset += 4) {
+            gmosBufferRead (buffer, offset, field, 4);
+            checksum += field [0];
+        }
+    }
+    totalNanos = gmosTestGetHostNanos () - startNanos;
+    GMOS_TEST_CHECK (checksum != 0);
+    GMOS_LOG_FMT (LOG_INFO,
+        "Record read : %ld bytes, %ld segments, %ld ns per pass.",
+        (long) GMOS_BENCH_RECORD_SIZE, (long) segmentCount,
+        (long) (totalNanos / GMOS_BENCH_PASS_COUNT));
+    gmosBufferReset (buffer, 0);
+}
+
+/*
+ * Implements the benchmark task, which runs both parts of the
+ * benchmark and then checks that all segments have been released.
+ */
+static gmosTaskStatus_t benchTaskFn (void* nullData)
+{
+    GMOS_LOG_FMT (LOG_INFO,
+        "Segment size %ld, large segment size %ld.",
+        (long) GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE,
+        (long) GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE);
+    benchMessageMix ();
+    benchRecordRead ();
+    GMOS_TEST_CHECK (gmosMempoolSegmentsAvailable () ==
+        GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER);
+    gmosTestComplete ("mempool-segments-bench");
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Sets up the benchmark application.
+ */
+void gmosAppInit (void)
+{
+    uint8_t i;
+
+    for (i = 0; i < BENCH_MESSAGE_COUNT; i++) {
+        gmosBufferInit (&(benchBuffers [i]));
+    }
+    benchTask.taskTickFn = benchTaskFn;
+    benchTask.taskData = NULL;
+    benchTask.taskName = "Benchmark";
+    gmosSchedulerTaskStart (&benchTask);
+}
@@ -0,0 +1,56 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the scheduler task queue benchmark application
+ * configuration options. The task queue implementation is selected
+ * using the test build variant compiler options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the benchmark.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Run the benchmark in virtual time, so that idle periods between task
+ * deadlines do not contribute to the measured execution time.
+ */
+#define GMOS_CONFIG_POSIX_VIRTUAL_TIME true
+
+/*
+ * Specify the maximum number of timed tasks to use.
+ */
+#define GMOS_BENCH_MAX_TASK_COUNT 1000
+
+/*
+ * Specify the number of task executions to measure for each set of
+ * timed tasks.
+ */
+#define GMOS_BENCH_RUN_COUNT 200000
+
+/*
+ * Specify the maximum task delay as an integer number of system timer
+ * ticks.
+ */
+#define GMOS_BENCH_MAX_DELAY 4096
+
+#endif // GMOS_APP_CONFIG_H
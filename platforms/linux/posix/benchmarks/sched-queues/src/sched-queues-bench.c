@@ -0,0 +1,138 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a benchmark for the scheduled task queue insert and
+ * expiry operations. Sets of 10, 100 and 1000 timed tasks are run in
+ * virtual time, with each task rescheduling itself using a random
+ * delay. The host execution time per task run is then reported, which
+ * includes the cost of expiring the task from the scheduled task queue
+ * and reinserting it. The benchmark is built for both the sorted list
+ * and timing wheel task queue implementations.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-test.h"
+
+// Specify the sets of timed task counts to benchmark.
+static const uint16_t benchTaskCounts [] = { 10, 100, 1000 };
+#define BENCH_PHASE_COUNT \
+    (sizeof (benchTaskCounts) / sizeof (benchTaskCounts [0]))
+
+// Allocate the timed task and control task state.
+static gmosTaskState_t timedTasks [GMOS_BENCH_MAX_TASK_COUNT];
+static gmosTaskState_t controlTask;
+
+// Specify the benchmark progress state.
+static uint8_t benchPhase = 0;
+static bool benchActive = false;
+static bool benchDraining = false;
+static uint32_t benchRunCount;
+static uint64_t benchStartTime;
+static uint64_t benchEndTime;
+
+/*
+ * Implements the timed task function. This reschedules the task using
+ * a random delay while the benchmark phase is active and suspends the
+ * task otherwise.
+ */
+static gmosTaskStatus_t benchTimedTaskFn (void* nullData)
+{
+    if (!benchActive) {
+        return GMOS_TASK_SUSPEND;
+    }
+    benchRunCount += 1;
+    if (benchRunCount >= GMOS_BENCH_RUN_COUNT) {
+        benchEndTime = gmosTestGetHostNanos ();
+        benchActive = false;
+        gmosSchedulerTaskResume (&controlTask);
+    }
+    return GMOS_TASK_RUN_LATER (
+        1 + gmosTestRandom (GMOS_BENCH_MAX_DELAY));
+}
+
+/*
+ * Implements the control task function. This starts each benchmark
+ * phase and reports the results. Timed tasks from the previous phase
+ * are allowed to drain from the task queues before starting the next
+ * phase.
+ */
+static gmosTaskStatus_t benchControlTaskFn (void* nullData)
+{
+    uint16_t taskCount;
+    uint64_t elapsedNanos;
+    uint32_t i;
+
+    // Wait for the timed tasks to be suspended after each phase.
+    if (benchDraining) {
+        benchDraining = false;
+        return GMOS_TASK_RUN_LATER (GMOS_BENCH_MAX_DELAY + 1);
+    }
+
+    // Report the results for the previous phase.
+    if (benchPhase > 0) {
+        taskCount = benchTaskCounts [benchPhase - 1];
+        elapsedNanos = benchEndTime - benchStartTime;
+        GMOS_LOG_FMT (LOG_INFO,
+            "%s, %4ld tasks : %5ld ns per task run.",
+            GMOS_CONFIG_SCHEDULER_TIMING_WHEEL ?
+            "Timing wheel" : "Sorted list ", (long) taskCount,
+            (long) (elapsedNanos / GMOS_BENCH_RUN_COUNT));
+    }
+
+    // Start the next benchmark phase.
+    if (benchPhase < BENCH_PHASE_COUNT) {
+        taskCount = benchTaskCounts [benchPhase];
+        benchPhase += 1;
+        benchActive = true;
+        benchDraining = true;
+        benchRunCount = 0;
+        benchStartTime = gmosTestGetHostNanos ();
+        for (i = 0; i < taskCount; i++) {
+            gmosSchedulerTaskResume (&(timedTasks [i]));
+        }
+        return GMOS_TASK_SUSPEND;
+    }
+    gmosTestComplete ("sched-queues-bench");
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Sets up the benchmark application. All the timed tasks are initially
+ * suspended.
+ */
+void gmosAppInit (void)
+{
+    uint32_t i;
+
+    for (i = 0; i < GMOS_BENCH_MAX_TASK_COUNT; i++) {
+        timedTasks [i].taskTickFn = benchTimedTaskFn;
+        timedTasks [i].taskData = NULL;
+        timedTasks [i].taskName = "Timed";
+        gmosSchedulerTaskStart (&(timedTasks [i]));
+    }
+    controlTask.taskTickFn = benchControlTaskFn;
+    controlTask.taskData = NULL;
+    controlTask.taskName = "Control";
+    gmosSchedulerTaskStart (&controlTask);
+}
@@ -0,0 +1,60 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the POSIX host demo application configuration options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the demo application.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_DEBUG
+
+/*
+ * Specifies the interval between heartbeat log messages as an integer
+ * number of seconds.
+ */
+#define GMOS_DEMO_APP_HEARTBEAT_INTERVAL 1
+
+/*
+ * Specifies the demo application run time as an integer number of
+ * seconds, after which the host process will exit. A value of zero
+ * runs the demo application indefinitely.
+ */
+#ifndef GMOS_DEMO_APP_RUN_TIME
+#define GMOS_DEMO_APP_RUN_TIME 0
+#endif
+
+/*
+ * Specifies the host file to be used as the EEPROM backing store.
+ */
+#ifndef GMOS_DEMO_APP_EEPROM_FILE
+#define GMOS_DEMO_APP_EEPROM_FILE "/tmp/gmos-demo-eeprom.bin"
+#endif
+
+/*
+ * Specifies the host file to be used as the flash memory backing store.
+ */
+#ifndef GMOS_DEMO_APP_FLASH_FILE
+#define GMOS_DEMO_APP_FLASH_FILE "/tmp/gmos-demo-flash.bin"
+#endif
+
+#endif // GMOS_APP_CONFIG_H
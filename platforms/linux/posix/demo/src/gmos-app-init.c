@@ -0,0 +1,155 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements the main entry point for the POSIX host demo application.
+ * This uses a file backed EEPROM to maintain a persistent start count
+ * and runs a simple heartbeat task.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-driver-eeprom.h"
+#include "gmos-driver-flash.h"
+#include "posix-driver-eeprom.h"
+#include "posix-driver-flash.h"
+
+// Specify the EEPROM record tag used for the start count.
+#define DEMO_APP_START_COUNT_TAG 0x01
+
+// Allocate the file backed EEPROM data structures.
+static const gmosPalEepromConfig_t eepromConfig = {
+    GMOS_DEMO_APP_EEPROM_FILE, 1024 };
+static gmosPalEepromState_t eepromState;
+static gmosDriverEeprom_t eeprom =
+    GMOS_DRIVER_EEPROM_PAL_CONFIG (&eepromState, &eepromConfig);
+
+// Allocate the file backed flash memory data structures.
+static const gmosPalFlashConfigPosix_t flashConfig = {
+    GMOS_DEMO_APP_FLASH_FILE, 4096, 64 };
+static gmosPalFlashStatePosix_t flashState;
+static gmosDriverFlash_t flash = GMOS_DRIVER_FLASH_PAL_CONFIG (
+    &flashState, &flashConfig, gmosPalFlashInitPosix);
+
+// Allocate the heartbeat task state.
+static gmosTaskState_t heartbeatTask;
+static uint32_t heartbeatCount = 0;
+
+/*
+ * Implements the heartbeat task, which periodically logs the current
+ * system timer value and exits once the configured run time expires.
+ */
+static gmosTaskStatus_t heartbeatTaskFn (void* nullData)
+{
+    heartbeatCount += 1;
+    GMOS_LOG_FMT (LOG_INFO, "Heartbeat %ld at timer 0x%08lX.",
+        (long) heartbeatCount, (unsigned long) gmosPalGetTimer ());
+
+    // Exit the host process on completion.
+    if ((GMOS_DEMO_APP_RUN_TIME > 0) &&
+        (heartbeatCount * GMOS_DEMO_APP_HEARTBEAT_INTERVAL >=
+        GMOS_DEMO_APP_RUN_TIME)) {
+        gmosPalExit (0);
+    }
+    return GMOS_TASK_RUN_LATER (
+        GMOS_MS_TO_TICKS (GMOS_DEMO_APP_HEARTBEAT_INTERVAL * 1000));
+}
+
+/*
+ * Updates the persistent start count that is held in the EEPROM.
+ */
+static void demoStartCountUpdate (void)
+{
+    uint8_t countData [4] = { 0, 0, 0, 0 };
+    uint32_t startCount;
+
+    // Create the start count record if required.
+    gmosDriverEepromRecordCreate (&eeprom, DEMO_APP_START_COUNT_TAG,
+        countData, sizeof (countData), NULL, NULL);
+
+    // Read and increment the start count.
+    if (gmosDriverEepromRecordRead (&eeprom, DEMO_APP_START_COUNT_TAG,
+        countData, 0, sizeof (countData)) !=
+        GMOS_DRIVER_EEPROM_STATUS_SUCCESS) {
+        GMOS_LOG (LOG_ERROR, "Failed to read EEPROM start count.");
+        return;
+    }
+    startCount = ((uint32_t) countData [0]) |
+        (((uint32_t) countData [1]) << 8) |
+        (((uint32_t) countData [2]) << 16) |
+        (((uint32_t) countData [3]) << 24);
+    startCount += 1;
+    countData [0] = (uint8_t) startCount;
+    countData [1] = (uint8_t) (startCount >> 8);
+    countData [2] = (uint8_t) (startCount >> 16);
+    countData [3] = (uint8_t) (startCount >> 24);
+    gmosDriverEepromRecordWrite (&eeprom, DEMO_APP_START_COUNT_TAG,
+        countData, sizeof (countData), NULL, NULL);
+    GMOS_LOG_FMT (LOG_INFO, "Demo application start count %ld.",
+        (long) startCount);
+}
+
+/*
+ * Sets up the demo application. The main scheduler loop will
+ * automatically be started on returning from this function.
+ */
+void gmosAppInit (void)
+{
+    // Print some information to the debug log.
+    GMOS_LOG (LOG_INFO,
+        "Initialising GubbinsMOS demo application for POSIX hosts");
+
+    // Initialise the file backed EEPROM and update the start count.
+    if (gmosDriverEepromInit (&eeprom, true, false, 0)) {
+        demoStartCountUpdate ();
+    } else {
+        GMOS_LOG (LOG_ERROR, "Failed to initialise EEPROM.");
+    }
+
+    // Initialise the file backed flash memory.
+    if (gmosDriverFlashInit (&flash, NULL)) {
+        GMOS_LOG_FMT (LOG_INFO,
+            "Flash memory has %ld blocks of %ld bytes.",
+            (long) flash.blockCount, (long) flash.blockSize);
+    } else {
+        GMOS_LOG (LOG_ERROR, "Failed to initialise flash memory.");
+    }
+
+    // Run the heartbeat task.
+    heartbeatTask.taskTickFn = heartbeatTaskFn;
+    heartbeatTask.taskData = NULL;
+    heartbeatTask.taskName = "Heartbeat";
+    gmosSchedulerTaskStart (&heartbeatTask);
+}
+
+/*
+ * Sets up the demo application on a secondary processor core. The demo
+ * application does not run any tasks on the secondary cores, so this
+ * just logs the core startup.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+void gmosAppCoreInit (uint8_t coreId)
+{
+    GMOS_LOG_FMT (LOG_INFO,
+        "Initialising demo application on core %d.", coreId);
+}
+#endif
@@ -0,0 +1,138 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the POSIX host platform default configuration options.
+ */
+
+#ifndef GMOS_PAL_CONFIG_H
+#define GMOS_PAL_CONFIG_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * Specify the initial value of the system timer on startup. Setting
+ * this close to the 32-bit wrap point allows timer wraparound handling
+ * to be exercised shortly after startup.
+ */
+#ifndef GMOS_CONFIG_POSIX_SYSTEM_TIMER_OFFSET
+#define GMOS_CONFIG_POSIX_SYSTEM_TIMER_OFFSET 0
+#endif
+
+/**
+ * Specify whether the system timer should use virtual time instead of
+ * the host monotonic clock. In virtual time mode, idle requests advance
+ * the system timer directly to the next scheduled deadline without
+ * sleeping, so that long running behaviour can be simulated quickly
+ * and deterministically. Task execution takes no virtual time, so
+ * scheduler busy waiting is not supported in this mode.
+ */
+#ifndef GMOS_CONFIG_POSIX_VIRTUAL_TIME
+#define GMOS_CONFIG_POSIX_VIRTUAL_TIME false
+#endif
+
+/**
+ * Specify the virtual time limit as an integer number of seconds. When
+ * using virtual time, the host process will exit once the specified
+ * amount of virtual time has elapsed. A value of zero disables the
+ * virtual time limit.
+ */
+#ifndef GMOS_CONFIG_POSIX_VIRTUAL_TIME_LIMIT
+#define GMOS_CONFIG_POSIX_VIRTUAL_TIME_LIMIT 0
+#endif
+
+/**
+ * Specify the random number generator seed to use in virtual time
+ * mode. This may be overridden at runtime by setting the
+ * 'GMOS_POSIX_RANDOM_SEED' environment variable.
+ */
+#ifndef GMOS_CONFIG_POSIX_RANDOM_SEED
+#define GMOS_CONFIG_POSIX_RANDOM_SEED 0x5EED5EED
+#endif
+
+/**
+ * Specify whether log messages should be written to the standard error
+ * stream instead of the standard output stream.
+ */
+#ifndef GMOS_CONFIG_POSIX_LOG_TO_STDERR
+#define GMOS_CONFIG_POSIX_LOG_TO_STDERR false
+#endif
+
+/**
+ * This configuration option specifies the size of individual memory
+ * pool segments as an integer number of bytes. This must be an integer
+ * multiple of 4.
+ */
+#ifndef GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE
+#define GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE 64
+#endif
+
+/**
+ * This configuration option specifies the number of memory pool
+ * segments to be allocated. The default memory pool size for POSIX
+ * hosts is set to 64K bytes.
+ */
+#ifndef GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER
+#define GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER 1024
+#endif
+
+/**
+ * Select the host operating system random number source by default.
+ * In virtual time mode, the common seeded random number generator is
+ * used instead so that simulation runs are reproducible.
+ */
+#ifndef GMOS_CONFIG_RANDOM_SOUCE
+#if GMOS_CONFIG_POSIX_VIRTUAL_TIME
+#define GMOS_CONFIG_RANDOM_SOUCE GMOS_RANDOM_SOURCE_XOSHIRO128PP
+#else
+#define GMOS_CONFIG_RANDOM_SOUCE GMOS_RANDOM_SOURCE_PLATFORM_SPECIFIC
+#endif
+#endif
+
+/**
+ * The hardware real time clock is not currently supported for this
+ * platform.
+ */
+#define GMOS_CONFIG_RTC_SOFTWARE_EMULATION true
+
+// Use the standard C library for heap based memory allocation.
+#define GMOS_MALLOC(_size_) malloc (_size_)
+#define GMOS_CALLOC(_num_, _size_) calloc (_num_, _size_)
+#define GMOS_FREE(_mem_) free (_mem_)
+
+// The system timer uses a 1 kHz millisecond resolution timebase.
+#define GMOS_CONFIG_SYSTEM_TIMER_FREQUENCY 1000
+
+// The host monotonic clock is used as the platform cycle counter, with
+// nanosecond resolution.
+#define GMOS_CONFIG_PAL_CYCLE_COUNTER true
+#define GMOS_CONFIG_PAL_CYCLE_COUNTER_FREQUENCY 1000000000
+
+// When multiple scheduler cores are configured, each core is emulated
+// using a separate host thread with a thread local core index.
+#if defined (GMOS_CONFIG_SCHEDULER_CORES) && \
+    (GMOS_CONFIG_SCHEDULER_CORES > 1)
+#if GMOS_CONFIG_POSIX_VIRTUAL_TIME
+#error "Virtual time does not support multiple scheduler cores."
+#endif
+extern __thread uint8_t gmosPalPosixCoreId;
+#define GMOS_PAL_CORE_ID gmosPalPosixCoreId
+#endif
+
+#endif // GMOS_PAL_CONFIG_H
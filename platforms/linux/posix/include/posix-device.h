@@ -0,0 +1,58 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * This header provides platform specific definitions for running
+ * GubbinsMOS as a native process on POSIX compliant hosts.
+ */
+
+#ifndef POSIX_DEVICE_H
+#define POSIX_DEVICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Initialises the POSIX system timer implementation. This captures the
+ * host monotonic clock reference time and sets up the event file
+ * descriptor that is used to wake the scheduler from idle.
+ */
+void gmosPalSystemTimerInit (void);
+
+/**
+ * Adds a host file descriptor to the set of file descriptors that will
+ * wake the scheduler from idle when they become ready for reading. This
+ * allows drivers that use host sockets or device files to be serviced
+ * without polling.
+ * @param fileDesc This is the host file descriptor that is to be added
+ *     to the idle wake set.
+ * @return Returns a boolean value which will be set to 'true' if the
+ *     file descriptor was added to the idle wake set and 'false'
+ *     otherwise.
+ */
+bool gmosPalPosixIdleWakeAttach (int fileDesc);
+
+/**
+ * Removes a host file descriptor from the set of file descriptors that
+ * will wake the scheduler from idle.
+ * @param fileDesc This is the host file descriptor that is to be
+ *     removed from the idle wake set.
+ */
+void gmosPalPosixIdleWakeDetach (int fileDesc);
+
+#endif // POSIX_DEVICE_H
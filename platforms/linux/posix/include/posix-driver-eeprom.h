@@ -0,0 +1,64 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * This header provides the POSIX file backed EEPROM definitions. The
+ * EEPROM contents are held in a host file which is memory mapped into
+ * the process address space, so they persist over process restarts.
+ */
+
+#ifndef POSIX_DRIVER_EEPROM_H
+#define POSIX_DRIVER_EEPROM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "gmos-config.h"
+#include "gmos-driver-eeprom.h"
+
+// Software emulation uses the common EEPROM data structures instead.
+#if !GMOS_CONFIG_EEPROM_SOFTWARE_EMULATION
+
+/**
+ * Defines the platform specific EEPROM driver configuration settings
+ * data structure.
+ */
+typedef struct gmosPalEepromConfig_t {
+
+    // Specifies the path to the host file that is used as the EEPROM
+    // backing store. It will be created if not already present.
+    const char* fileName;
+
+    // Specifies the emulated EEPROM size as an integer number of bytes
+    // not exceeding 64K.
+    uint16_t memSize;
+
+} gmosPalEepromConfig_t;
+
+/**
+ * Defines the platform specific EEPROM driver dynamic data structure.
+ */
+typedef struct gmosPalEepromState_t {
+
+    // Specifies the host file descriptor for the backing store.
+    int fileDesc;
+
+} gmosPalEepromState_t;
+
+#endif // !GMOS_CONFIG_EEPROM_SOFTWARE_EMULATION
+#endif // POSIX_DRIVER_EEPROM_H
@@ -0,0 +1,73 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * This file defines the data structures and support functions for the
+ * POSIX file backed flash memory driver. This emulates a NOR flash
+ * memory device using a host file for persistent storage.
+ */
+
+#ifndef POSIX_DRIVER_FLASH_H
+#define POSIX_DRIVER_FLASH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "gmos-driver-flash.h"
+
+/**
+ * Defines the platform specific flash memory configuration settings
+ * data structure to be used for file backed flash memory.
+ */
+typedef struct gmosPalFlashConfigPosix_t {
+
+    // Specifies the path to the host file that is used as the flash
+    // memory backing store. It will be created if not already present.
+    const char* fileName;
+
+    // Specifies the emulated flash memory erase block size. This must
+    // be a power of two.
+    uint32_t blockSize;
+
+    // Specifies the number of emulated flash memory erase blocks.
+    uint16_t blockCount;
+
+} gmosPalFlashConfigPosix_t;
+
+/**
+ * Defines the platform specific flash memory dynamic data structure
+ * to be used for file backed flash memory.
+ */
+typedef struct gmosPalFlashStatePosix_t {
+
+    // Specifies the host file descriptor for the backing store.
+    int fileDesc;
+
+} gmosPalFlashStatePosix_t;
+
+/**
+ * Defines the platform specific initialisation function to be used for
+ * file backed flash memory.
+ * @param flash This is the flash memory device data structure that is
+ *     to be initialised.
+ * @return Returns a boolean value which will be set to 'true' on
+ *     successful initialisation and 'false' otherwise.
+ */
+bool gmosPalFlashInitPosix (gmosDriverFlash_t* flash);
+
+#endif // POSIX_DRIVER_FLASH_H
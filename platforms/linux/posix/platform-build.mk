@@ -0,0 +1,71 @@
+#
+# The Gubbins Microcontroller Operating System
+#
+# Copyright 2026 Zynaptic Limited
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+# implied. See the License for the specific language governing
+# permissions and limitations under the License.
+#
+
+#
+# This is the makefile fragment for building the platform specific
+# source files for POSIX compliant hosts.
+#
+
+# List all the header directories that are required to build the
+# platform source code.
+PLATFORM_HEADER_DIRS = \
+	${GMOS_APP_DIR}/include \
+	${GMOS_GIT_DIR}/common/include \
+	${TARGET_PLATFORM_DIR}/include
+
+# List all the platform object files that need to be built.
+PLATFORM_OBJ_FILE_NAMES = \
+	gmos-platform.o \
+	posix-device.o \
+	posix-timer.o \
+	posix-driver-flash.o \
+	posix-driver-eeprom.o
+
+# Specify the local build directory.
+LOCAL_DIR = ${GMOS_BUILD_DIR}/platform
+
+# Specify the object files that need to be built.
+PLATFORM_OBJ_FILES = ${addprefix ${LOCAL_DIR}/, ${PLATFORM_OBJ_FILE_NAMES}}
+
+# Import generated dependency information if available.
+-include $(PLATFORM_OBJ_FILES:.o=.d)
+
+# Run the C compiler with the standard options.
+${LOCAL_DIR}/%.o : ${TARGET_PLATFORM_DIR}/src/%.c | ${LOCAL_DIR}
+	${CC} ${CFLAGS} ${addprefix -I, ${PLATFORM_HEADER_DIRS}} -o $@ $<
+
+# Timestamp the target platform object files.
+${LOCAL_DIR}/timestamp : ${PLATFORM_OBJ_FILES}
+	touch $@
+
+# Create the local build directory.
+${LOCAL_DIR} :
+	mkdir -p $@
+
+# Generate the firmware binary in Intel hex format. This is not used
+# on POSIX hosts, but is generated for consistency with other targets.
+${GMOS_BUILD_DIR}/firmware.hex : ${GMOS_BUILD_DIR}/firmware.elf
+	${OC} -S -O ihex $< $@
+
+# Generate the firmware binary as a raw binary file. This is not used
+# on POSIX hosts, but is generated for consistency with other targets.
+${GMOS_BUILD_DIR}/firmware.bin : ${GMOS_BUILD_DIR}/firmware.elf
+	${OC} -S -O binary $< $@
+
+# Run the compiled executable as a native host process.
+run : ${GMOS_BUILD_DIR}/firmware.elf
+	$<
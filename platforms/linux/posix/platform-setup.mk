@@ -0,0 +1,72 @@
+#
+# The Gubbins Microcontroller Operating System
+#
+# Copyright 2026 Zynaptic Limited
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+# implied. See the License for the specific language governing
+# permissions and limitations under the License.
+#
+
+#
+# This is the makefile fragment for setting up the compiler and build
+# tool options for running GubbinsMOS as a native process on POSIX
+# compliant hosts, using the host gcc compiler.
+#
+
+# Specify the toolchain prefix. By default this uses the native host
+# toolchain, but it may be set to the prefix of a cross compiler if
+# required.
+ifndef POSIX_GCC_TOOLCHAIN_PREFIX
+POSIX_GCC_TOOLCHAIN_PREFIX =
+endif
+
+# Specify the compiler optimisation level. By default this uses full
+# optimisation so that profiling results are representative.
+ifndef GMOS_POSIX_OPT_LEVEL
+GMOS_POSIX_OPT_LEVEL = 2
+endif
+
+CC = $(POSIX_GCC_TOOLCHAIN_PREFIX)gcc
+AS = $(POSIX_GCC_TOOLCHAIN_PREFIX)gcc
+LD = $(POSIX_GCC_TOOLCHAIN_PREFIX)gcc
+OC = $(POSIX_GCC_TOOLCHAIN_PREFIX)objcopy
+OD = $(POSIX_GCC_TOOLCHAIN_PREFIX)objdump
+OS = $(POSIX_GCC_TOOLCHAIN_PREFIX)size
+
+# C compiler options. Frame pointers are retained so that call graphs
+# can be captured using 'perf'. As for the embedded targets, unused
+# functions are discarded at link time, which means that the common
+# drivers do not require platform support unless they are used.
+CFLAGS += -c
+CFLAGS += -O${GMOS_POSIX_OPT_LEVEL}
+CFLAGS += -Wall
+CFLAGS += -g
+CFLAGS += -fno-omit-frame-pointer
+CFLAGS += -ffunction-sections
+CFLAGS += -fdata-sections
+CFLAGS += -pthread
+CFLAGS += -D_GNU_SOURCE
+CFLAGS += -MMD
+
+# Linker options.
+LDFLAGS += -pthread
+LDFLAGS += -Wl,--gc-sections
+
+# Optionally build with the specified set of runtime sanitizers, such
+# as 'address,undefined' or 'thread'.
+ifdef GMOS_POSIX_SANITIZE
+CFLAGS += -fsanitize=${GMOS_POSIX_SANITIZE}
+LDFLAGS += -fsanitize=${GMOS_POSIX_SANITIZE}
+endif
+
+# Required linker library names.
+LDLIBS += rt
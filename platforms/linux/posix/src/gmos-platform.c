@@ -0,0 +1,258 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements the common API for the GubbinsMOS platform abstraction
+ * layer when running as a native process on POSIX compliant hosts.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/random.h>
+
+#include "gmos-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "posix-device.h"
+
+// Provide mapping of log levels to human readable strings.
+static const char* logLevelNames [] = {
+    "GMOS-VERBOSE", "GMOS-DEBUG  ", "GMOS-INFO   ",
+    "GMOS-WARNING", "GMOS-ERROR  ", "GMOS-FAILURE" };
+
+// Specify the platform mutex. This is a recursive mutex which protects
+// the GubbinsMOS data structures from concurrent access by other host
+// threads, in place of disabling interrupts.
+static pthread_mutex_t palMutex =
+    PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+// Specify the host operating system mutex.
+#if GMOS_CONFIG_HOST_OS_SUPPORT
+static pthread_mutex_t hostOsMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/*
+ * Initialises the platform abstraction layer on startup.
+ */
+void gmosPalInit (void)
+{
+    // Use line buffering for the log output, so that log messages are
+    // not lost when the process is terminated.
+    setvbuf (stdout, NULL, _IOLBF, 0);
+
+    // Initialise the host timer and idle support.
+    gmosPalSystemTimerInit ();
+
+    // Seed the common random number generator in virtual time mode,
+    // using the environment variable setting if present.
+#if GMOS_CONFIG_POSIX_VIRTUAL_TIME && \
+    (GMOS_CONFIG_RANDOM_SOUCE == GMOS_RANDOM_SOURCE_XOSHIRO128PP)
+    const char* seedString = getenv ("GMOS_POSIX_RANDOM_SEED");
+    uint32_t randomSeed = GMOS_CONFIG_POSIX_RANDOM_SEED;
+    if (seedString != NULL) {
+        randomSeed = (uint32_t) strtoul (seedString, NULL, 0);
+    }
+    gmosPalAddRandomEntropy (randomSeed);
+    GMOS_LOG_FMT (LOG_INFO,
+        "Using virtual time with random seed 0x%08lX.",
+        (unsigned long) randomSeed);
+#endif
+}
+
+/*
+ * Requests that the platform abstraction layer terminate all further
+ * processing. On POSIX hosts this exits the process, using the status
+ * value as the process exit code.
+ */
+void gmosPalExit (uint8_t status)
+{
+    gmosLifecycleNotify (SCHEDULER_SHUTDOWN);
+    fflush (stdout);
+    exit (status);
+}
+
+/*
+ * Claims the main platform mutex lock.
+ */
+void gmosPalMutexLock (void)
+{
+    pthread_mutex_lock (&palMutex);
+}
+
+/*
+ * Releases the main platform mutex lock.
+ */
+void gmosPalMutexUnlock (void)
+{
+    pthread_mutex_unlock (&palMutex);
+}
+
+/*
+ * Claims the host operating system mutex lock. This is used when the
+ * GubbinsMOS scheduler is running in its own host thread, as started
+ * by 'gmosPalHostOsInit'.
+ */
+#if GMOS_CONFIG_HOST_OS_SUPPORT
+bool gmosPalHostOsMutexLock (uint16_t timeout)
+{
+    struct timespec deadline;
+    int lockStatus;
+
+    // Use a blocking lock request if no timeout is specified.
+    if (timeout == 0xFFFF) {
+        lockStatus = pthread_mutex_lock (&hostOsMutex);
+    }
+
+    // Derive the absolute timeout from the real time clock.
+    else {
+        clock_gettime (CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += timeout / 1000;
+        deadline.tv_nsec += (long) (timeout % 1000) * 1000000;
+        if (deadline.tv_nsec >= 1000000000) {
+            deadline.tv_sec += 1;
+            deadline.tv_nsec -= 1000000000;
+        }
+        lockStatus = pthread_mutex_timedlock (&hostOsMutex, &deadline);
+    }
+    return (lockStatus == 0) ? true : false;
+}
+#endif
+
+/*
+ * Releases the host operating system mutex lock.
+ */
+#if GMOS_CONFIG_HOST_OS_SUPPORT
+void gmosPalHostOsMutexUnlock (void)
+{
+    pthread_mutex_unlock (&hostOsMutex);
+}
+#endif
+
+/*
+ * Provides a platform specific method of adding entropy to the random
+ * number generator. This has no effect, since the host operating
+ * system maintains its own entropy pool.
+ */
+#if (GMOS_CONFIG_RANDOM_SOUCE == GMOS_RANDOM_SOURCE_PLATFORM_SPECIFIC)
+void gmosPalAddRandomEntropy (uint32_t randomEntropy)
+{
+    (void) randomEntropy;
+}
+#endif // GMOS_RANDOM_SOURCE_PLATFORM_SPECIFIC
+
+/*
+ * Provides a platform specific random number generator, using the host
+ * operating system random number source.
+ */
+#if (GMOS_CONFIG_RANDOM_SOUCE == GMOS_RANDOM_SOURCE_PLATFORM_SPECIFIC)
+void gmosPalGetRandomBytes (uint8_t* byteArray, size_t byteArraySize)
+{
+    ssize_t readSize;
+
+    while (byteArraySize > 0) {
+        readSize = getrandom (byteArray, byteArraySize, 0);
+        if (readSize > 0) {
+            byteArray += readSize;
+            byteArraySize -= readSize;
+        }
+    }
+}
+#endif // GMOS_RANDOM_SOURCE_PLATFORM_SPECIFIC
+
+/*
+ * Provides platform level handling of fixed string log messages.
+ */
+void gmosPalLog (const char* fileName, uint32_t lineNo,
+    gmosPalLogLevel_t logLevel, const char* msgPtr)
+{
+    gmosPalLogFmt (fileName, lineNo, logLevel, "%s", msgPtr);
+}
+
+/*
+ * Provides platform level handling of formatted log messages.
+ */
+void gmosPalLogFmt (const char* fileName, uint32_t lineNo,
+    gmosPalLogLevel_t logLevel, const char* msgPtr, ...)
+{
+    char writeBuffer [GMOS_CONFIG_LOG_MESSAGE_SIZE + 3];
+    size_t writeSize;
+    va_list args;
+    const char* levelString;
+    FILE* logStream;
+
+    // Map the log level to the corresponding text.
+    if ((logLevel < LOG_VERBOSE) || (logLevel > LOG_ERROR)) {
+        logLevel = LOG_ERROR;
+    }
+    levelString = logLevelNames [logLevel];
+
+    // Add message debug prefix.
+    if ((GMOS_CONFIG_LOG_FILE_LOCATIONS) && (fileName != NULL)) {
+        writeSize = snprintf (writeBuffer, GMOS_CONFIG_LOG_MESSAGE_SIZE,
+            "[%s:%ld] \t%s : ", fileName, (long) lineNo, levelString);
+    } else {
+        writeSize = snprintf (writeBuffer, GMOS_CONFIG_LOG_MESSAGE_SIZE,
+            "%s : ", levelString);
+    }
+
+    // Append the formatted message.
+    va_start (args, msgPtr);
+    if (writeSize < GMOS_CONFIG_LOG_MESSAGE_SIZE) {
+        char* writePtr = writeBuffer + writeSize;
+        size_t writeBufSize = GMOS_CONFIG_LOG_MESSAGE_SIZE - writeSize;
+        writeSize += vsnprintf (writePtr, writeBufSize, msgPtr, args);
+    }
+    if (writeSize > GMOS_CONFIG_LOG_MESSAGE_SIZE) {
+        writeSize = GMOS_CONFIG_LOG_MESSAGE_SIZE;
+    }
+    va_end (args);
+
+    // Append the line feed sequence.
+    if (GMOS_CONFIG_LOG_MESSAGE_CRLF) {
+        writeBuffer [writeSize++] = '\r';
+    }
+    writeBuffer [writeSize++] = '\n';
+    writeBuffer [writeSize] = '\0';
+
+    // Write the debug message to the selected output stream.
+    logStream = (GMOS_CONFIG_POSIX_LOG_TO_STDERR) ? stderr : stdout;
+    fwrite (writeBuffer, 1, writeSize, logStream);
+}
+
+/*
+ * Provides platform level handling of assert conditions. This aborts
+ * the host process so that a core dump or debugger trap is generated.
+ */
+void gmosPalAssertFail (const char* fileName, uint32_t lineNo,
+    const char* message)
+{
+    if (fileName != NULL) {
+        fprintf (stderr, "GMOS-ASSERT : [%s:%ld] %s\n",
+            fileName, (long) lineNo, (message != NULL) ? message : "");
+    } else {
+        fprintf (stderr, "GMOS-ASSERT : %s\n",
+            (message != NULL) ? message : "");
+    }
+    fflush (stdout);
+    abort ();
+}
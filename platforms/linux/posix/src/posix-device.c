@@ -0,0 +1,156 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements the main entry point for running GubbinsMOS as a native
+ * process on POSIX compliant hosts. When host OS support is enabled,
+ * the application provides the process entry point instead and the
+ * scheduler loop is run in a separate host thread. When instance
+ * support is enabled for a single core, the host test harness provides
+ * the process entry point and is responsible for stepping each
+ * GubbinsMOS instance. When multiple scheduler cores are configured,
+ * each secondary core is emulated using a separate host thread.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
+
+#include "gmos-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-mempool.h"
+#include "gmos-instance.h"
+#include "posix-device.h"
+
+// The default entry points are not used with single core instance
+// support.
+#if !GMOS_CONFIG_INSTANCE_SUPPORT || (GMOS_CONFIG_SCHEDULER_CORES > 1)
+
+// Specify the thread local core index and the instance for each core
+// when multiple scheduler cores are configured.
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+__thread uint8_t gmosPalPosixCoreId = 0;
+static gmosInstance_t coreInstances [GMOS_CONFIG_SCHEDULER_CORES];
+#endif
+
+/*
+ * Runs the scheduler loop for a secondary core. This does not return.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+static void* gmosPalSecondaryCoreThreadFn (void* coreIdPtr)
+{
+    gmosPalPosixCoreId = (uint8_t) (uintptr_t) coreIdPtr;
+    gmosInstanceCoreStart (&(coreInstances [gmosPalPosixCoreId]));
+    return NULL;
+}
+#endif
+
+/*
+ * Starts a separate host thread for each secondary core.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+static void gmosPalSecondaryCoresStart (void)
+{
+    pthread_t coreThread;
+    uintptr_t coreId;
+    int threadStatus;
+
+    for (coreId = 1; coreId < GMOS_CONFIG_SCHEDULER_CORES; coreId++) {
+        threadStatus = pthread_create (&coreThread, NULL,
+            gmosPalSecondaryCoreThreadFn, (void*) coreId);
+        GMOS_ASSERT (ASSERT_FAILURE, (threadStatus == 0),
+            "Failed to start POSIX secondary core thread.");
+        pthread_detach (coreThread);
+    }
+}
+#endif
+
+/*
+ * Initialises all the GubbinsMOS components and then runs the
+ * scheduler loop. This does not return.
+ */
+static void* gmosPalSchedulerThreadFn (void* nullPtr)
+{
+    // Initialise the common platform components. When multiple cores
+    // are configured, this also sets up the core zero instance.
+    gmosMempoolInit ();
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+    gmosInstanceInit (&(coreInstances [0]), NULL);
+#endif
+
+    // Initialise the platform abstraction layer.
+    gmosPalInit ();
+
+    // Initialise the application code.
+    gmosAppInit ();
+
+    // Start any secondary cores.
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+    gmosPalSecondaryCoresStart ();
+#endif
+
+    // Indicate scheduler startup.
+    gmosLifecycleNotify (SCHEDULER_STARTUP);
+
+    // Run the scheduler loop.
+    while (true) {
+        uint32_t execDelay = 0;
+        while (execDelay == 0) {
+            execDelay = gmosSchedulerStep ();
+        }
+        gmosPalIdle (execDelay);
+    }
+    return NULL;
+}
+
+/*
+ * Provides the main process entry point when the GubbinsMOS scheduler
+ * runs in the main process thread.
+ */
+#if !GMOS_CONFIG_HOST_OS_SUPPORT
+int main (void)
+{
+    gmosPalSchedulerThreadFn (NULL);
+    return 0;
+}
+#endif
+
+/*
+ * Runs the GubbinsMOS scheduler in an independent host thread. This
+ * should be called from the application process entry point.
+ */
+#if GMOS_CONFIG_HOST_OS_SUPPORT
+bool gmosPalHostOsInit (void)
+{
+    pthread_t schedulerThread;
+    int threadStatus;
+
+    GMOS_LOG (LOG_INFO,
+        "*** Using POSIX threads as the GubbinsMOS host OS ***");
+    threadStatus = pthread_create (&schedulerThread, NULL,
+        gmosPalSchedulerThreadFn, NULL);
+    if (threadStatus == 0) {
+        pthread_detach (schedulerThread);
+    }
+    return (threadStatus == 0) ? true : false;
+}
+#endif
+
+#endif // Default entry points.
@@ -0,0 +1,130 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements EEPROM driver functionality for POSIX hosts, using a
+ * memory mapped host file as the backing store.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "gmos-config.h"
+
+// Use the file backed EEPROM unless an alternative is selected.
+#if !GMOS_CONFIG_EEPROM_PLATFORM_LIBRARY
+#if !GMOS_CONFIG_EEPROM_SOFTWARE_EMULATION
+#include "gmos-platform.h"
+#include "gmos-driver-eeprom.h"
+#include "posix-driver-eeprom.h"
+
+/*
+ * Initialise the platform abstraction layer for the EEPROM driver.
+ */
+bool gmosPalEepromInit (gmosDriverEeprom_t* eeprom)
+{
+    const gmosPalEepromConfig_t* palConfig = eeprom->palConfig;
+    gmosPalEepromState_t* palData = eeprom->palData;
+    struct stat fileStat;
+    uint32_t resetData;
+    uint8_t* memPtr;
+    uint8_t* dstPtr;
+    uint8_t i;
+
+    // Open the backing store, creating it if required.
+    palData->fileDesc = open (palConfig->fileName,
+        O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if ((palData->fileDesc < 0) ||
+        (fstat (palData->fileDesc, &fileStat) != 0) ||
+        (ftruncate (palData->fileDesc, palConfig->memSize) != 0)) {
+        GMOS_LOG_FMT (LOG_ERROR,
+            "Failed to open EEPROM backing store '%s'.",
+            palConfig->fileName);
+        return false;
+    }
+
+    // Map the backing store into the process address space so that it
+    // can be accessed directly by the EEPROM driver.
+    memPtr = mmap (NULL, palConfig->memSize, PROT_READ | PROT_WRITE,
+        MAP_SHARED, palData->fileDesc, 0);
+    if (memPtr == MAP_FAILED) {
+        return false;
+    }
+    eeprom->baseAddress = memPtr;
+    eeprom->memSize = palConfig->memSize;
+
+    // A newly created backing store is placed in its factory reset
+    // state.
+    if (fileStat.st_size == 0) {
+        resetData = GMOS_DRIVER_EEPROM_TAG_END_MARKER;
+        dstPtr = memPtr;
+        for (i = 0; i < GMOS_CONFIG_EEPROM_TAG_SIZE; i++) {
+            *(dstPtr++) = (uint8_t) resetData;
+            resetData >>= 8;
+        }
+        for (i = 0; i < GMOS_CONFIG_EEPROM_LENGTH_SIZE; i++) {
+            *(dstPtr++) = 0;
+        }
+    }
+    return true;
+}
+
+/*
+ * Initiates a write operation for the EEPROM platform abstraction
+ * layer, using the specified address offset within the EEPROM. The
+ * write is applied directly to the memory mapped backing store, so it
+ * always completes immediately.
+ */
+bool gmosPalEepromWriteData (gmosDriverEeprom_t* eeprom,
+    uint16_t addrOffset, const uint8_t* writeData, uint16_t writeSize)
+{
+    uint8_t* dstPtr;
+
+    // Check for valid address range.
+    if (addrOffset + writeSize > eeprom->memSize) {
+        return false;
+    }
+
+    // Copy the write data or clear the selected EEPROM bytes.
+    dstPtr = eeprom->baseAddress + addrOffset;
+    if (writeData == NULL) {
+        memset (dstPtr, 0, writeSize);
+    } else {
+        memcpy (dstPtr, writeData, writeSize);
+    }
+    return true;
+}
+
+/*
+ * Polls the EEPROM platform abstraction layer to determine if an EEPROM
+ * write transaction is currently in progress. Since all writes complete
+ * immediately, this always indicates that no write is in progress.
+ */
+bool gmosPalEepromWritePoll (gmosDriverEeprom_t* eeprom)
+{
+    return false;
+}
+
+#endif // !GMOS_CONFIG_EEPROM_SOFTWARE_EMULATION
+#endif // !GMOS_CONFIG_EEPROM_PLATFORM_LIBRARY
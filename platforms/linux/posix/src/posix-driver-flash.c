@@ -0,0 +1,270 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * This file implements a GubbinsMOS flash memory driver for POSIX
+ * hosts, using a host file as the backing store. Write operations can
+ * only clear bits that are currently set, so the emulated memory has
+ * the same program and erase behaviour as conventional NOR flash.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "gmos-config.h"
+#include "gmos-platform.h"
+#include "gmos-events.h"
+#include "gmos-driver-flash.h"
+#include "posix-driver-flash.h"
+
+// Specify the size of the local buffer used for file transfers.
+#define POSIX_FLASH_BUFFER_SIZE 256
+
+/*
+ * Signals completion of a flash memory operation with the specified
+ * status and transfer size.
+ */
+static inline void gmosPalFlashCompletePosix (gmosDriverFlash_t* flash,
+    gmosDriverFlashStatus_t status, uint16_t transferSize)
+{
+    uint32_t eventBits = GMOS_DRIVER_FLASH_EVENT_COMPLETION_FLAG |
+        ((uint32_t) status);
+    eventBits |= ((uint32_t) transferSize) <<
+        GMOS_DRIVER_FLASH_EVENT_SIZE_OFFSET;
+    gmosEventAssignBits (&(flash->completionEvent), eventBits);
+}
+
+/*
+ * Sets the specified region of the backing store to the erased state.
+ */
+static bool gmosPalFlashFillErasedPosix (int fileDesc,
+    uint32_t fillAddr, uint32_t fillSize)
+{
+    uint8_t fillData [POSIX_FLASH_BUFFER_SIZE];
+    uint32_t chunkSize;
+
+    memset (fillData, 0xFF, sizeof (fillData));
+    while (fillSize > 0) {
+        chunkSize = (fillSize > POSIX_FLASH_BUFFER_SIZE) ?
+            POSIX_FLASH_BUFFER_SIZE : fillSize;
+        if (pwrite (fileDesc, fillData, chunkSize, fillAddr) !=
+            (ssize_t) chunkSize) {
+            return false;
+        }
+        fillAddr += chunkSize;
+        fillSize -= chunkSize;
+    }
+    return true;
+}
+
+/*
+ * Implements the platform specific write enable function to be used for
+ * file backed flash memory. This just updates the write enable status.
+ */
+static bool gmosPalFlashWriteEnablePosix (gmosDriverFlash_t* flash,
+    bool writeEnable)
+{
+    uint32_t eventBits;
+
+    if (writeEnable) {
+        eventBits = GMOS_DRIVER_FLASH_EVENT_COMPLETION_FLAG |
+            GMOS_DRIVER_FLASH_EVENT_WRITE_ENABLED_FLAG |
+            GMOS_DRIVER_FLASH_STATUS_SUCCESS;
+    } else {
+        eventBits = GMOS_DRIVER_FLASH_EVENT_COMPLETION_FLAG |
+            GMOS_DRIVER_FLASH_EVENT_WRITE_DISABLED_FLAG |
+            GMOS_DRIVER_FLASH_STATUS_SUCCESS;
+    }
+
+    // Indicate successful completion.
+    gmosEventAssignBits (&(flash->completionEvent), eventBits);
+    return true;
+}
+
+/*
+ * Implements the platform specific read function to be used for file
+ * backed flash memory.
+ */
+static bool gmosPalFlashReadPosix (gmosDriverFlash_t* flash,
+    uint32_t readAddr, uint8_t* readData, uint16_t readSize)
+{
+    gmosPalFlashStatePosix_t* palData =
+        (gmosPalFlashStatePosix_t*) flash->palData;
+    gmosDriverFlashStatus_t status;
+
+    // Transfer the read data directly from the backing store.
+    if (pread (palData->fileDesc, readData, readSize, readAddr) ==
+        (ssize_t) readSize) {
+        status = GMOS_DRIVER_FLASH_STATUS_SUCCESS;
+    } else {
+        status = GMOS_DRIVER_FLASH_STATUS_DRIVER_ERROR;
+    }
+
+    // Indicate completion.
+    gmosPalFlashCompletePosix (flash, status, readSize);
+    return true;
+}
+
+/*
+ * Implements the platform specific write function to be used for file
+ * backed flash memory. The write data is combined with the current
+ * contents of the backing store, so that only set bits are cleared.
+ */
+static bool gmosPalFlashWritePosix (gmosDriverFlash_t* flash,
+    uint32_t writeAddr, uint8_t* writeData, uint16_t writeSize)
+{
+    gmosPalFlashStatePosix_t* palData =
+        (gmosPalFlashStatePosix_t*) flash->palData;
+    gmosDriverFlashStatus_t status = GMOS_DRIVER_FLASH_STATUS_SUCCESS;
+    uint8_t mergeData [POSIX_FLASH_BUFFER_SIZE];
+    uint32_t chunkAddr = writeAddr;
+    uint16_t chunkSize;
+    uint16_t remaining = writeSize;
+    uint16_t i;
+
+    // Process the write data in local buffer sized chunks.
+    while (remaining > 0) {
+        chunkSize = (remaining > POSIX_FLASH_BUFFER_SIZE) ?
+            POSIX_FLASH_BUFFER_SIZE : remaining;
+        if (pread (palData->fileDesc,
+            mergeData, chunkSize, chunkAddr) != (ssize_t) chunkSize) {
+            status = GMOS_DRIVER_FLASH_STATUS_DRIVER_ERROR;
+            break;
+        }
+        for (i = 0; i < chunkSize; i++) {
+            mergeData [i] &= *(writeData++);
+        }
+        if (pwrite (palData->fileDesc,
+            mergeData, chunkSize, chunkAddr) != (ssize_t) chunkSize) {
+            status = GMOS_DRIVER_FLASH_STATUS_DRIVER_ERROR;
+            break;
+        }
+        chunkAddr += chunkSize;
+        remaining -= chunkSize;
+    }
+
+    // Indicate completion.
+    gmosPalFlashCompletePosix (flash, status, writeSize);
+    return true;
+}
+
+/*
+ * Implements the platform specific block erase function to be used for
+ * file backed flash memory.
+ */
+static bool gmosPalFlashErasePosix (gmosDriverFlash_t* flash,
+    uint32_t eraseAddr)
+{
+    gmosPalFlashStatePosix_t* palData =
+        (gmosPalFlashStatePosix_t*) flash->palData;
+    gmosDriverFlashStatus_t status;
+
+    // Fill the selected block with the erased value.
+    eraseAddr &= ~(flash->blockSize - 1);
+    if (gmosPalFlashFillErasedPosix (
+        palData->fileDesc, eraseAddr, flash->blockSize)) {
+        status = GMOS_DRIVER_FLASH_STATUS_SUCCESS;
+    } else {
+        status = GMOS_DRIVER_FLASH_STATUS_DRIVER_ERROR;
+    }
+
+    // Indicate completion.
+    gmosPalFlashCompletePosix (flash, status, 0);
+    return true;
+}
+
+/*
+ * Implements the platform specific bulk erase function to be used for
+ * file backed flash memory.
+ */
+static bool gmosPalFlashEraseAllPosix (gmosDriverFlash_t* flash)
+{
+    gmosPalFlashStatePosix_t* palData =
+        (gmosPalFlashStatePosix_t*) flash->palData;
+    gmosDriverFlashStatus_t status;
+
+    // Fill the entire backing store with the erased value.
+    if (gmosPalFlashFillErasedPosix (palData->fileDesc,
+        0, flash->blockSize * flash->blockCount)) {
+        status = GMOS_DRIVER_FLASH_STATUS_SUCCESS;
+    } else {
+        status = GMOS_DRIVER_FLASH_STATUS_DRIVER_ERROR;
+    }
+
+    // Indicate completion.
+    gmosPalFlashCompletePosix (flash, status, 0);
+    return true;
+}
+
+/*
+ * Implements the platform specific initialisation function to be used
+ * for file backed flash memory.
+ */
+bool gmosPalFlashInitPosix (gmosDriverFlash_t* flash)
+{
+    gmosPalFlashConfigPosix_t* palConfig =
+        (gmosPalFlashConfigPosix_t*) flash->palConfig;
+    gmosPalFlashStatePosix_t* palData =
+        (gmosPalFlashStatePosix_t*) flash->palData;
+    struct stat fileStat;
+    uint32_t memorySize;
+    uint32_t fileSize;
+
+    // Check for a valid block size.
+    if ((palConfig->blockSize == 0) ||
+        ((palConfig->blockSize & (palConfig->blockSize - 1)) != 0)) {
+        return false;
+    }
+
+    // Open the backing store, creating it if required.
+    palData->fileDesc = open (palConfig->fileName,
+        O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if ((palData->fileDesc < 0) ||
+        (fstat (palData->fileDesc, &fileStat) != 0)) {
+        GMOS_LOG_FMT (LOG_ERROR,
+            "Failed to open flash backing store '%s'.",
+            palConfig->fileName);
+        return false;
+    }
+
+    // Extend the backing store to the full flash memory size, filling
+    // any new space with the erased value.
+    memorySize = palConfig->blockSize * palConfig->blockCount;
+    fileSize = (uint32_t) fileStat.st_size;
+    if ((fileSize < memorySize) && (!gmosPalFlashFillErasedPosix (
+        palData->fileDesc, fileSize, memorySize - fileSize))) {
+        return false;
+    }
+
+    // Populate the common driver fields.
+    flash->palWriteEnable = gmosPalFlashWriteEnablePosix;
+    flash->palRead = gmosPalFlashReadPosix;
+    flash->palWrite = gmosPalFlashWritePosix;
+    flash->palErase = gmosPalFlashErasePosix;
+    flash->palEraseAll = gmosPalFlashEraseAllPosix;
+    flash->blockSize = palConfig->blockSize;
+    flash->blockCount = palConfig->blockCount;
+    flash->readSize = 1;
+    flash->writeSize = 1;
+    flash->flashState = GMOS_DRIVER_FLASH_STATE_IDLE;
+    return true;
+}
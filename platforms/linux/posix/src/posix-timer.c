@@ -0,0 +1,253 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements the POSIX host system timer and idle support. The system
+ * timer and cycle counter are derived from the host monotonic clock.
+ * Idle periods block on an epoll file descriptor, so that the host
+ * process really sleeps and may be woken by an event file descriptor
+ * or any other attached host file descriptors. Each emulated processor
+ * core has its own epoll and event file descriptors. Alternatively, the
+ * system timer may use virtual time, which is advanced directly by
+ * idle requests.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#include "gmos-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-instance.h"
+#include "posix-device.h"
+
+// Specify the host monotonic clock reference time in nanoseconds.
+static uint64_t timerBaseNanos = 0;
+
+// Specify the epoll file descriptors used for idle waits.
+static int idleEpollFds [GMOS_CONFIG_SCHEDULER_CORES];
+
+// Specify the event file descriptors used for scheduler wake requests.
+static int idleWakeFds [GMOS_CONFIG_SCHEDULER_CORES];
+
+// Specify the number of virtual time ticks since startup.
+#if GMOS_CONFIG_POSIX_VIRTUAL_TIME
+static uint64_t virtualTicks = 0;
+#endif
+
+/*
+ * Reads the host monotonic clock as an integer number of nanoseconds.
+ */
+static inline uint64_t gmosPalGetMonotonicNanos (void)
+{
+    struct timespec timeNow;
+    clock_gettime (CLOCK_MONOTONIC, &timeNow);
+    return ((uint64_t) timeNow.tv_sec) * 1000000000 +
+        (uint64_t) timeNow.tv_nsec;
+}
+
+/*
+ * Initialises the POSIX system timer implementation.
+ */
+void gmosPalSystemTimerInit (void)
+{
+    struct epoll_event epollEvent;
+    uint_fast8_t coreId;
+
+    // Capture the monotonic clock reference time.
+    timerBaseNanos = gmosPalGetMonotonicNanos ();
+
+    // Create the epoll file descriptor for each core and attach the
+    // corresponding wake event file descriptor to it.
+    for (coreId = 0; coreId < GMOS_CONFIG_SCHEDULER_CORES; coreId++) {
+        idleEpollFds [coreId] = epoll_create1 (EPOLL_CLOEXEC);
+        idleWakeFds [coreId] = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+        GMOS_ASSERT (ASSERT_FAILURE,
+            (idleEpollFds [coreId] >= 0) && (idleWakeFds [coreId] >= 0),
+            "Failed to create POSIX idle file descriptors.");
+        epollEvent.events = EPOLLIN;
+        epollEvent.data.fd = idleWakeFds [coreId];
+        epoll_ctl (idleEpollFds [coreId],
+            EPOLL_CTL_ADD, idleWakeFds [coreId], &epollEvent);
+    }
+}
+
+/*
+ * Adds a host file descriptor to the idle wake set for the current
+ * core.
+ */
+bool gmosPalPosixIdleWakeAttach (int fileDesc)
+{
+    struct epoll_event epollEvent;
+    epollEvent.events = EPOLLIN;
+    epollEvent.data.fd = fileDesc;
+    return (epoll_ctl (idleEpollFds [GMOS_PAL_CORE_ID],
+        EPOLL_CTL_ADD, fileDesc, &epollEvent) == 0) ? true : false;
+}
+
+/*
+ * Removes a host file descriptor from the idle wake set for the
+ * current core.
+ */
+void gmosPalPosixIdleWakeDetach (int fileDesc)
+{
+    epoll_ctl (idleEpollFds [GMOS_PAL_CORE_ID],
+        EPOLL_CTL_DEL, fileDesc, NULL);
+}
+
+/*
+ * Reads the current value of the system timer. This is derived from
+ * the number of milliseconds since the platform was initialised.
+ */
+uint32_t gmosPalGetTimer (void)
+{
+#if GMOS_CONFIG_POSIX_VIRTUAL_TIME
+    return GMOS_CONFIG_POSIX_SYSTEM_TIMER_OFFSET +
+        (uint32_t) virtualTicks;
+#else
+    uint64_t elapsedNanos;
+    elapsedNanos = gmosPalGetMonotonicNanos () - timerBaseNanos;
+    return GMOS_CONFIG_POSIX_SYSTEM_TIMER_OFFSET +
+        (uint32_t) (elapsedNanos / 1000000);
+#endif
+}
+
+/*
+ * Reads the current value of the platform cycle counter. This is
+ * derived from the number of nanoseconds since the platform was
+ * initialised, so it wraps after approximately 4.3 seconds. In virtual
+ * time mode, task execution takes no time, so this is derived from the
+ * virtual system timer instead.
+ */
+uint32_t gmosPalGetCycleCount (void)
+{
+#if GMOS_CONFIG_POSIX_VIRTUAL_TIME
+    return (uint32_t) (virtualTicks * 1000000);
+#else
+    return (uint32_t) (gmosPalGetMonotonicNanos () - timerBaseNanos);
+#endif
+}
+
+/*
+ * Requests that the platform abstraction layer enter idle state for
+ * the specified number of system timer ticks. In virtual time mode,
+ * this advances the virtual system timer by the requested duration and
+ * exits the host process if the virtual time limit has been reached.
+ */
+#if GMOS_CONFIG_POSIX_VIRTUAL_TIME
+void gmosPalIdle (uint32_t duration)
+{
+    uint64_t limitTicks =
+        ((uint64_t) GMOS_CONFIG_POSIX_VIRTUAL_TIME_LIMIT) * 1000;
+
+    // Ignore the idle request if the requested duration is too short.
+    if (duration == 0) {
+        return;
+    }
+
+    // Advance the virtual system timer, stopping at the time limit.
+    if (gmosLifecycleNotify (SCHEDULER_ENTER_POWER_SAVE)) {
+        virtualTicks += duration;
+        if ((limitTicks > 0) && (virtualTicks > limitTicks)) {
+            virtualTicks = limitTicks;
+        }
+    }
+    gmosLifecycleNotify (SCHEDULER_EXIT_POWER_SAVE);
+
+    // Exit on reaching the virtual time limit.
+    if ((limitTicks > 0) && (virtualTicks >= limitTicks)) {
+        GMOS_LOG_FMT (LOG_INFO,
+            "Virtual time limit of %ld seconds reached.",
+            (long) GMOS_CONFIG_POSIX_VIRTUAL_TIME_LIMIT);
+        gmosPalExit (0);
+    }
+}
+#endif
+
+/*
+ * Requests that the platform abstraction layer enter idle state for
+ * the specified number of system timer ticks. This blocks on the idle
+ * epoll file descriptor until the timeout expires, a wake request is
+ * issued or one of the attached host file descriptors becomes ready.
+ */
+#if !GMOS_CONFIG_POSIX_VIRTUAL_TIME
+void gmosPalIdle (uint32_t duration)
+{
+    struct epoll_event epollEvent;
+    uint64_t wakeCount;
+    int idleEpollFd = idleEpollFds [GMOS_PAL_CORE_ID];
+    int idleWakeFd = idleWakeFds [GMOS_PAL_CORE_ID];
+    int timeout;
+    int eventCount;
+
+    // Ignore the idle request if the requested duration is too short.
+    if (duration == 0) {
+        return;
+    }
+
+    // The system timer ticks are milliseconds, so they can be used
+    // directly as the epoll timeout.
+    timeout = (duration > INT_MAX) ? INT_MAX : (int) duration;
+
+    // Wait for the timeout or a wake request, clearing the wake event
+    // file descriptor if it was set.
+    if (gmosLifecycleNotify (SCHEDULER_ENTER_POWER_SAVE)) {
+        eventCount = epoll_wait (idleEpollFd, &epollEvent, 1, timeout);
+        if ((eventCount > 0) && (epollEvent.data.fd == idleWakeFd)) {
+            while (read (idleWakeFd,
+                &wakeCount, sizeof (wakeCount)) > 0) {};
+        }
+    }
+    gmosLifecycleNotify (SCHEDULER_EXIT_POWER_SAVE);
+}
+#endif
+
+/*
+ * Requests that the platform abstraction layer wakes the scheduler
+ * running on the specified core from idle. This is safe to call from
+ * other host threads and signal handlers.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES == 1)
+static inline
+#endif
+void gmosPalCoreWake (uint8_t coreId)
+{
+    uint64_t wakeCount = 1;
+    int idleWakeFd = idleWakeFds [coreId];
+    if (idleWakeFd > 0) {
+        (void) !write (idleWakeFd, &wakeCount, sizeof (wakeCount));
+    }
+}
+
+/*
+ * Requests that the platform abstraction layer wakes the scheduler
+ * from idle. The target core is not known, so all cores are woken.
+ * This is safe to call from other host threads and signal handlers.
+ */
+void gmosPalWake (void)
+{
+    uint_fast8_t coreId;
+    for (coreId = 0; coreId < GMOS_CONFIG_SCHEDULER_CORES; coreId++) {
+        gmosPalCoreWake (coreId);
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the shared buffer segment stress test application
+ * configuration options. Shared segment support and the memory pool
+ * segment sizes are selected using the test build variant compiler
+ * options. The smaller memory pool configurations regularly run out
+ * of memory during the test.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the test application.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Specify the default memory pool configuration.
+ */
+#ifndef GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE
+#define GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE 64
+#endif
+#ifndef GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER
+#define GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER 128
+#endif
+#define GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER 4
+
+/*
+ * Specify the number of random buffer operations to run.
+ */
+#define GMOS_TEST_STEP_COUNT 100000
+
+#endif // GMOS_APP_CONFIG_H
@@ -0,0 +1,423 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a randomised stress test for data buffers, which is
+ * mainly intended to check copy on write handling when shared buffer
+ * segments are enabled. A random mix of buffer copy, section copy,
+ * write, cursor write, append, prepend, extend, resize, rebase, move
+ * and concatenate operations is applied to a small set of buffers.
+ * After every operation the contents of all the buffers are checked
+ * against a shadow copy of the expected buffer data. Operations may
+ * fail when the memory pool is exhausted, in which case the buffer
+ * contents must still be consistent with the documented failure
+ * behaviour. On completion all the buffers are released and the test
+ * checks that no memory pool segments have been leaked.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-mempool.h"
+#include "gmos-buffers.h"
+#include "gmos-test.h"
+
+// Specify the number of test buffers.
+#define TEST_BUFFER_COUNT 6
+
+// Specify the maximum size of the test buffers.
+#define TEST_BUFFER_MAX_SIZE 600
+
+// Specify the maximum size of random data blocks.
+#define TEST_BLOCK_MAX_SIZE 150
+
+// Allocate the test task state.
+static gmosTaskState_t testTask;
+
+// Allocate the test buffers and their shadow copies.
+static gmosBuffer_t testBuffers [TEST_BUFFER_COUNT];
+static uint8_t shadowData [TEST_BUFFER_COUNT] [TEST_BUFFER_MAX_SIZE];
+static uint16_t shadowSizes [TEST_BUFFER_COUNT];
+
+// Allocate the working data areas.
+static uint8_t blockData [TEST_BLOCK_MAX_SIZE];
+static uint8_t readData [2 * TEST_BUFFER_MAX_SIZE];
+static uint8_t joinData [2 * TEST_BUFFER_MAX_SIZE];
+
+// Count the number of successful and failed operations.
+static uint32_t stepCount = 0;
+static uint32_t failCount = 0;
+
+/*
+ * Fills the data block with random byte values and returns its size.
+ */
+static uint16_t testRandomBlock (uint16_t maxSize)
+{
+    uint16_t size = gmosTestRandom (maxSize + 1);
+    uint16_t i;
+
+    for (i = 0; i < size; i++) {
+        blockData [i] = (uint8_t) gmosTestRandom (256);
+    }
+    return size;
+}
+
+/*
+ * Updates the shadow copy of a buffer from the actual buffer contents.
+ * This is used after operations that add uninitialised data to the
+ * buffer.
+ */
+static void testAdoptBuffer (uint8_t index)
+{
+    uint16_t size = gmosBufferGetSize (&(testBuffers [index]));
+
+    GMOS_TEST_CHECK (size <= TEST_BUFFER_MAX_SIZE);
+    GMOS_TEST_CHECK (gmosBufferRead (&(testBuffers [index]), 0,
+        shadowData [index], size));
+    shadowSizes [index] = size;
+}
+
+/*
+ * Checks that all the buffer contents match their shadow copies.
+ */
+static void testCheckBuffers (void)
+{
+    uint8_t index;
+    uint16_t size;
+
+    for (index = 0; index < TEST_BUFFER_COUNT; index++) {
+        size = gmosBufferGetSize (&(testBuffers [index]));
+        if (!GMOS_TEST_CHECK (size == shadowSizes [index])) {
+            gmosTestComplete ("buffer-cow");
+        }
+        GMOS_TEST_CHECK (gmosBufferRead (&(testBuffers [index]), 0,
+            readData, size));
+        if (!GMOS_TEST_CHECK (
+            memcmp (readData, shadowData [index], size) == 0)) {
+            gmosTestComplete ("buffer-cow");
+        }
+    }
+}
+
+/*
+ * Copies a complete buffer or a section of a buffer. On failure the
+ * destination buffer will be empty.
+ */
+static bool testOpCopy (uint8_t src, uint8_t dst, bool section)
+{
+    uint16_t offset = 0;
+    uint16_t size = shadowSizes [src];
+    bool opOk;
+
+    if (section) {
+        offset = gmosTestRandom (size + 1);
+        size = gmosTestRandom (size - offset + 1);
+        opOk = gmosBufferCopySection (&(testBuffers [src]),
+            &(testBuffers [dst]), offset, size);
+    } else {
+        opOk = gmosBufferCopy (&(testBuffers [src]), &(testBuffers [dst]));
+    }
+    if (opOk) {
+        memcpy (shadowData [dst], &(shadowData [src] [offset]), size);
+        shadowSizes [dst] = size;
+    } else {
+        shadowSizes [dst] = 0;
+    }
+    return opOk;
+}
+
+/*
+ * Writes a random data block to a random position in a buffer. On
+ * failure the buffer will be unchanged.
+ */
+static bool testOpWrite (uint8_t dst)
+{
+    uint16_t offset = gmosTestRandom (shadowSizes [dst] + 1);
+    uint16_t maxSize = shadowSizes [dst] - offset;
+    uint16_t size = testRandomBlock (
+        (maxSize < TEST_BLOCK_MAX_SIZE) ? maxSize : TEST_BLOCK_MAX_SIZE);
+    bool opOk;
+
+    opOk = gmosBufferWrite (&(testBuffers [dst]), offset, blockData, size);
+    if (opOk) {
+        memcpy (&(shadowData [dst] [offset]), blockData, size);
+    }
+    return opOk;
+}
+
+/*
+ * Writes a sequence of random data blocks using a buffer cursor. Each
+ * cursor write either succeeds or leaves the buffer unchanged.
+ */
+static bool testOpCursorWrite (uint8_t dst)
+{
+    gmosBufferCursor_t cursor;
+    uint16_t offset = gmosTestRandom (shadowSizes [dst] + 1);
+    uint16_t maxSize;
+    uint16_t size;
+    bool opOk = true;
+
+    GMOS_TEST_CHECK (gmosBufferCursorInit (
+        &cursor, &(testBuffers [dst]), offset));
+    while (opOk && (offset < shadowSizes [dst])) {
+        maxSize = shadowSizes [dst] - offset;
+        size = testRandomBlock ((maxSize < 20) ? maxSize : 20);
+        opOk = gmosBufferCursorWrite (&cursor, blockData, size);
+        if (opOk) {
+            memcpy (&(shadowData [dst] [offset]), blockData, size);
+            offset += size;
+            GMOS_TEST_CHECK (gmosBufferCursorGetOffset (&cursor) == offset);
+        }
+        if (gmosTestRandom (4) == 0) {
+            break;
+        }
+    }
+    return opOk;
+}
+
+/*
+ * Appends or prepends a random data block to a buffer. On failure the
+ * buffer will be unchanged.
+ */
+static bool testOpAdd (uint8_t dst, bool prepend)
+{
+    uint16_t maxSize = TEST_BUFFER_MAX_SIZE - shadowSizes [dst];
+    uint16_t size = testRandomBlock (
+        (maxSize < TEST_BLOCK_MAX_SIZE) ? maxSize : TEST_BLOCK_MAX_SIZE);
+    bool opOk;
+
+    if (prepend) {
+        opOk = gmosBufferPrepend (&(testBuffers [dst]), blockData, size);
+        if (opOk) {
+            memmove (&(shadowData [dst] [size]),
+                shadowData [dst], shadowSizes [dst]);
+            memcpy (shadowData [dst], blockData, size);
+            shadowSizes [dst] += size;
+        }
+    } else {
+        opOk = gmosBufferAppend (&(testBuffers [dst]), blockData, size);
+        if (opOk) {
+            memcpy (&(shadowData [dst] [shadowSizes [dst]]),
+                blockData, size);
+            shadowSizes [dst] += size;
+        }
+    }
+    return opOk;
+}
+
+/*
+ * Changes the size of a buffer using the extend, resize or rebase
+ * operations. Any data added to the buffer is uninitialised, so the
+ * shadow copy of the new data is taken from the buffer.
+ */
+static bool testOpSize (uint8_t dst, uint8_t sizeOp)
+{
+    gmosBuffer_t* buffer = &(testBuffers [dst]);
+    uint16_t oldSize = shadowSizes [dst];
+    uint16_t newSize = gmosTestRandom (TEST_BUFFER_MAX_SIZE + 1);
+    bool opOk;
+
+    // Extend the buffer at the end.
+    if (sizeOp == 0) {
+        newSize = oldSize + gmosTestRandom (
+            TEST_BUFFER_MAX_SIZE - oldSize + 1);
+        opOk = gmosBufferExtend (buffer, newSize - oldSize);
+    }
+
+    // Resize the buffer at the end.
+    else if (sizeOp == 1) {
+        opOk = gmosBufferResize (buffer, newSize);
+    }
+
+    // Resize the buffer at the start.
+    else {
+        opOk = gmosBufferRebase (buffer, newSize);
+        if (opOk && (newSize <= oldSize)) {
+            memmove (shadowData [dst],
+                &(shadowData [dst] [oldSize - newSize]), newSize);
+        } else if (opOk) {
+            memmove (&(shadowData [dst] [newSize - oldSize]),
+                shadowData [dst], oldSize);
+        }
+    }
+
+    // Take the new buffer data from the buffer, then check that the
+    // existing buffer data was preserved.
+    if (opOk) {
+        memcpy (readData, shadowData [dst], newSize);
+        testAdoptBuffer (dst);
+        GMOS_TEST_CHECK (shadowSizes [dst] == newSize);
+        if ((sizeOp == 2) && (newSize > oldSize)) {
+            GMOS_TEST_CHECK (memcmp (&(readData [newSize - oldSize]),
+                &(shadowData [dst] [newSize - oldSize]), oldSize) == 0);
+        } else {
+            GMOS_TEST_CHECK (memcmp (readData, shadowData [dst],
+                (newSize < oldSize) ? newSize : oldSize) == 0);
+        }
+    }
+    return opOk;
+}
+
+/*
+ * Moves the contents of one buffer to another.
+ */
+static bool testOpMove (uint8_t src, uint8_t dst)
+{
+    gmosBufferMove (&(testBuffers [src]), &(testBuffers [dst]));
+    memcpy (shadowData [dst], shadowData [src], shadowSizes [src]);
+    shadowSizes [dst] = shadowSizes [src];
+    if (src != dst) {
+        shadowSizes [src] = 0;
+    }
+    return true;
+}
+
+/*
+ * Concatenates two buffers into a destination buffer, which may be
+ * one of the source buffers. On failure, the concatenated data remains
+ * split between the two source buffers and the destination buffer is
+ * unchanged.
+ */
+static bool testOpConcatenate (uint8_t srcA, uint8_t srcB, uint8_t dst)
+{
+    uint16_t sizeA = shadowSizes [srcA];
+    uint16_t sizeB = shadowSizes [srcB];
+    uint16_t newSizeA;
+    bool opOk;
+
+    if (sizeA + sizeB > TEST_BUFFER_MAX_SIZE) {
+        return true;
+    }
+    memcpy (joinData, shadowData [srcA], sizeA);
+    memcpy (&(joinData [sizeA]), shadowData [srcB], sizeB);
+    opOk = gmosBufferConcatenate (&(testBuffers [srcA]),
+        &(testBuffers [srcB]), &(testBuffers [dst]));
+    if (opOk) {
+        shadowSizes [srcA] = 0;
+        shadowSizes [srcB] = 0;
+        memcpy (shadowData [dst], joinData, sizeA + sizeB);
+        shadowSizes [dst] = sizeA + sizeB;
+    } else {
+        newSizeA = gmosBufferGetSize (&(testBuffers [srcA]));
+        GMOS_TEST_CHECK (newSizeA <= sizeA + sizeB);
+        memcpy (shadowData [srcA], joinData, newSizeA);
+        shadowSizes [srcA] = newSizeA;
+        memcpy (shadowData [srcB], &(joinData [newSizeA]),
+            sizeA + sizeB - newSizeA);
+        shadowSizes [srcB] = sizeA + sizeB - newSizeA;
+    }
+    return opOk;
+}
+
+/*
+ * Runs a single randomly selected buffer operation.
+ */
+static bool testRunStep (void)
+{
+    uint8_t bufA = gmosTestRandom (TEST_BUFFER_COUNT);
+    uint8_t bufB = gmosTestRandom (TEST_BUFFER_COUNT - 1);
+    uint8_t bufC = gmosTestRandom (TEST_BUFFER_COUNT);
+
+    // Buffers A and B are always different.
+    if (bufB >= bufA) {
+        bufB += 1;
+    }
+    switch (gmosTestRandom (12)) {
+        case 0 :
+            return testOpCopy (bufA, bufB, false);
+        case 1 :
+            return testOpCopy (bufA, bufB, true);
+        case 2 :
+        case 3 :
+            return testOpWrite (bufA);
+        case 4 :
+            return testOpCursorWrite (bufA);
+        case 5 :
+            return testOpAdd (bufA, false);
+        case 6 :
+            return testOpAdd (bufA, true);
+        case 7 :
+            return testOpSize (bufA, 0);
+        case 8 :
+            return testOpSize (bufA, 1);
+        case 9 :
+            return testOpSize (bufA, 2);
+        case 10 :
+            return testOpMove (bufA, bufB);
+        default :
+            return testOpConcatenate (bufA, bufB, bufC);
+    }
+}
+
+/*
+ * Implements the test task function.
+ */
+static gmosTaskStatus_t testTaskFn (void* nullData)
+{
+    uint8_t index;
+    uint16_t i;
+
+    // Run a batch of random buffer operations.
+    for (i = 0; i < 100; i++) {
+        if (!testRunStep ()) {
+            failCount += 1;
+        }
+        testCheckBuffers ();
+        stepCount += 1;
+    }
+    if (stepCount < GMOS_TEST_STEP_COUNT) {
+        return GMOS_TASK_RUN_IMMEDIATE;
+    }
+
+    // Release all the buffers and check for memory pool leaks.
+    for (index = 0; index < TEST_BUFFER_COUNT; index++) {
+        gmosBufferReset (&(testBuffers [index]), 0);
+    }
+    GMOS_TEST_CHECK (gmosMempoolSegmentsAvailable () ==
+        GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER);
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE > 0)
+    GMOS_TEST_CHECK (gmosMempoolLargeSegmentsAvailable () ==
+        GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER);
+#endif
+    GMOS_LOG_FMT (LOG_INFO,
+        "Ran %ld buffer operations, %ld failed.",
+        (long) stepCount, (long) failCount);
+    gmosTestComplete ("buffer-cow");
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Sets up the test application.
+ */
+void gmosAppInit (void)
+{
+    uint8_t index;
+
+    for (index = 0; index < TEST_BUFFER_COUNT; index++) {
+        gmosBufferInit (&(testBuffers [index]));
+        shadowSizes [index] = 0;
+    }
+    testTask.taskTickFn = testTaskFn;
+    testTask.taskData = NULL;
+    testTask.taskName = "Buffer Test";
+    gmosSchedulerTaskStart (&testTask);
+}
@@ -0,0 +1,391 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a test for the data buffer cursor API. This checks
+ * sequential reads and writes using a cursor, cursor accesses that
+ * cross buffer segment boundaries at every possible buffer offset and
+ * resynchronising a cursor after data has been appended or prepended
+ * to the buffer. All buffer contents are checked against a reference
+ * copy of the buffer data.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-mempool.h"
+#include "gmos-buffers.h"
+#include "gmos-test.h"
+
+// Specify the initial size of the test buffer.
+#define TEST_BUFFER_SIZE 1000
+
+// Specify the size of the data blocks that are appended and prepended
+// to the test buffer.
+#define TEST_APPEND_SIZE  300
+#define TEST_PREPEND_SIZE 40
+
+// Specify the maximum size of the test buffer.
+#define TEST_BUFFER_MAX_SIZE \
+    (TEST_BUFFER_SIZE + TEST_APPEND_SIZE + TEST_PREPEND_SIZE)
+
+// Allocate the test task state.
+static gmosTaskState_t testTask;
+
+// Allocate the test buffer and the reference copy of its contents.
+static gmosBuffer_t testBuffer = GMOS_BUFFER_INIT ();
+static gmosBuffer_t copyBuffer = GMOS_BUFFER_INIT ();
+static uint8_t refData [TEST_BUFFER_MAX_SIZE];
+static uint16_t refSize = 0;
+
+// Allocate the working data areas.
+static uint8_t readData [TEST_BUFFER_MAX_SIZE];
+static uint8_t writeData [TEST_BUFFER_MAX_SIZE];
+static uint8_t copyData [TEST_BUFFER_MAX_SIZE];
+
+/*
+ * Fills a data array with random byte values.
+ */
+static void testRandomFill (uint8_t* data, uint16_t size)
+{
+    uint16_t i;
+
+    for (i = 0; i < size; i++) {
+        data [i] = (uint8_t) gmosTestRandom (256);
+    }
+}
+
+/*
+ * Checks that the test buffer contents match the reference data.
+ */
+static void testCheckBuffer (void)
+{
+    GMOS_TEST_CHECK (gmosBufferGetSize (&testBuffer) == refSize);
+    GMOS_TEST_CHECK (
+        gmosBufferRead (&testBuffer, 0, readData, refSize));
+    GMOS_TEST_CHECK (memcmp (readData, refData, refSize) == 0);
+}
+
+/*
+ * Checks that the cursor position is consistent with the specified
+ * buffer offset.
+ */
+static void testCheckPosition (
+    gmosBufferCursor_t* cursor, uint16_t offset)
+{
+    GMOS_TEST_CHECK (gmosBufferCursorGetOffset (cursor) == offset);
+    GMOS_TEST_CHECK (
+        gmosBufferCursorGetRemaining (cursor) == refSize - offset);
+}
+
+/*
+ * Checks sequential reads and writes using a single cursor, with
+ * randomly selected transfer sizes. A copy of the buffer is made
+ * before writing, which checks that cursor writes to buffers with
+ * shared segments do not modify the copy.
+ */
+static void testSequential (void)
+{
+    gmosBufferCursor_t cursor;
+    uint16_t offset;
+    uint16_t size;
+
+    // Read the buffer contents in randomly sized blocks.
+    GMOS_TEST_CHECK (gmosBufferCursorInit (&cursor, &testBuffer, 0));
+    offset = 0;
+    while (offset < refSize) {
+        size = 1 + gmosTestRandom (100);
+        if (size > refSize - offset) {
+            size = refSize - offset;
+        }
+        GMOS_TEST_CHECK (
+            gmosBufferCursorRead (&cursor, readData, size));
+        GMOS_TEST_CHECK (
+            memcmp (readData, refData + offset, size) == 0);
+        offset += size;
+        testCheckPosition (&cursor, offset);
+    }
+
+    // Reads beyond the end of the buffer should fail without moving
+    // the cursor.
+    GMOS_TEST_CHECK (!gmosBufferCursorRead (&cursor, readData, 1));
+    testCheckPosition (&cursor, refSize);
+
+    // Copy the buffer contents before they are overwritten.
+    GMOS_TEST_CHECK (gmosBufferCopy (&testBuffer, &copyBuffer));
+    memcpy (copyData, refData, refSize);
+
+    // Overwrite the buffer contents in randomly sized blocks.
+    GMOS_TEST_CHECK (gmosBufferCursorSeek (&cursor, 0));
+    offset = 0;
+    while (offset < refSize) {
+        size = 1 + gmosTestRandom (100);
+        if (size > refSize - offset) {
+            size = refSize - offset;
+        }
+        testRandomFill (writeData, size);
+        GMOS_TEST_CHECK (
+            gmosBufferCursorWrite (&cursor, writeData, size));
+        memcpy (refData + offset, writeData, size);
+        offset += size;
+        testCheckPosition (&cursor, offset);
+    }
+
+    // Writes beyond the end of the buffer should fail without
+    // extending the buffer.
+    GMOS_TEST_CHECK (!gmosBufferCursorWrite (&cursor, writeData, 1));
+    testCheckPosition (&cursor, refSize);
+    testCheckBuffer ();
+
+    // Check that the buffer copy was not modified.
+    GMOS_TEST_CHECK (gmosBufferGetSize (&copyBuffer) == refSize);
+    GMOS_TEST_CHECK (
+        gmosBufferRead (&copyBuffer, 0, readData, refSize));
+    GMOS_TEST_CHECK (memcmp (readData, copyData, refSize) == 0);
+    gmosBufferReset (&copyBuffer, 0);
+}
+
+/*
+ * Checks the typed cursor accessors, writing a sequence of values and
+ * then reading them back using a second cursor.
+ */
+static void testTypedAccess (void)
+{
+    gmosBufferCursor_t writeCursor;
+    gmosBufferCursor_t readCursor;
+    uint32_t valueU32;
+    uint16_t valueU16;
+    uint8_t valueU8;
+    uint16_t offset;
+    uint16_t i;
+
+    // Write a repeated sequence of typed values, which places each
+    // value type at every alignment relative to the segment
+    // boundaries. This uses 13 bytes per iteration.
+    GMOS_TEST_CHECK (gmosBufferCursorInit (
+        &writeCursor, &testBuffer, 1));
+    for (i = 0; i < 64; i++) {
+        GMOS_TEST_CHECK (gmosBufferCursorWriteU8 (
+            &writeCursor, (uint8_t) i));
+        GMOS_TEST_CHECK (gmosBufferCursorWriteU16Be (
+            &writeCursor, 0x1234 + i));
+        GMOS_TEST_CHECK (gmosBufferCursorWriteU16Le (
+            &writeCursor, 0x5678 + i));
+        GMOS_TEST_CHECK (gmosBufferCursorWriteU32Be (
+            &writeCursor, 0x9ABCDE00 + i));
+        GMOS_TEST_CHECK (gmosBufferCursorWriteU32Le (
+            &writeCursor, 0x0FEDCB00 + i));
+    }
+
+    // Update the reference data using the expected byte ordering.
+    offset = 1;
+    for (i = 0; i < 64; i++) {
+        refData [offset++] = (uint8_t) i;
+        refData [offset++] = 0x12;
+        refData [offset++] = (uint8_t) (0x34 + i);
+        refData [offset++] = (uint8_t) (0x78 + i);
+        refData [offset++] = 0x56;
+        refData [offset++] = 0x9A;
+        refData [offset++] = 0xBC;
+        refData [offset++] = 0xDE;
+        refData [offset++] = (uint8_t) i;
+        refData [offset++] = (uint8_t) i;
+        refData [offset++] = 0xCB;
+        refData [offset++] = 0xED;
+        refData [offset++] = 0x0F;
+    }
+    testCheckPosition (&writeCursor, offset);
+    testCheckBuffer ();
+
+    // Read back the typed values.
+    GMOS_TEST_CHECK (gmosBufferCursorInit (
+        &readCursor, &testBuffer, 1));
+    for (i = 0; i < 64; i++) {
+        GMOS_TEST_CHECK (gmosBufferCursorReadU8 (
+            &readCursor, &valueU8) && (valueU8 == i));
+        GMOS_TEST_CHECK (gmosBufferCursorReadU16Be (
+            &readCursor, &valueU16) && (valueU16 == 0x1234 + i));
+        GMOS_TEST_CHECK (gmosBufferCursorReadU16Le (
+            &readCursor, &valueU16) && (valueU16 == 0x5678 + i));
+        GMOS_TEST_CHECK (gmosBufferCursorReadU32Be (
+            &readCursor, &valueU32) && (valueU32 == 0x9ABCDE00 + i));
+        GMOS_TEST_CHECK (gmosBufferCursorReadU32Le (
+            &readCursor, &valueU32) && (valueU32 == 0x0FEDCB00 + i));
+    }
+    testCheckPosition (&readCursor, offset);
+}
+
+/*
+ * Checks cursor accesses starting at every buffer offset, so that all
+ * the segment boundaries are crossed by reads, peeks and skips.
+ */
+static void testSegmentBoundaries (void)
+{
+    gmosBufferCursor_t cursor;
+    uint16_t offset;
+    uint16_t size;
+
+    for (offset = 0; offset <= refSize; offset++) {
+        size = 1 + gmosTestRandom (80);
+        GMOS_TEST_CHECK (
+            gmosBufferCursorInit (&cursor, &testBuffer, offset));
+        testCheckPosition (&cursor, offset);
+
+        // Check peeks and reads that may cross segment boundaries.
+        if (size <= refSize - offset) {
+            GMOS_TEST_CHECK (
+                gmosBufferCursorPeek (&cursor, readData, size));
+            GMOS_TEST_CHECK (
+                memcmp (readData, refData + offset, size) == 0);
+            testCheckPosition (&cursor, offset);
+            GMOS_TEST_CHECK (
+                gmosBufferCursorRead (&cursor, readData, size));
+            GMOS_TEST_CHECK (
+                memcmp (readData, refData + offset, size) == 0);
+            testCheckPosition (&cursor, offset + size);
+        } else {
+            GMOS_TEST_CHECK (
+                !gmosBufferCursorPeek (&cursor, readData, size));
+            GMOS_TEST_CHECK (
+                !gmosBufferCursorRead (&cursor, readData, size));
+            testCheckPosition (&cursor, offset);
+        }
+
+        // Check skips from the initial offset followed by a single
+        // byte read.
+        GMOS_TEST_CHECK (gmosBufferCursorSeek (&cursor, offset));
+        if (size < refSize - offset) {
+            GMOS_TEST_CHECK (gmosBufferCursorSkip (&cursor, size));
+            GMOS_TEST_CHECK (
+                gmosBufferCursorRead (&cursor, readData, 1));
+            GMOS_TEST_CHECK (readData [0] == refData [offset + size]);
+        } else {
+            GMOS_TEST_CHECK (!gmosBufferCursorSkip (&cursor, size + 1));
+            testCheckPosition (&cursor, offset);
+        }
+    }
+
+    // Cursors may not be positioned beyond the end of the buffer.
+    GMOS_TEST_CHECK (
+        !gmosBufferCursorInit (&cursor, &testBuffer, refSize + 1));
+    GMOS_TEST_CHECK (gmosBufferCursorInit (&cursor, &testBuffer, 0));
+    GMOS_TEST_CHECK (!gmosBufferCursorSeek (&cursor, refSize + 1));
+    testCheckPosition (&cursor, 0);
+}
+
+/*
+ * Checks that a cursor can be resynchronised with the buffer after
+ * data has been appended or prepended. The buffer contents must not be
+ * resized while a cursor is in use, so the cursor is reinitialised at
+ * the appropriate offset after each change.
+ */
+static void testResync (void)
+{
+    gmosBufferCursor_t cursor;
+    uint16_t offset;
+
+    // Read to the end of the buffer.
+    GMOS_TEST_CHECK (gmosBufferCursorInit (&cursor, &testBuffer, 0));
+    GMOS_TEST_CHECK (gmosBufferCursorSkip (&cursor, refSize));
+    GMOS_TEST_CHECK (!gmosBufferCursorRead (&cursor, readData, 1));
+
+    // Append data to the buffer and then continue reading from the
+    // previous cursor position.
+    testRandomFill (writeData, TEST_APPEND_SIZE);
+    GMOS_TEST_CHECK (gmosBufferAppend (
+        &testBuffer, writeData, TEST_APPEND_SIZE));
+    memcpy (refData + refSize, writeData, TEST_APPEND_SIZE);
+    refSize += TEST_APPEND_SIZE;
+    offset = gmosBufferCursorGetOffset (&cursor);
+    GMOS_TEST_CHECK (
+        gmosBufferCursorInit (&cursor, &testBuffer, offset));
+    testCheckPosition (&cursor, offset);
+    GMOS_TEST_CHECK (
+        gmosBufferCursorRead (&cursor, readData, TEST_APPEND_SIZE));
+    GMOS_TEST_CHECK (memcmp (readData,
+        refData + offset, TEST_APPEND_SIZE) == 0);
+    testCheckPosition (&cursor, refSize);
+
+    // Prepend data to the buffer, which moves the start of the buffer
+    // data within the first buffer segment. The cursor is then
+    // resynchronised to the same buffer data.
+    offset = gmosBufferCursorGetOffset (&cursor) - TEST_APPEND_SIZE;
+    testRandomFill (writeData, TEST_PREPEND_SIZE);
+    GMOS_TEST_CHECK (gmosBufferPrepend (
+        &testBuffer, writeData, TEST_PREPEND_SIZE));
+    memmove (refData + TEST_PREPEND_SIZE, refData, refSize);
+    memcpy (refData, writeData, TEST_PREPEND_SIZE);
+    refSize += TEST_PREPEND_SIZE;
+    offset += TEST_PREPEND_SIZE;
+    GMOS_TEST_CHECK (
+        gmosBufferCursorInit (&cursor, &testBuffer, offset));
+    GMOS_TEST_CHECK (
+        gmosBufferCursorRead (&cursor, readData, TEST_APPEND_SIZE));
+    GMOS_TEST_CHECK (memcmp (readData,
+        refData + offset, TEST_APPEND_SIZE) == 0);
+    testCheckBuffer ();
+
+    // Repeat the sequential and segment boundary tests on the modified
+    // buffer, which no longer starts at a segment boundary.
+    testSequential ();
+    testSegmentBoundaries ();
+}
+
+/*
+ * Implements the test task, which runs all the tests on the first task
+ * run.
+ */
+static gmosTaskStatus_t testTaskFn (void* nullData)
+{
+    uint16_t initialFreeCount = gmosMempoolSegmentsAvailable ();
+
+    // Set up the initial buffer contents.
+    testRandomFill (refData, TEST_BUFFER_SIZE);
+    refSize = TEST_BUFFER_SIZE;
+    GMOS_TEST_CHECK (
+        gmosBufferAppend (&testBuffer, refData, TEST_BUFFER_SIZE));
+    testCheckBuffer ();
+
+    // Run the cursor tests.
+    testSequential ();
+    testTypedAccess ();
+    testSegmentBoundaries ();
+    testResync ();
+
+    // Check that all the buffer segments are released.
+    gmosBufferReset (&testBuffer, 0);
+    GMOS_TEST_CHECK (
+        gmosMempoolSegmentsAvailable () == initialFreeCount);
+    gmosTestComplete ("buffer-cursor");
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Sets up the test application.
+ */
+void gmosAppInit (void)
+{
+    testTask.taskTickFn = testTaskFn;
+    testTask.taskData = NULL;
+    testTask.taskName = "Test";
+    gmosSchedulerTaskStart (&testTask);
+}
@@ -0,0 +1,45 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the host OS scheduler test application configuration
+ * options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the test application.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Run the scheduler in its own host thread. A host OS lock batch size
+ * of one is used so that the scheduler releases the host OS mutex at
+ * the end of every scheduler step.
+ */
+#define GMOS_CONFIG_HOST_OS_SUPPORT true
+#define GMOS_CONFIG_HOST_OS_LOCK_BATCH_SIZE 1
+
+/*
+ * Specify the number of busy wait rounds to run.
+ */
+#define GMOS_TEST_ROUND_COUNT 2000
+
+#endif // GMOS_APP_CONFIG_H
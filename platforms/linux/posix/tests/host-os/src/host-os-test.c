@@ -0,0 +1,142 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a test for the host OS mutex handling when the scheduler
+ * runs in its own host thread. A test task repeatedly busy waits on an
+ * event which is set by a second task, so that scheduler steps are
+ * nested and may request an idle period. Meanwhile, the main host
+ * thread repeatedly claims the host OS mutex and marks the period for
+ * which it is held. The test checks that scheduler tasks never run
+ * while the host thread holds the mutex. The waiter task also busy
+ * waits on an event with no consumer task that is only set by the
+ * host thread, which checks that the host OS mutex is released and
+ * the device is woken while a busy waiting task is idle.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-events.h"
+#include "gmos-test.h"
+
+// Check for host OS support.
+#if !GMOS_CONFIG_HOST_OS_SUPPORT
+#error "The host OS test requires host OS support."
+#endif
+
+// Allocate the test task state.
+static gmosTaskState_t waiterTask;
+static gmosTaskState_t signallerTask;
+static gmosEvent_t waitEvent;
+static gmosEvent_t hostEvent;
+static uint32_t roundCount = 0;
+
+// Indicates that the main host thread currently holds the host OS
+// mutex.
+static volatile bool hostThreadActive = false;
+
+/*
+ * Implements the waiter task function. This busy waits on the event
+ * that is set by the signaller task.
+ */
+static gmosTaskStatus_t waiterTaskFn (void* nullData)
+{
+    bool eventSet;
+
+    GMOS_TEST_CHECK (!hostThreadActive);
+    eventSet = gmosEventBusyWait (&waitEvent, 1, 1000);
+    GMOS_TEST_CHECK (eventSet);
+
+    // Emulate some task processing after the busy wait, which gives
+    // the host thread an opportunity to claim the host OS mutex if it
+    // has been released.
+    usleep (100);
+    GMOS_TEST_CHECK (!hostThreadActive);
+    gmosEventResetBits (&waitEvent);
+
+    // Wait for the host thread to set the host event bits. The timeout
+    // is much longer than the host thread loop period.
+    eventSet = gmosEventBusyWait (&hostEvent, 1, 1000);
+    GMOS_TEST_CHECK (eventSet);
+    GMOS_TEST_CHECK (!hostThreadActive);
+    gmosEventResetBits (&hostEvent);
+
+    // Check for test completion.
+    roundCount += 1;
+    if (roundCount == GMOS_TEST_ROUND_COUNT) {
+        gmosTestComplete ("host-os");
+    }
+    return GMOS_TASK_RUN_IMMEDIATE;
+}
+
+/*
+ * Implements the signaller task function. This sets the waiter event
+ * bits after a short delay, so that the nested scheduler steps will
+ * request an idle period while the waiter task is busy waiting.
+ */
+static gmosTaskStatus_t signallerTaskFn (void* nullData)
+{
+    GMOS_TEST_CHECK (!hostThreadActive);
+    gmosEventSetBits (&waitEvent, 1);
+    return GMOS_TASK_RUN_LATER (1);
+}
+
+/*
+ * Sets up the test application in the scheduler thread.
+ */
+void gmosAppInit (void)
+{
+    gmosEventInit (&waitEvent, NULL);
+    gmosEventInit (&hostEvent, NULL);
+    waiterTask.taskTickFn = waiterTaskFn;
+    waiterTask.taskData = NULL;
+    waiterTask.taskName = "Waiter";
+    gmosSchedulerTaskStart (&waiterTask);
+    signallerTask.taskTickFn = signallerTaskFn;
+    signallerTask.taskData = NULL;
+    signallerTask.taskName = "Signaller";
+    gmosSchedulerTaskStart (&signallerTask);
+}
+
+/*
+ * Provides the main process entry point. This starts the scheduler
+ * thread and then repeatedly claims the host OS mutex, setting the
+ * host event bits each time. The process exits from the scheduler
+ * thread on test completion.
+ */
+int main (void)
+{
+    if (!gmosPalHostOsInit ()) {
+        return 1;
+    }
+    while (true) {
+        while (!gmosPalHostOsMutexLock (0xFFFF)) {};
+        hostThreadActive = true;
+        gmosEventSetBits (&hostEvent, 1);
+        usleep (20);
+        hostThreadActive = false;
+        gmosPalHostOsMutexUnlock ();
+        usleep (20);
+    }
+    return 0;
+}
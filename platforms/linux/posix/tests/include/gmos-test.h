@@ -0,0 +1,94 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * This header defines the common support functions that are used by
+ * the host test and benchmark applications for the POSIX platform.
+ * Each test application is built as a standard GubbinsMOS application
+ * and indicates the test result using the host process exit status.
+ */
+
+#ifndef GMOS_TEST_H
+#define GMOS_TEST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Checks a test condition, logging the location of the check and
+ * incrementing the test failure count if the condition does not hold.
+ * Test execution continues after a failed check.
+ * @param _condition_ This is the condition which is expected to
+ *     evaluate to 'true'.
+ */
+#define GMOS_TEST_CHECK(_condition_) \
+    gmosTestCheck ((_condition_) ? true : false, __FILE__, __LINE__, \
+        #_condition_)
+
+/**
+ * Implements the test condition check. This should not be called
+ * directly, since the 'GMOS_TEST_CHECK' macro automatically adds the
+ * source code location.
+ * @param condition This is the result of evaluating the test condition.
+ * @param fileName This is the name of the source file containing the
+ *     test condition.
+ * @param lineNo This is the source file line number for the test
+ *     condition.
+ * @param conditionText This is the text of the test condition, which
+ *     will be included in the failure log message.
+ * @return Returns the supplied test condition result.
+ */
+bool gmosTestCheck (bool condition, const char* fileName,
+    uint32_t lineNo, const char* conditionText);
+
+/**
+ * Gets the number of test condition checks that have failed so far.
+ * @return Returns the current test failure count.
+ */
+uint32_t gmosTestGetFailureCount (void);
+
+/**
+ * Generates the next value from the deterministic pseudo-random number
+ * sequence used by the test applications. Unlike the platform random
+ * number generator, the sequence is the same on every test run.
+ * @param range This is the exclusive upper bound for the generated
+ *     value, which must be greater than zero.
+ * @return Returns a pseudo-random value in the range from zero to the
+ *     specified upper bound minus one.
+ */
+uint32_t gmosTestRandom (uint32_t range);
+
+/**
+ * Reads the host monotonic clock. This is used for benchmark timing
+ * measurements and is independent of the GubbinsMOS system timer, so
+ * it continues to run normally when virtual time is being used.
+ * @return Returns the host monotonic clock value as an integer number
+ *     of nanoseconds.
+ */
+uint64_t gmosTestGetHostNanos (void);
+
+/**
+ * Completes the test run, logging the test result and then exiting the
+ * host process. The process exit status will be zero if all the test
+ * condition checks succeeded and one otherwise.
+ * @param testName This is the name of the test, which will be included
+ *     in the test result log message.
+ */
+void gmosTestComplete (const char* testName);
+
+#endif // GMOS_TEST_H
@@ -0,0 +1,52 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the multiple instance event test application configuration
+ * options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the test application.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Run multiple GubbinsMOS instances from the test harness process
+ * entry point, using virtual time.
+ */
+#define GMOS_CONFIG_INSTANCE_SUPPORT true
+#define GMOS_CONFIG_POSIX_VIRTUAL_TIME true
+
+/*
+ * Use a small memory pool for each instance.
+ */
+#define GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER 16
+
+/*
+ * Specify the number of instances, the number of tokens that are
+ * passed between them and the number of token passing hops to run.
+ */
+#define GMOS_TEST_INSTANCE_COUNT 250
+#define GMOS_TEST_TOKEN_COUNT 8
+#define GMOS_TEST_HOP_COUNT 200000
+
+#endif // GMOS_APP_CONFIG_H
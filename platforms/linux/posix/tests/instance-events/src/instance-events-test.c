@@ -0,0 +1,202 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a test for setting events and resuming tasks across
+ * multiple GubbinsMOS instances. Each instance runs a single node task
+ * and the nodes are arranged in a ring. A number of tokens are passed
+ * around the ring, with each node holding the tokens it receives for a
+ * random period before passing them on to the next node. Even numbered
+ * tokens are passed by setting the event bits for the next node and
+ * odd numbered tokens are passed by updating the mailbox for the next
+ * node and then resuming its task. The test checks that node tasks
+ * always run on their own instance and that each token visits the
+ * nodes in order.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-events.h"
+#include "gmos-instance.h"
+#include "gmos-test.h"
+
+// Check for single core instance support.
+#if !GMOS_CONFIG_INSTANCE_SUPPORT || (GMOS_CONFIG_SCHEDULER_CORES > 1)
+#error "The instance event test requires single core instance support."
+#endif
+
+// Defines the state for each node in the ring.
+typedef struct testNode_t {
+    gmosInstance_t instance;
+    gmosTaskState_t task;
+    gmosEvent_t event;
+    uint32_t mailbox;
+    uint32_t heldTokens;
+    uint32_t forwardTime;
+    uint32_t receiveCount;
+    struct testNode_t* nextNode;
+} testNode_t;
+
+// Allocate the node state.
+static testNode_t testNodes [GMOS_TEST_INSTANCE_COUNT];
+
+// Specify the node index that is next expected to receive each token.
+static uint32_t tokenNodes [GMOS_TEST_TOKEN_COUNT];
+
+// Specify the total number of token passing hops.
+static uint32_t hopCount = 0;
+
+/*
+ * Passes a set of tokens to the specified node. Even numbered tokens
+ * are passed using the node event and odd numbered tokens are passed
+ * using the node mailbox.
+ */
+static void testPassTokens (testNode_t* node, uint32_t tokens)
+{
+    uint32_t eventTokens = tokens & 0x55555555;
+    uint32_t mailboxTokens = tokens & 0xAAAAAAAA;
+
+    if (eventTokens != 0) {
+        gmosEventSetBits (&(node->event), eventTokens);
+    }
+    if (mailboxTokens != 0) {
+        node->mailbox |= mailboxTokens;
+        gmosSchedulerTaskResume (&(node->task));
+    }
+}
+
+/*
+ * Implements the node task function.
+ */
+static gmosTaskStatus_t testNodeTaskFn (void* taskData)
+{
+    testNode_t* node = (testNode_t*) taskData;
+    uint32_t nodeIndex = node - testNodes;
+    uint32_t currentTime = gmosPalGetTimer ();
+    uint32_t newTokens;
+    uint32_t tokenIndex;
+    int32_t holdTime;
+
+    // The node task must only run on its own instance.
+    GMOS_TEST_CHECK (GMOS_INSTANCE_CURRENT == &(node->instance));
+
+    // Accept any new tokens.
+    newTokens = gmosEventResetBits (&(node->event)) | node->mailbox;
+    node->mailbox = 0;
+    for (tokenIndex = 0;
+        tokenIndex < GMOS_TEST_TOKEN_COUNT; tokenIndex++) {
+        if ((newTokens & (1 << tokenIndex)) != 0) {
+            GMOS_TEST_CHECK (tokenNodes [tokenIndex] == nodeIndex);
+            tokenNodes [tokenIndex] =
+                (nodeIndex + 1) % GMOS_TEST_INSTANCE_COUNT;
+            node->receiveCount += 1;
+            hopCount += 1;
+        }
+    }
+    if ((node->heldTokens == 0) && (newTokens != 0)) {
+        node->forwardTime = currentTime + 1 + gmosTestRandom (16);
+    }
+    node->heldTokens |= newTokens;
+
+    // Check for test completion.
+    if (hopCount >= GMOS_TEST_HOP_COUNT) {
+        uint32_t receiveCount = 0;
+        for (nodeIndex = 0;
+            nodeIndex < GMOS_TEST_INSTANCE_COUNT; nodeIndex++) {
+            receiveCount += testNodes [nodeIndex].receiveCount;
+        }
+        GMOS_TEST_CHECK (receiveCount == hopCount);
+        GMOS_LOG_FMT (LOG_INFO,
+            "Passed %ld tokens in %ld ticks.",
+            (long) hopCount, (long) currentTime);
+        gmosTestComplete ("instance-events");
+    }
+
+    // Pass on the held tokens once the hold time has expired.
+    if (node->heldTokens == 0) {
+        return GMOS_TASK_SUSPEND;
+    }
+    holdTime = (int32_t) (node->forwardTime - currentTime);
+    if (holdTime > 0) {
+        return GMOS_TASK_RUN_LATER (holdTime);
+    }
+    testPassTokens (node->nextNode, node->heldTokens);
+    node->heldTokens = 0;
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Provides the main process entry point. This sets up each instance
+ * and then steps all the instances in turn, idling for the shortest
+ * requested period once they are all idle. The process exits from
+ * the node task on test completion.
+ */
+int main (void)
+{
+    testNode_t* node;
+    uint32_t nodeIndex;
+    uint32_t tokenIndex;
+    uint32_t execDelay;
+    uint32_t idleTime;
+
+    gmosPalInit ();
+
+    // Set up the nodes, with the node tasks running on the instance
+    // for each node.
+    for (nodeIndex = 0;
+        nodeIndex < GMOS_TEST_INSTANCE_COUNT; nodeIndex++) {
+        node = &(testNodes [nodeIndex]);
+        gmosInstanceInit (&(node->instance), node);
+        gmosEventInit (&(node->event), &(node->task));
+        node->nextNode = &(testNodes
+            [(nodeIndex + 1) % GMOS_TEST_INSTANCE_COUNT]);
+        node->task.taskTickFn = testNodeTaskFn;
+        node->task.taskData = node;
+        node->task.taskName = "Node";
+        gmosSchedulerTaskStart (&(node->task));
+    }
+
+    // Pass the tokens to nodes which are evenly spaced around the
+    // ring. The last instance is still selected at this point.
+    for (tokenIndex = 0;
+        tokenIndex < GMOS_TEST_TOKEN_COUNT; tokenIndex++) {
+        nodeIndex = (tokenIndex * GMOS_TEST_INSTANCE_COUNT) /
+            GMOS_TEST_TOKEN_COUNT;
+        tokenNodes [tokenIndex] = nodeIndex;
+        testPassTokens (&(testNodes [nodeIndex]), 1 << tokenIndex);
+    }
+
+    // Step all the instances in turn.
+    while (true) {
+        idleTime = UINT32_MAX;
+        for (nodeIndex = 0;
+            nodeIndex < GMOS_TEST_INSTANCE_COUNT; nodeIndex++) {
+            node = &(testNodes [nodeIndex]);
+            execDelay = gmosInstanceStep (&(node->instance));
+            if (execDelay < idleTime) {
+                idleTime = execDelay;
+            }
+        }
+        gmosPalIdle (idleTime);
+    }
+    return 0;
+}
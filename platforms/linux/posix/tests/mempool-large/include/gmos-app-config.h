@@ -0,0 +1,42 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the large memory pool segment test application
+ * configuration options. Shared segment and telemetry support are
+ * selected using the test build variant compiler options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the test application.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Use the standard memory pool segments with four 256 byte large
+ * memory pool segments.
+ */
+#define GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE 64
+#define GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER 64
+#define GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE 256
+#define GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER 4
+
+#endif // GMOS_APP_CONFIG_H
@@ -0,0 +1,325 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a test for the large memory pool segment class. This
+ * checks the selection of large and standard segments when allocating
+ * segment lists by capacity, including the fallback to standard
+ * segments when no large segments are available. It also checks that
+ * all segments are returned to the correct free lists when they are
+ * released and that buffer data is preserved when it is stored in
+ * segment lists containing both segment sizes.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-mempool.h"
+#include "gmos-buffers.h"
+#include "gmos-test.h"
+
+// Check for large segment support.
+#if (GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE != 256) || \
+    (GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE != 64)
+#error "The large segment test requires 64 and 256 byte segments."
+#endif
+
+// Specify the size of the buffer data used for the buffer test.
+#define TEST_BUFFER_SIZE 700
+
+// Specify the number of capacity allocation test cases.
+#define TEST_CAPACITY_CASE_COUNT 8
+
+// Specify the allocation capacity for each test case.
+static const uint16_t capacityCases [TEST_CAPACITY_CASE_COUNT] = {
+    1, 64, 65, 192, 193, 256, 300, 520 };
+
+// Specify the expected number of large segments for each test case.
+static const uint8_t capacityLargeCounts [TEST_CAPACITY_CASE_COUNT] = {
+    0, 0, 0, 0, 1, 1, 1, 2 };
+
+// Specify the expected number of standard segments for each test case.
+static const uint8_t capacityStandardCounts [
+    TEST_CAPACITY_CASE_COUNT] = { 1, 1, 2, 3, 0, 0, 1, 1 };
+
+// Allocate the test task state.
+static gmosTaskState_t testTask;
+static uint16_t initialFreeCount;
+static uint16_t initialLargeFreeCount;
+
+// Allocate the buffer test data.
+static uint8_t testData [TEST_BUFFER_SIZE];
+static uint8_t checkData [TEST_BUFFER_SIZE];
+
+/*
+ * Checks that all the memory pool segments have been returned to the
+ * appropriate free lists.
+ */
+static void testCheckAllFree (void)
+{
+    GMOS_TEST_CHECK (
+        gmosMempoolSegmentsAvailable () == initialFreeCount);
+    GMOS_TEST_CHECK (gmosMempoolLargeSegmentsAvailable () ==
+        initialLargeFreeCount);
+}
+
+/*
+ * Checks the composition of a segment list, which should contain the
+ * specified number of large segments followed by the specified number
+ * of standard segments. Each segment is filled to its full capacity so
+ * that any overlapping segments will be detected.
+ */
+static void testCheckSegmentList (gmosMempoolSegment_t* segmentList,
+    uint8_t largeCount, uint8_t standardCount)
+{
+    gmosMempoolSegment_t* segment;
+    uint16_t segmentSize;
+    uint16_t segmentIndex = 0;
+    uint16_t i;
+
+    // Check the segment sizes and fill each segment with its index.
+    for (segment = segmentList; segment != NULL;
+        segment = segment->nextSegment) {
+        segmentSize = gmosMempoolGetSegmentSize (segment);
+        GMOS_TEST_CHECK (segmentSize == ((segmentIndex < largeCount) ?
+            GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE :
+            GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE));
+        for (i = 0; i < segmentSize; i++) {
+            segment->data.bytes [i] = (uint8_t) segmentIndex;
+        }
+        segmentIndex += 1;
+    }
+    GMOS_TEST_CHECK (segmentIndex == largeCount + standardCount);
+
+    // Check that the segment contents have not been overwritten.
+    segmentIndex = 0;
+    for (segment = segmentList; segment != NULL;
+        segment = segment->nextSegment) {
+        segmentSize = gmosMempoolGetSegmentSize (segment);
+        for (i = 0; i < segmentSize; i++) {
+            if (segment->data.bytes [i] != (uint8_t) segmentIndex) {
+                GMOS_TEST_CHECK (false);
+                break;
+            }
+        }
+        segmentIndex += 1;
+    }
+}
+
+/*
+ * Checks the segment selection for each capacity allocation test case
+ * and then releases the allocated segments.
+ */
+static void testCapacityAlloc (void)
+{
+    gmosMempoolSegment_t* segmentList;
+    uint8_t i;
+
+    for (i = 0; i < TEST_CAPACITY_CASE_COUNT; i++) {
+        segmentList = gmosMempoolAllocCapacity (capacityCases [i]);
+        GMOS_TEST_CHECK (segmentList != NULL);
+        GMOS_TEST_CHECK (gmosMempoolLargeSegmentsAvailable () ==
+            initialLargeFreeCount - capacityLargeCounts [i]);
+        GMOS_TEST_CHECK (gmosMempoolSegmentsAvailable () ==
+            initialFreeCount - capacityStandardCounts [i]);
+        testCheckSegmentList (segmentList,
+            capacityLargeCounts [i], capacityStandardCounts [i]);
+        gmosMempoolFreeSegments (segmentList);
+        testCheckAllFree ();
+    }
+
+    // Zero capacity requests do not allocate any segments.
+    GMOS_TEST_CHECK (gmosMempoolAllocCapacity (0) == NULL);
+    testCheckAllFree ();
+}
+
+/*
+ * Checks that standard segments are used once all the large segments
+ * have been allocated, and that failed allocations do not modify the
+ * free lists.
+ */
+static void testLargeExhaustion (void)
+{
+    gmosMempoolSegment_t* largeSegments [
+        GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER];
+    gmosMempoolSegment_t* segmentList;
+    uint16_t freeCount;
+    uint8_t i;
+
+    // Allocate all the large segments individually.
+    for (i = 0; i < GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER; i++) {
+        largeSegments [i] = gmosMempoolAllocCapacity (
+            GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE);
+        GMOS_TEST_CHECK (largeSegments [i] != NULL);
+        GMOS_TEST_CHECK (gmosMempoolGetSegmentSize (largeSegments [i])
+            == GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_SIZE);
+    }
+    GMOS_TEST_CHECK (gmosMempoolLargeSegmentsAvailable () == 0);
+
+    // Subsequent allocations should only use standard segments.
+    segmentList = gmosMempoolAllocCapacity (300);
+    GMOS_TEST_CHECK (segmentList != NULL);
+    testCheckSegmentList (segmentList, 0, 5);
+    gmosMempoolFreeSegments (segmentList);
+
+    // Requests that exceed the standard segment capacity should fail.
+    freeCount = gmosMempoolSegmentsAvailable ();
+    segmentList = gmosMempoolAllocCapacity (
+        (freeCount + 1) * GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE);
+    GMOS_TEST_CHECK (segmentList == NULL);
+    GMOS_TEST_CHECK (gmosMempoolSegmentsAvailable () == freeCount);
+
+    // Single segment allocations never use large segments, so release
+    // the large segments individually in reverse order.
+    for (i = GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER; i > 0; i--) {
+        gmosMempoolFree (largeSegments [i - 1]);
+        GMOS_TEST_CHECK (gmosMempoolLargeSegmentsAvailable () ==
+            GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER - i + 1);
+    }
+    testCheckAllFree ();
+}
+
+/*
+ * Checks that single segment allocations only use standard segments.
+ */
+static void testSingleAlloc (void)
+{
+    gmosMempoolSegment_t* segment;
+
+    segment = gmosMempoolAlloc ();
+    GMOS_TEST_CHECK (segment != NULL);
+    GMOS_TEST_CHECK (gmosMempoolGetSegmentSize (segment) ==
+        GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE);
+    GMOS_TEST_CHECK (gmosMempoolLargeSegmentsAvailable () ==
+        initialLargeFreeCount);
+    gmosMempoolFree (segment);
+    testCheckAllFree ();
+}
+
+/*
+ * Checks that shared large segments are only returned to the free list
+ * once all references have been released.
+ */
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+static void testSharedLarge (void)
+{
+    gmosMempoolSegment_t* segmentList;
+
+    segmentList = gmosMempoolAllocCapacity (300);
+    GMOS_TEST_CHECK (segmentList != NULL);
+    gmosMempoolRetain (segmentList);
+    GMOS_TEST_CHECK (gmosMempoolIsShared (segmentList));
+    gmosMempoolFreeSegments (segmentList);
+    GMOS_TEST_CHECK (!gmosMempoolIsShared (segmentList));
+    GMOS_TEST_CHECK (gmosMempoolLargeSegmentsAvailable () ==
+        initialLargeFreeCount - 1);
+    GMOS_TEST_CHECK (gmosMempoolSegmentsAvailable () ==
+        initialFreeCount - 1);
+    gmosMempoolFreeSegments (segmentList);
+    testCheckAllFree ();
+}
+#endif
+
+/*
+ * Checks that buffer data is preserved when it is stored in segment
+ * lists containing both large and standard segments, including reads
+ * and writes that span segment boundaries.
+ */
+static void testBufferData (void)
+{
+    gmosBuffer_t buffer = GMOS_BUFFER_INIT ();
+    uint16_t offset;
+    uint16_t size;
+    uint16_t i;
+
+    // Append the test data in a single block, which should use the
+    // large segments.
+    for (i = 0; i < TEST_BUFFER_SIZE; i++) {
+        testData [i] = (uint8_t) gmosTestRandom (256);
+    }
+    GMOS_TEST_CHECK (
+        gmosBufferAppend (&buffer, testData, TEST_BUFFER_SIZE));
+    GMOS_TEST_CHECK (gmosBufferGetSize (&buffer) == TEST_BUFFER_SIZE);
+    GMOS_TEST_CHECK (gmosMempoolLargeSegmentsAvailable () <
+        initialLargeFreeCount);
+
+    // Read back random sections of the buffer.
+    for (i = 0; i < 200; i++) {
+        offset = gmosTestRandom (TEST_BUFFER_SIZE);
+        size = 1 + gmosTestRandom (TEST_BUFFER_SIZE - offset);
+        GMOS_TEST_CHECK (
+            gmosBufferRead (&buffer, offset, checkData, size));
+        GMOS_TEST_CHECK (
+            memcmp (checkData, testData + offset, size) == 0);
+    }
+
+    // Overwrite random sections of the buffer and check the result.
+    for (i = 0; i < 200; i++) {
+        offset = gmosTestRandom (TEST_BUFFER_SIZE);
+        size = 1 + gmosTestRandom (TEST_BUFFER_SIZE - offset);
+        memset (checkData, (uint8_t) i, size);
+        GMOS_TEST_CHECK (
+            gmosBufferWrite (&buffer, offset, checkData, size));
+        memset (testData + offset, (uint8_t) i, size);
+    }
+    GMOS_TEST_CHECK (
+        gmosBufferRead (&buffer, 0, checkData, TEST_BUFFER_SIZE));
+    GMOS_TEST_CHECK (
+        memcmp (checkData, testData, TEST_BUFFER_SIZE) == 0);
+
+    // Release the buffer segments.
+    gmosBufferReset (&buffer, 0);
+    testCheckAllFree ();
+}
+
+/*
+ * Implements the test task, which runs all the tests on the first task
+ * run.
+ */
+static gmosTaskStatus_t testTaskFn (void* nullData)
+{
+    initialFreeCount = gmosMempoolSegmentsAvailable ();
+    initialLargeFreeCount = gmosMempoolLargeSegmentsAvailable ();
+    GMOS_TEST_CHECK (initialLargeFreeCount ==
+        GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER);
+
+    testCapacityAlloc ();
+    testLargeExhaustion ();
+    testSingleAlloc ();
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+    testSharedLarge ();
+#endif
+    testBufferData ();
+    gmosTestComplete ("mempool-large");
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Sets up the test application.
+ */
+void gmosAppInit (void)
+{
+    testTask.taskTickFn = testTaskFn;
+    testTask.taskData = NULL;
+    testTask.taskName = "Test";
+    gmosSchedulerTaskStart (&testTask);
+}
@@ -0,0 +1,53 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the memory pool telemetry test application configuration
+ * options. Shared segment support and the large segment size are
+ * selected using the test build variant compiler options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the test application.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Run the test in virtual time, so that the low capacity time can be
+ * checked exactly.
+ */
+#define GMOS_CONFIG_POSIX_VIRTUAL_TIME true
+
+/*
+ * Enable memory pool telemetry and use a small memory pool, so that
+ * the low capacity threshold is crossed regularly.
+ */
+#define GMOS_CONFIG_MEMPOOL_TELEMETRY true
+#define GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE 64
+#define GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER 48
+#define GMOS_CONFIG_MEMPOOL_LARGE_SEGMENT_NUMBER 4
+
+/*
+ * Specify the number of random memory pool operations to run.
+ */
+#define GMOS_TEST_STEP_COUNT 200000
+
+#endif // GMOS_APP_CONFIG_H
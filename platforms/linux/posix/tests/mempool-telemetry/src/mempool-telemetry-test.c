@@ -0,0 +1,384 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a test for the memory pool telemetry statistics. A set of
+ * directed checks is followed by a random sequence of allocation,
+ * retain and release operations using random task owner tags. After
+ * every operation the memory pool statistics are checked against a
+ * shadow model of the expected memory pool usage. This includes the
+ * per-owner usage counts, the peak usage values, the allocation
+ * failure count and the time spent below the low capacity threshold.
+ * Releasing a reference to a shared segment must not be counted as
+ * freeing it.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-mempool.h"
+#include "gmos-test.h"
+
+// Specify the low capacity threshold used by the memory pool.
+#define TEST_LOW_CAPACITY_THRESHOLD \
+    (GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER / 4)
+
+// Specify the maximum number of segment lists held by the test.
+#define TEST_LIST_COUNT 24
+
+// Specify the number of operations to run on each task tick.
+#define TEST_BATCH_SIZE 50
+
+// Defines the shadow state for a single allocated segment list.
+typedef struct testSegmentList_t {
+    gmosMempoolSegment_t* segments;
+    uint32_t bytes;
+    uint16_t segmentCount;
+    uint16_t largeCount;
+    uint16_t extraRefs;
+    uint8_t owner;
+} testSegmentList_t;
+
+// Allocate the test task state.
+static gmosTaskState_t testTask;
+
+// Allocate the shadow model state.
+static testSegmentList_t testLists [TEST_LIST_COUNT];
+static gmosMempoolStats_t shadowStats;
+static uint32_t shadowLowTime;
+static bool shadowLow = false;
+
+// Count the number of operations run.
+static uint32_t stepCount = 0;
+
+/*
+ * Updates the shadow usage statistics after an allocation or release.
+ */
+static void testUpdateShadow (void)
+{
+    uint8_t i;
+    uint16_t segmentsInUse = 0;
+    uint16_t largeSegmentsInUse = 0;
+    uint32_t currentTime;
+    bool lowCapacity;
+
+    // Derive the current usage from the held segment lists.
+    for (i = 0; i < GMOS_MEMPOOL_OWNER_COUNT; i++) {
+        shadowStats.ownerBytes [i] = 0;
+    }
+    for (i = 0; i < TEST_LIST_COUNT; i++) {
+        if (testLists [i].segments != NULL) {
+            segmentsInUse += testLists [i].segmentCount;
+            largeSegmentsInUse += testLists [i].largeCount;
+            shadowStats.ownerBytes [testLists [i].owner] +=
+                testLists [i].bytes;
+        }
+    }
+    shadowStats.segmentsInUse = segmentsInUse;
+    shadowStats.largeSegmentsInUse = largeSegmentsInUse;
+
+    // Update the peak usage values.
+    if (shadowStats.peakSegmentsInUse < segmentsInUse) {
+        shadowStats.peakSegmentsInUse = segmentsInUse;
+    }
+    if (shadowStats.peakLargeSegmentsInUse < largeSegmentsInUse) {
+        shadowStats.peakLargeSegmentsInUse = largeSegmentsInUse;
+    }
+    for (i = 0; i < GMOS_MEMPOOL_OWNER_COUNT; i++) {
+        if (shadowStats.ownerPeakBytes [i] <
+            shadowStats.ownerBytes [i]) {
+            shadowStats.ownerPeakBytes [i] = shadowStats.ownerBytes [i];
+        }
+    }
+
+    // Track the low capacity periods.
+    lowCapacity = (GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER - segmentsInUse <
+        TEST_LOW_CAPACITY_THRESHOLD) ? true : false;
+    if (lowCapacity != shadowLow) {
+        currentTime = gmosPalGetTimer ();
+        if (lowCapacity) {
+            shadowStats.lowCapacityCount += 1;
+        } else {
+            shadowStats.lowCapacityTicks +=
+                (uint32_t) (currentTime - shadowLowTime);
+        }
+        shadowLowTime = currentTime;
+        shadowLow = lowCapacity;
+    }
+}
+
+/*
+ * Checks the memory pool statistics against the shadow model.
+ */
+static void testCheckStats (void)
+{
+    gmosMempoolStats_t stats;
+    uint64_t lowCapacityTicks = shadowStats.lowCapacityTicks;
+    uint8_t i;
+    bool checkOk = true;
+
+    gmosMempoolGetStats (&stats);
+    if (shadowLow) {
+        lowCapacityTicks +=
+            (uint32_t) (gmosPalGetTimer () - shadowLowTime);
+    }
+    for (i = 0; i < GMOS_MEMPOOL_OWNER_COUNT; i++) {
+        checkOk &= GMOS_TEST_CHECK (
+            stats.ownerBytes [i] == shadowStats.ownerBytes [i]);
+        checkOk &= GMOS_TEST_CHECK (
+            stats.ownerPeakBytes [i] == shadowStats.ownerPeakBytes [i]);
+    }
+    checkOk &= GMOS_TEST_CHECK (
+        stats.segmentsInUse == shadowStats.segmentsInUse);
+    checkOk &= GMOS_TEST_CHECK (
+        stats.peakSegmentsInUse == shadowStats.peakSegmentsInUse);
+    checkOk &= GMOS_TEST_CHECK (
+        stats.largeSegmentsInUse == shadowStats.largeSegmentsInUse);
+    checkOk &= GMOS_TEST_CHECK (stats.peakLargeSegmentsInUse ==
+        shadowStats.peakLargeSegmentsInUse);
+    checkOk &= GMOS_TEST_CHECK (
+        stats.allocFailCount == shadowStats.allocFailCount);
+    checkOk &= GMOS_TEST_CHECK (
+        stats.lowCapacityCount == shadowStats.lowCapacityCount);
+    checkOk &= GMOS_TEST_CHECK (
+        stats.lowCapacityTicks == lowCapacityTicks);
+    if (!checkOk) {
+        gmosTestComplete ("mempool-telemetry");
+    }
+}
+
+/*
+ * Allocates a new segment list using a random owner tag and a random
+ * allocation function.
+ */
+static void testOpAlloc (testSegmentList_t* list)
+{
+    gmosMempoolSegment_t* segment;
+    uint16_t segmentSize;
+
+    list->owner = gmosTestRandom (GMOS_MEMPOOL_OWNER_COUNT);
+    gmosMempoolSetTaskOwner (&testTask, list->owner);
+    switch (gmosTestRandom (3)) {
+        case 0 :
+            list->segments = gmosMempoolAlloc ();
+            break;
+        case 1 :
+            list->segments = gmosMempoolAllocSegments (
+                1 + gmosTestRandom (8));
+            break;
+        default :
+            list->segments = gmosMempoolAllocCapacity (
+                1 + gmosTestRandom (1000));
+            break;
+    }
+
+    // Derive the shadow state from the allocated segment list.
+    list->bytes = 0;
+    list->segmentCount = 0;
+    list->largeCount = 0;
+    list->extraRefs = 0;
+    for (segment = list->segments;
+        segment != NULL; segment = segment->nextSegment) {
+        segmentSize = gmosMempoolGetSegmentSize (segment);
+        list->bytes += segmentSize;
+        if (segmentSize == GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) {
+            list->segmentCount += 1;
+        } else {
+            list->largeCount += 1;
+        }
+    }
+    if (list->segments == NULL) {
+        shadowStats.allocFailCount += 1;
+    }
+}
+
+/*
+ * Releases a reference to a segment list. The segments are only freed
+ * when there are no remaining shared references.
+ */
+static void testOpFree (testSegmentList_t* list)
+{
+    gmosMempoolSegment_t* segment = list->segments;
+    uint16_t segmentSize = gmosMempoolGetSegmentSize (segment);
+
+    // Release a shared reference to the segment list.
+    if (list->extraRefs > 0) {
+        if (gmosTestRandom (2) == 0) {
+            gmosMempoolFreeSegments (segment);
+        } else {
+            gmosMempoolFree (segment);
+        }
+        list->extraRefs -= 1;
+    }
+
+    // Free the first segment in the list.
+    else if (gmosTestRandom (2) == 0) {
+        list->segments = segment->nextSegment;
+        gmosMempoolFree (segment);
+        list->bytes -= segmentSize;
+        if (segmentSize == GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE) {
+            list->segmentCount -= 1;
+        } else {
+            list->largeCount -= 1;
+        }
+    }
+
+    // Free the entire segment list.
+    else {
+        gmosMempoolFreeSegments (segment);
+        list->segments = NULL;
+    }
+}
+
+/*
+ * Implements the test task function.
+ */
+static gmosTaskStatus_t testTaskFn (void* nullData)
+{
+    testSegmentList_t* list;
+    uint8_t i;
+
+    // Run a batch of random memory pool operations, then wait for a
+    // random interval so that the low capacity time accumulates.
+    for (i = 0; i < TEST_BATCH_SIZE; i++) {
+        list = &(testLists [gmosTestRandom (TEST_LIST_COUNT)]);
+        if (list->segments == NULL) {
+            testOpAlloc (list);
+        }
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+        else if (gmosTestRandom (4) == 0) {
+            gmosMempoolRetain (list->segments);
+            list->extraRefs += 1;
+        }
+#endif
+        else {
+            testOpFree (list);
+        }
+        testUpdateShadow ();
+        testCheckStats ();
+        stepCount += 1;
+    }
+
+    // Periodically start a new measurement window.
+    if ((stepCount % 10000 == 0) &&
+        (stepCount < GMOS_TEST_STEP_COUNT)) {
+        gmosMempoolResetStats ();
+        shadowStats.lowCapacityTicks = 0;
+        shadowStats.lowCapacityCount = 0;
+        shadowStats.allocFailCount = 0;
+        shadowStats.peakSegmentsInUse = shadowStats.segmentsInUse;
+        shadowStats.peakLargeSegmentsInUse =
+            shadowStats.largeSegmentsInUse;
+        for (i = 0; i < GMOS_MEMPOOL_OWNER_COUNT; i++) {
+            shadowStats.ownerPeakBytes [i] = shadowStats.ownerBytes [i];
+        }
+        shadowLowTime = gmosPalGetTimer ();
+        testCheckStats ();
+    }
+    if (stepCount < GMOS_TEST_STEP_COUNT) {
+        return GMOS_TASK_RUN_LATER (1 + gmosTestRandom (20));
+    }
+
+    // Release all the segment lists and check that all the owner
+    // counts return to zero.
+    for (i = 0; i < TEST_LIST_COUNT; i++) {
+        while (testLists [i].segments != NULL) {
+            gmosMempoolFreeSegments (testLists [i].segments);
+            if (testLists [i].extraRefs > 0) {
+                testLists [i].extraRefs -= 1;
+            } else {
+                testLists [i].segments = NULL;
+            }
+        }
+    }
+    testUpdateShadow ();
+    testCheckStats ();
+    for (i = 0; i < GMOS_MEMPOOL_OWNER_COUNT; i++) {
+        GMOS_TEST_CHECK (shadowStats.ownerBytes [i] == 0);
+    }
+    GMOS_TEST_CHECK (gmosMempoolSegmentsAvailable () ==
+        GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER);
+    gmosMempoolLogStats ();
+    gmosTestComplete ("mempool-telemetry");
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Runs the directed telemetry checks. Allocations made outside a task
+ * are attributed to the 'other' owner tag.
+ */
+static void testDirected (void)
+{
+    gmosMempoolStats_t stats;
+    gmosMempoolSegment_t* segment;
+
+    segment = gmosMempoolAlloc ();
+    gmosMempoolGetStats (&stats);
+    GMOS_TEST_CHECK (stats.ownerBytes [GMOS_MEMPOOL_OWNER_OTHER] ==
+        GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE);
+    GMOS_TEST_CHECK (stats.segmentsInUse == 1);
+
+    // Releasing a shared reference does not free the segment.
+#if GMOS_CONFIG_MEMPOOL_SHARED_SEGMENTS
+    gmosMempoolRetain (segment);
+    gmosMempoolFree (segment);
+    gmosMempoolGetStats (&stats);
+    GMOS_TEST_CHECK (stats.ownerBytes [GMOS_MEMPOOL_OWNER_OTHER] ==
+        GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE);
+    GMOS_TEST_CHECK (stats.segmentsInUse == 1);
+#endif
+    gmosMempoolFree (segment);
+    gmosMempoolGetStats (&stats);
+    GMOS_TEST_CHECK (stats.ownerBytes [GMOS_MEMPOOL_OWNER_OTHER] == 0);
+    GMOS_TEST_CHECK (stats.ownerPeakBytes [GMOS_MEMPOOL_OWNER_OTHER] ==
+        GMOS_CONFIG_MEMPOOL_SEGMENT_SIZE);
+    GMOS_TEST_CHECK (stats.segmentsInUse == 0);
+    GMOS_TEST_CHECK (stats.peakSegmentsInUse == 1);
+
+    // Oversized requests are counted as failures.
+    segment = gmosMempoolAllocSegments (
+        GMOS_CONFIG_MEMPOOL_SEGMENT_NUMBER + 1);
+    GMOS_TEST_CHECK (segment == NULL);
+    gmosMempoolGetStats (&stats);
+    GMOS_TEST_CHECK (stats.allocFailCount == 1);
+
+    // Resetting the statistics clears the peak and failure counts.
+    gmosMempoolResetStats ();
+    gmosMempoolGetStats (&stats);
+    GMOS_TEST_CHECK (stats.ownerPeakBytes [GMOS_MEMPOOL_OWNER_OTHER] == 0);
+    GMOS_TEST_CHECK (stats.peakSegmentsInUse == 0);
+    GMOS_TEST_CHECK (stats.allocFailCount == 0);
+}
+
+/*
+ * Sets up the test application.
+ */
+void gmosAppInit (void)
+{
+    testDirected ();
+    testTask.taskTickFn = testTaskFn;
+    testTask.taskData = NULL;
+    testTask.taskName = "Telemetry Test";
+    gmosSchedulerTaskStart (&testTask);
+    GMOS_TEST_CHECK (gmosMempoolSetTaskOwner (&testTask,
+        GMOS_MEMPOOL_OWNER_NETWORK) == GMOS_MEMPOOL_OWNER_OTHER);
+}
@@ -0,0 +1,190 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a test for cross-core event delivery using two scheduler
+ * cores. A test task on each core exchanges events with the test task
+ * on the other core for a fixed number of rounds. On each round, a
+ * memory pool segment containing the round number is passed to the
+ * other core, a core call is posted to the other core and a task on
+ * the other core is resumed. The test checks that each task is only
+ * run on its owning core and that all the data and core calls are
+ * received in the correct order.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-events.h"
+#include "gmos-mempool.h"
+#include "gmos-instance.h"
+#include "gmos-test.h"
+
+// Check for the expected number of scheduler cores.
+#if (GMOS_CONFIG_SCHEDULER_CORES != 2)
+#error "The multi-core test requires two scheduler cores."
+#endif
+
+// Specify the test state for each processor core.
+typedef struct testCore_t {
+    gmosTaskState_t exchangeTask;
+    gmosTaskState_t resumeTask;
+    gmosEvent_t exchangeEvent;
+    gmosMempoolSegment_t* segment;
+    uint32_t roundCount;
+    uint32_t callCount;
+    volatile uint32_t resumeCount;
+    uint8_t coreId;
+} testCore_t;
+
+// Allocate the test state for each processor core.
+static testCore_t testCores [GMOS_CONFIG_SCHEDULER_CORES];
+
+/*
+ * Implements the core call handler. The call data holds the sending
+ * core round number, which should match the local call count.
+ */
+static void testCoreCallHandler (void* callData)
+{
+    testCore_t* testCore = &(testCores [GMOS_PAL_CORE_ID]);
+
+    GMOS_TEST_CHECK ((uintptr_t) callData == testCore->callCount);
+    testCore->callCount += 1;
+}
+
+/*
+ * Implements the resume task function. This is resumed from the other
+ * core on each exchange round.
+ */
+static gmosTaskStatus_t testResumeTaskFn (void* taskData)
+{
+    testCore_t* testCore = (testCore_t*) taskData;
+
+    GMOS_TEST_CHECK (testCore->coreId == GMOS_PAL_CORE_ID);
+    testCore->resumeCount += 1;
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Checks the test results on completion. Since the core calls and
+ * exchange events are processed independently, the final core call
+ * may not have been processed when the last exchange event is run.
+ */
+static void testCheckResults (testCore_t* testCore)
+{
+    testCore_t* otherCore = &(testCores [1 - testCore->coreId]);
+
+    GMOS_LOG_FMT (LOG_INFO,
+        "Completed %ld rounds with %ld and %ld remote task resumes.",
+        (long) testCore->roundCount, (long) testCore->resumeCount,
+        (long) otherCore->resumeCount);
+    GMOS_TEST_CHECK (testCore->callCount + 1 >= testCore->roundCount);
+    GMOS_TEST_CHECK (testCore->resumeCount > 0);
+    GMOS_TEST_CHECK (otherCore->resumeCount > 0);
+    gmosTestComplete ("multi-core");
+}
+
+/*
+ * Implements the exchange task function. This checks the memory pool
+ * segment received from the other core and then sends a new memory
+ * pool segment, core call and task resume request back to it.
+ */
+static gmosTaskStatus_t testExchangeTaskFn (void* taskData)
+{
+    testCore_t* testCore = (testCore_t*) taskData;
+    testCore_t* otherCore = &(testCores [1 - testCore->coreId]);
+    gmosMempoolSegment_t* segment;
+
+    // Tasks must only run on the owning processor core.
+    GMOS_TEST_CHECK (testCore->coreId == GMOS_PAL_CORE_ID);
+    if (gmosEventResetBits (&(testCore->exchangeEvent)) == 0) {
+        return GMOS_TASK_SUSPEND;
+    }
+
+    // Check the segment contents from the other core. No segment is
+    // sent for the first round.
+    segment = testCore->segment;
+    testCore->segment = NULL;
+    if (segment != NULL) {
+        GMOS_TEST_CHECK (segment->data.words [0] ==
+            testCore->roundCount);
+        gmosMempoolFree (segment);
+    }
+    testCore->roundCount += 1;
+    if ((testCore->coreId == 0) &&
+        (testCore->roundCount == GMOS_TEST_ROUND_COUNT)) {
+        testCheckResults (testCore);
+        return GMOS_TASK_SUSPEND;
+    }
+
+    // Send the next segment, core call and resume request to the
+    // other core before setting its exchange event.
+    segment = gmosMempoolAlloc ();
+    GMOS_TEST_CHECK (segment != NULL);
+    if (segment != NULL) {
+        segment->data.words [0] = otherCore->roundCount;
+        otherCore->segment = segment;
+    }
+    GMOS_TEST_CHECK (gmosInstanceCoreCallPost (otherCore->coreId,
+        testCoreCallHandler,
+        (void*) (uintptr_t) (testCore->roundCount - 1)));
+    gmosSchedulerTaskResume (&(otherCore->resumeTask));
+    gmosEventSetBits (&(otherCore->exchangeEvent), 1);
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Starts the test tasks on the current processor core.
+ */
+static void testCoreStart (uint8_t coreId)
+{
+    testCore_t* testCore = &(testCores [coreId]);
+
+    testCore->coreId = coreId;
+    testCore->exchangeTask.taskTickFn = testExchangeTaskFn;
+    testCore->exchangeTask.taskData = testCore;
+    testCore->exchangeTask.taskName = "Exchange";
+    gmosEventInit (&(testCore->exchangeEvent),
+        &(testCore->exchangeTask));
+    gmosSchedulerTaskStart (&(testCore->exchangeTask));
+    testCore->resumeTask.taskTickFn = testResumeTaskFn;
+    testCore->resumeTask.taskData = testCore;
+    testCore->resumeTask.taskName = "Resume";
+    gmosSchedulerTaskStart (&(testCore->resumeTask));
+}
+
+/*
+ * Sets up the test application on the primary processor core.
+ */
+void gmosAppInit (void)
+{
+    testCoreStart (0);
+}
+
+/*
+ * Sets up the test application on the secondary processor core. The
+ * first exchange round is started once both cores are running.
+ */
+void gmosAppCoreInit (uint8_t coreId)
+{
+    testCoreStart (coreId);
+    gmosEventSetBits (&(testCores [0].exchangeEvent), 1);
+}
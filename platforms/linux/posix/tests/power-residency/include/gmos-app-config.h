@@ -0,0 +1,53 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the power state residency test application configuration
+ * options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the test application.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Run the test in virtual time, so that the residency totals can be
+ * checked exactly against the elapsed time.
+ */
+#define GMOS_CONFIG_POSIX_VIRTUAL_TIME true
+
+/*
+ * Enable power state residency accounting. The power save current and
+ * supply voltage are selected so that the energy estimate in
+ * microjoules matches the power save residency in system timer ticks.
+ */
+#define GMOS_CONFIG_POWER_RESIDENCY true
+#define GMOS_CONFIG_POWER_ACTIVE_CURRENT 5000
+#define GMOS_CONFIG_POWER_SAVE_CURRENT 1000
+#define GMOS_CONFIG_POWER_SUPPLY_VOLTAGE 1000
+
+/*
+ * Specify the number of test task runs.
+ */
+#define GMOS_TEST_STEP_COUNT 100000
+
+#endif // GMOS_APP_CONFIG_H
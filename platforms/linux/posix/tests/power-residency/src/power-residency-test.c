@@ -0,0 +1,139 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a test for the power state residency accounting. Two test
+ * tasks run with random delays, and a lifecycle monitor randomly
+ * rejects requests to enter the power save state, which are then
+ * recorded as event wakeups. The test checks that the residency
+ * totals match the elapsed virtual time, that the timer and event
+ * wakeup counts are correct and that the first task to run after each
+ * wakeup is recorded as the wake task.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-power.h"
+#include "gmos-test.h"
+
+// Defines the test state for a single test task.
+typedef struct testTask_t {
+    gmosTaskState_t task;
+    uint32_t wakeCount;
+} testTask_t;
+
+// Allocate the test tasks and lifecycle monitor.
+static testTask_t testTasks [2];
+static gmosLifecycleMonitor_t testMonitor;
+
+// Track the test start time and the most recent task run time.
+static uint32_t startTime;
+static uint32_t lastRunTime;
+static uint32_t testStepCount = 0;
+
+// Track the expected wakeup counts.
+static uint32_t timerWakeCount = 0;
+static uint32_t eventWakeCount = 0;
+
+/*
+ * Implements the lifecycle monitor, which randomly rejects requests to
+ * enter the power save state.
+ */
+static bool testMonitorFn (gmosLifecycleStatus_t lifecycleStatus)
+{
+    if ((lifecycleStatus == SCHEDULER_ENTER_POWER_SAVE) &&
+        (gmosTestRandom (4) == 0)) {
+        eventWakeCount += 1;
+        return false;
+    }
+    return true;
+}
+
+/*
+ * Implements the test task function, which checks the power state
+ * residency statistics and then selects a random delay.
+ */
+static gmosTaskStatus_t testTaskFn (void* taskData)
+{
+    testTask_t* testTask = (testTask_t*) taskData;
+    uint32_t currentTime = gmosPalGetTimer ();
+    uint32_t elapsedTime = currentTime - startTime;
+    gmosPowerStats_t powerStats;
+    uint8_t i;
+
+    // The first task to run at a new timer value is the wake task.
+    if (currentTime != lastRunTime) {
+        timerWakeCount += 1;
+        testTask->wakeCount += 1;
+        lastRunTime = currentTime;
+        GMOS_TEST_CHECK (gmosPowerGetWakeTask () == &(testTask->task));
+    }
+
+    // Check the residency totals, wakeup counts and energy estimate.
+    gmosPowerGetStats (&powerStats);
+    GMOS_TEST_CHECK (powerStats.residencyTicks [
+        GMOS_POWER_STATE_ACTIVE] == 0);
+    GMOS_TEST_CHECK (powerStats.residencyTicks [
+        GMOS_POWER_STATE_POWER_SAVE] == elapsedTime);
+    GMOS_TEST_CHECK (powerStats.residencyTicks [
+        GMOS_POWER_STATE_DEEP_SLEEP] == 0);
+    GMOS_TEST_CHECK (powerStats.timerWakeCount == timerWakeCount);
+    GMOS_TEST_CHECK (powerStats.eventWakeCount == eventWakeCount);
+    GMOS_TEST_CHECK (powerStats.energyMicrojoules == elapsedTime);
+
+    // Check the per-task wake counts and complete the test after the
+    // required number of steps.
+    if (testStepCount >= GMOS_TEST_STEP_COUNT) {
+        for (i = 0; i < 2; i++) {
+            GMOS_TEST_CHECK (testTasks [i].wakeCount ==
+                gmosPowerTaskGetWakes (&(testTasks [i].task)));
+            GMOS_TEST_CHECK (testTasks [i].wakeCount > 0);
+        }
+        GMOS_TEST_CHECK ((timerWakeCount > 0) && (eventWakeCount > 0));
+        gmosPowerLogStats ();
+        gmosTestComplete ("power-residency");
+        return GMOS_TASK_SUSPEND;
+    }
+    testStepCount += 1;
+    return GMOS_TASK_RUN_LATER (1 + gmosTestRandom (50));
+}
+
+/*
+ * Sets up the test application.
+ */
+void gmosAppInit (void)
+{
+    uint8_t i;
+
+    gmosPowerInit ();
+    gmosLifecycleAddMonitor (&testMonitor, testMonitorFn);
+    startTime = gmosPalGetTimer ();
+    lastRunTime = startTime;
+    for (i = 0; i < 2; i++) {
+        testTasks [i].wakeCount = 0;
+        testTasks [i].task.taskTickFn = testTaskFn;
+        testTasks [i].task.taskData = &(testTasks [i]);
+        testTasks [i].task.taskName = (i == 0) ? "Task A" : "Task B";
+        gmosSchedulerTaskStart (&(testTasks [i].task));
+    }
+}
@@ -0,0 +1,104 @@
+#!/bin/sh
+
+#
+# The Gubbins Microcontroller Operating System
+#
+# Copyright 2026 Zynaptic Limited
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+# implied. See the License for the specific language governing
+# permissions and limitations under the License.
+#
+
+#
+# This script builds and runs the POSIX host test applications. Each
+# test application directory is built as a standalone GubbinsMOS
+# application and the test result is determined from the host process
+# exit status. If no test application directories are specified, all
+# the test applications in the same directory as this script are run.
+# The benchmark applications may be run by specifying their directory
+# paths explicitly.
+#
+# If a test application directory contains a 'test-variants' file, the
+# test application is built and run once for each non-empty line in
+# that file. Each line specifies the additional compiler options that
+# are used to select the corresponding test build variant.
+#
+# The following environment variables may be used to modify the test
+# runner behaviour:
+#   GMOS_TEST_BUILD_DIR - The root directory for test build files.
+#   GMOS_TEST_TIMEOUT - The run time limit for each test in seconds.
+#   GMOS_POSIX_SANITIZE - The list of compiler sanitizers to enable.
+#
+
+TEST_DIR=$(cd "$(dirname "$0")" && pwd)
+GMOS_GIT_DIR=$(cd "${TEST_DIR}/../../../.." && pwd)
+BUILD_ROOT=${GMOS_TEST_BUILD_DIR:-/tmp/gmos_build/posix-tests}
+TIMEOUT=${GMOS_TEST_TIMEOUT:-300}
+PASS_COUNT=0
+FAIL_COUNT=0
+
+# Select all the local test applications by default.
+if [ $# -eq 0 ]; then
+    set -- "${TEST_DIR}"/*/app-build.mk
+    for APP_BUILD_FILE in "$@"; do
+        shift
+        set -- "$@" "$(dirname "${APP_BUILD_FILE}")"
+    done
+fi
+
+# Builds and runs a single test application variant.
+run_test () {
+    APP_DIR=$1
+    TEST_NAME=$2
+    TEST_CFLAGS=$3
+    BUILD_DIR=${GROUP_BUILD_DIR}/${TEST_NAME}
+    echo "*** Running ${TEST_NAME} ${TEST_CFLAGS}"
+    if ! make -s -C "${GMOS_GIT_DIR}" \
+        GMOS_TARGET_PLATFORM=linux/posix \
+        GMOS_APP_DIR="${APP_DIR}" \
+        GMOS_BUILD_DIR="${BUILD_DIR}" \
+        GMOS_TEST_CFLAGS="${TEST_CFLAGS}" \
+        "${BUILD_DIR}/firmware.elf" > "${BUILD_DIR}.log" 2>&1; then
+        cat "${BUILD_DIR}.log"
+        echo "*** ${TEST_NAME} : BUILD FAILED"
+        FAIL_COUNT=$((FAIL_COUNT + 1))
+    elif timeout "${TIMEOUT}" "${BUILD_DIR}/firmware.elf"; then
+        PASS_COUNT=$((PASS_COUNT + 1))
+    else
+        echo "*** ${TEST_NAME} : FAILED"
+        FAIL_COUNT=$((FAIL_COUNT + 1))
+    fi
+}
+
+# Run each of the test applications, including all build variants.
+for APP_PATH in "$@"; do
+    APP_DIR=$(cd "${APP_PATH}" && pwd)
+    APP_NAME=$(basename "${APP_DIR}")
+    GROUP_BUILD_DIR=${BUILD_ROOT}/$(basename "$(dirname "${APP_DIR}")")
+    mkdir -p "${GROUP_BUILD_DIR}"
+    if [ -f "${APP_DIR}/test-variants" ]; then
+        VARIANT=0
+        while read -r TEST_CFLAGS <&3; do
+            if [ -n "${TEST_CFLAGS}" ]; then
+                run_test "${APP_DIR}" "${APP_NAME}-${VARIANT}" \
+                    "${TEST_CFLAGS}"
+                VARIANT=$((VARIANT + 1))
+            fi
+        done 3< "${APP_DIR}/test-variants"
+    else
+        run_test "${APP_DIR}" "${APP_NAME}" ""
+    fi
+done
+
+# Summarise the test results.
+echo "*** ${PASS_COUNT} passed, ${FAIL_COUNT} failed"
+[ ${FAIL_COUNT} -eq 0 ]
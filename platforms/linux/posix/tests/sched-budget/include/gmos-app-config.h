@@ -0,0 +1,49 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the scheduler task budget test application configuration
+ * options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the test application.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Enable task execution budgets, with budget checking disabled by
+ * default. The scheduler watchdog is triggered after three consecutive
+ * budget overruns.
+ */
+#define GMOS_CONFIG_SCHEDULER_TASK_BUDGET true
+#define GMOS_CONFIG_SCHEDULER_TASK_BUDGET_DEFAULT 0
+#define GMOS_CONFIG_SCHEDULER_OVERRUN_LIMIT 3
+
+/*
+ * Specify the task execution budget and the run time for slow task
+ * runs, as integer numbers of microseconds. These are large enough
+ * that host scheduling jitter does not cause spurious overruns.
+ */
+#define GMOS_TEST_TASK_BUDGET 20000
+#define GMOS_TEST_SLOW_RUN_TIME 40000
+
+#endif // GMOS_APP_CONFIG_H
@@ -0,0 +1,160 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a test for the scheduler task execution budgets and the
+ * scheduler watchdog. The watched task follows a fixed sequence of
+ * slow and fast runs, and the test checks that each slow run is
+ * recorded as an overrun and that the watchdog handler is called after
+ * every third consecutive overrun. A second task with budget checking
+ * disabled also runs slowly, but must not be recorded as overrunning.
+ * This test runs in real time, since task execution takes no time in
+ * virtual time mode.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-test.h"
+
+// Specify the sequence of slow ('S') and fast ('F') runs for the
+// watched task. A slow run that first sets the task budget ('B')
+// clears the consecutive overrun count.
+static const char testRunSequence [] = "SSFSSSSSSSFSSBSSF";
+
+// Specify the watched task runs after which the scheduler watchdog is
+// expected to be triggered, terminated by a negative value.
+static const int8_t testWatchdogRuns [] = { 5, 8, 15, -1 };
+
+// Allocate the test task state.
+static gmosTaskState_t watchedTask;
+static gmosTaskState_t uncheckedTask;
+
+// Track the test progress.
+static uint8_t watchedRunIndex = 0;
+static uint8_t uncheckedRunCount = 0;
+static uint8_t watchdogCount = 0;
+static uint8_t expectedOverruns = 0;
+
+/*
+ * Busy waits for the specified number of microseconds.
+ */
+static void testSpin (uint32_t spinMicros)
+{
+    uint64_t endNanos = gmosTestGetHostNanos () + spinMicros * 1000ULL;
+    while (gmosTestGetHostNanos () < endNanos) {}
+}
+
+/*
+ * Implements the scheduler watchdog handler. This checks that the
+ * watchdog is only triggered for the watched task at the expected
+ * points in the run sequence.
+ */
+static void testWatchdogFn (gmosTaskState_t* task)
+{
+    GMOS_TEST_CHECK (task == &watchedTask);
+    GMOS_TEST_CHECK (testWatchdogRuns [watchdogCount] ==
+        (int8_t) (watchedRunIndex - 1));
+    GMOS_LOG_FMT (LOG_INFO,
+        "Watchdog triggered after run %d.", watchedRunIndex - 1);
+    if (testWatchdogRuns [watchdogCount] >= 0) {
+        watchdogCount += 1;
+    }
+}
+
+/*
+ * Runs the test checks on completion.
+ */
+static void testComplete (void)
+{
+    gmosSchedulerOverrunStats_t overrunStats;
+
+    gmosSchedulerGetOverrunStats (&overrunStats);
+    GMOS_TEST_CHECK (testWatchdogRuns [watchdogCount] < 0);
+    GMOS_TEST_CHECK (gmosSchedulerTaskGetOverruns (&watchedTask) ==
+        expectedOverruns);
+    GMOS_TEST_CHECK (gmosSchedulerTaskGetOverruns (&uncheckedTask) == 0);
+    GMOS_TEST_CHECK (overrunStats.overrunCount == expectedOverruns);
+    GMOS_TEST_CHECK (overrunStats.watchdogCount == watchdogCount);
+    GMOS_TEST_CHECK (overrunStats.runCount >=
+        watchedRunIndex + uncheckedRunCount);
+    gmosTestComplete ("sched-budget");
+}
+
+/*
+ * Implements the watched task, which runs each step of the run
+ * sequence in turn.
+ */
+static gmosTaskStatus_t testWatchedTaskFn (void* nullData)
+{
+    char runType = testRunSequence [watchedRunIndex];
+
+    // Complete the test at the end of the run sequence.
+    if (runType == '\0') {
+        testComplete ();
+        return GMOS_TASK_SUSPEND;
+    }
+
+    // Run the next step in the run sequence.
+    if (runType == 'B') {
+        gmosSchedulerTaskSetBudget (&watchedTask, GMOS_TEST_TASK_BUDGET);
+    }
+    if (runType != 'F') {
+        testSpin (GMOS_TEST_SLOW_RUN_TIME);
+        expectedOverruns += 1;
+    }
+    watchedRunIndex += 1;
+    return GMOS_TASK_RUN_LATER (1);
+}
+
+/*
+ * Implements the unchecked task, which runs slowly with budget
+ * checking disabled.
+ */
+static gmosTaskStatus_t testUncheckedTaskFn (void* nullData)
+{
+    if (uncheckedRunCount >= 4) {
+        return GMOS_TASK_SUSPEND;
+    }
+    testSpin (GMOS_TEST_SLOW_RUN_TIME);
+    uncheckedRunCount += 1;
+    return GMOS_TASK_RUN_LATER (1);
+}
+
+/*
+ * Sets up the test application.
+ */
+void gmosAppInit (void)
+{
+    gmosSchedulerSetWatchdog (testWatchdogFn);
+
+    watchedTask.taskTickFn = testWatchedTaskFn;
+    watchedTask.taskData = NULL;
+    watchedTask.taskName = "Watched Task";
+    gmosSchedulerTaskStart (&watchedTask);
+    gmosSchedulerTaskSetBudget (&watchedTask, GMOS_TEST_TASK_BUDGET);
+
+    uncheckedTask.taskTickFn = testUncheckedTaskFn;
+    uncheckedTask.taskData = NULL;
+    uncheckedTask.taskName = "Unchecked Task";
+    gmosSchedulerTaskStart (&uncheckedTask);
+}
@@ -0,0 +1,45 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the scheduler idle worker test application configuration
+ * options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the test application.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Run the test in virtual time, so that the idle periods seen by the
+ * idle workers can be checked exactly.
+ */
+#define GMOS_CONFIG_POSIX_VIRTUAL_TIME true
+
+/*
+ * Specify the number of idle workers and the number of control task
+ * runs for the test.
+ */
+#define GMOS_TEST_WORKER_COUNT 4
+#define GMOS_TEST_STEP_COUNT 100000
+
+#endif // GMOS_APP_CONFIG_H
@@ -0,0 +1,172 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a randomised test for the scheduler idle workers. A
+ * control task runs with random delays and randomly requests work from
+ * a set of idle workers, which randomly report further pending work.
+ * The test checks that idle workers only run when they have pending
+ * work and the idle period before the next control task deadline is
+ * long enough, that idle work is deferred when the next deadline is too
+ * close, and that all pending work is completed during each long idle
+ * period. The test runs in virtual time, which does not advance while
+ * the idle workers are running.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-test.h"
+
+// Specify the minimum idle period and idle worker budget in ticks.
+#define TEST_MIN_IDLE_TIME \
+    GMOS_MS_TO_TICKS (GMOS_CONFIG_SCHEDULER_IDLE_WORK_MIN_TIME)
+#define TEST_IDLE_BUDGET \
+    GMOS_MS_TO_TICKS (GMOS_CONFIG_SCHEDULER_IDLE_WORK_BUDGET)
+
+// Defines the test state for a single idle worker.
+typedef struct testWorker_t {
+    gmosIdleWorker_t worker;
+    uint32_t runCount;
+    bool pending;
+} testWorker_t;
+
+// Allocate the test idle workers and control task state.
+static testWorker_t testWorkers [GMOS_TEST_WORKER_COUNT];
+static gmosTaskState_t testTask;
+static uint32_t testStepCount = 0;
+
+// Track the control task run time and next scheduled run time.
+static uint32_t lastRunTime;
+static uint32_t nextRunTime;
+
+// Count the idle worker runs during the current idle period.
+static uint32_t idleRunCount = 0;
+
+// Count the long idle periods and the deferred idle work periods.
+static uint32_t longIdleCount = 0;
+static uint32_t deferredCount = 0;
+
+/*
+ * Implements the idle worker function, which checks that it has
+ * pending work and that the idle period is long enough.
+ */
+static bool testWorkerFn (void* workerData, uint32_t budget)
+{
+    testWorker_t* testWorker = (testWorker_t*) workerData;
+    uint32_t currentTime = gmosPalGetTimer ();
+
+    // Check the pending work flag and the available idle period.
+    GMOS_TEST_CHECK (testWorker->pending);
+    GMOS_TEST_CHECK (currentTime == lastRunTime);
+    GMOS_TEST_CHECK (nextRunTime - currentTime >= TEST_MIN_IDLE_TIME);
+    GMOS_TEST_CHECK (budget == TEST_IDLE_BUDGET);
+    testWorker->runCount += 1;
+    idleRunCount += 1;
+
+    // Randomly indicate that further work is pending.
+    testWorker->pending = (gmosTestRandom (3) == 0);
+    return testWorker->pending;
+}
+
+/*
+ * Implements the control task, which checks the idle worker runs for
+ * the previous idle period and then randomly requests idle work.
+ */
+static gmosTaskStatus_t testTaskFn (void* nullData)
+{
+    uint32_t currentTime = gmosPalGetTimer ();
+    uint32_t delay;
+    bool pending = false;
+    uint8_t i;
+
+    // Check that no idle work was run during a short idle period and
+    // that all pending work was completed during a long idle period.
+    for (i = 0; i < GMOS_TEST_WORKER_COUNT; i++) {
+        pending |= testWorkers [i].pending;
+    }
+    if (testStepCount > 0) {
+        GMOS_TEST_CHECK (currentTime == nextRunTime);
+        if (nextRunTime - lastRunTime >= TEST_MIN_IDLE_TIME) {
+            GMOS_TEST_CHECK (!pending);
+            longIdleCount += 1;
+        } else {
+            GMOS_TEST_CHECK (idleRunCount == 0);
+            if (pending) {
+                deferredCount += 1;
+            }
+        }
+    }
+
+    // Complete the test after the required number of steps.
+    if (testStepCount >= GMOS_TEST_STEP_COUNT) {
+        for (i = 0; i < GMOS_TEST_WORKER_COUNT; i++) {
+            GMOS_LOG_FMT (LOG_INFO, "Idle worker %d ran %ld times.",
+                i, (long) testWorkers [i].runCount);
+            GMOS_TEST_CHECK (testWorkers [i].runCount > 0);
+        }
+        GMOS_LOG_FMT (LOG_INFO,
+            "Idle periods: %ld long, %ld with deferred work.",
+            (long) longIdleCount, (long) deferredCount);
+        GMOS_TEST_CHECK ((longIdleCount > 0) && (deferredCount > 0));
+        gmosTestComplete ("sched-idle");
+        return GMOS_TASK_SUSPEND;
+    }
+    testStepCount += 1;
+
+    // Randomly request idle work.
+    for (i = 0; i < GMOS_TEST_WORKER_COUNT; i++) {
+        if (gmosTestRandom (4) == 0) {
+            gmosSchedulerIdleWorkerRequest (&(testWorkers [i].worker));
+            testWorkers [i].pending = true;
+        }
+    }
+
+    // Select a random delay either side of the minimum idle period.
+    delay = 1 + gmosTestRandom (2 * TEST_MIN_IDLE_TIME - 1);
+    lastRunTime = currentTime;
+    nextRunTime = currentTime + delay;
+    idleRunCount = 0;
+    return GMOS_TASK_RUN_LATER (delay);
+}
+
+/*
+ * Sets up the test application. Newly added idle workers are marked as
+ * having pending work.
+ */
+void gmosAppInit (void)
+{
+    uint8_t i;
+
+    for (i = 0; i < GMOS_TEST_WORKER_COUNT; i++) {
+        gmosSchedulerIdleWorkerAdd (&(testWorkers [i].worker),
+            testWorkerFn, &(testWorkers [i]));
+        testWorkers [i].runCount = 0;
+        testWorkers [i].pending = true;
+    }
+    lastRunTime = gmosPalGetTimer ();
+    nextRunTime = lastRunTime;
+    testTask.taskTickFn = testTaskFn;
+    testTask.taskData = NULL;
+    testTask.taskName = "Idle Worker Test";
+    gmosSchedulerTaskStart (&testTask);
+}
@@ -0,0 +1,286 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a test for the scheduler ready task priority levels. This
+ * checks that ready tasks are run in priority order and in FIFO order
+ * within each priority level, that the lowest priority tasks are run
+ * after the configured number of higher priority tasks when starvation
+ * protection applies, and that a high priority task which is resumed
+ * while a backlog of lower priority tasks is ready will be the next
+ * task to run.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-test.h"
+
+// Check for a suitable number of task priority levels.
+#if (GMOS_CONFIG_SCHEDULER_PRIORITY_LEVELS < 4)
+#error "The priority test requires at least four priority levels."
+#endif
+
+// Specify the test task identifiers.
+#define TEST_TASK_ID_ORDER   0
+#define TEST_TASK_ID_HIGH    6
+#define TEST_TASK_ID_LOW_A   7
+#define TEST_TASK_ID_LOW_B   8
+#define TEST_TASK_ID_URGENT  9
+#define TEST_TASK_ID_BUSY    10
+
+// Specify the test task counts.
+#define TEST_ORDER_TASK_COUNT 6
+#define TEST_BUSY_TASK_COUNT  16
+#define TEST_TASK_COUNT       (TEST_TASK_ID_BUSY + TEST_BUSY_TASK_COUNT)
+
+// Specify the number of runs for each task in the starvation test.
+#define TEST_HIGH_RUNS \
+    ((3 * GMOS_CONFIG_SCHEDULER_STARVATION_LIMIT) + 2)
+#define TEST_LOW_RUNS 8
+
+// Specify the number of runs for each task in the latency test and
+// the point at which the urgent task is resumed.
+#define TEST_BUSY_RUNS        20
+#define TEST_URGENT_TRIGGER   100
+
+// Specify the state of each test task.
+typedef struct testTask_t {
+    gmosTaskState_t task;
+    uint16_t runsLeft;
+    uint8_t taskId;
+} testTask_t;
+
+// Specify the priority levels for the task ordering test tasks.
+static const uint8_t orderTaskPriorities [TEST_ORDER_TASK_COUNT] = {
+    2, 0, 2, 1, 0, 1 };
+
+// Specify the expected execution order for the task ordering test.
+static const uint8_t orderTaskSequence [TEST_ORDER_TASK_COUNT] = {
+    1, 4, 3, 5, 0, 2 };
+
+// Allocate the test task state.
+static testTask_t testTasks [TEST_TASK_COUNT];
+static gmosTaskState_t controlTask;
+static uint8_t testPhase = 0;
+
+// Specify the task execution log.
+static uint8_t runLog [128];
+static uint8_t runLogSize = 0;
+
+// Specify the task execution sequence counters for the latency test.
+static uint32_t runSequence = 0;
+static uint32_t urgentResumeSequence = 0;
+static uint32_t urgentRunSequence = 0;
+
+/*
+ * Implements the common test task function. This logs each task run
+ * and then either requests immediate execution or suspends the task
+ * once the required number of runs have completed.
+ */
+static gmosTaskStatus_t testTaskFn (void* taskData)
+{
+    testTask_t* testTask = (testTask_t*) taskData;
+
+    // Ignore the initial task run on startup.
+    if (testTask->runsLeft == 0) {
+        return GMOS_TASK_SUSPEND;
+    }
+    testTask->runsLeft -= 1;
+    runSequence += 1;
+
+    // Log the task execution order for the ordering and starvation
+    // tests.
+    if (testTask->taskId < TEST_TASK_ID_URGENT) {
+        if (runLogSize < sizeof (runLog)) {
+            runLog [runLogSize++] = testTask->taskId;
+        }
+    }
+
+    // Record the latency test sequence numbers.
+    else if (testTask->taskId == TEST_TASK_ID_URGENT) {
+        urgentRunSequence = runSequence;
+    } else if (runSequence == TEST_URGENT_TRIGGER) {
+        testTasks [TEST_TASK_ID_URGENT].runsLeft = 1;
+        gmosSchedulerTaskResume (
+            &(testTasks [TEST_TASK_ID_URGENT].task));
+        urgentResumeSequence = runSequence;
+    }
+    return (testTask->runsLeft > 0) ?
+        GMOS_TASK_RUN_IMMEDIATE : GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Resumes a test task for the specified number of runs.
+ */
+static void testTaskResume (uint8_t taskId, uint16_t runCount)
+{
+    testTasks [taskId].runsLeft = runCount;
+    gmosSchedulerTaskResume (&(testTasks [taskId].task));
+}
+
+/*
+ * Checks the task execution order for the task ordering test. Ready
+ * tasks should be run in priority order, with tasks at the same
+ * priority level being run in the order in which they became ready.
+ */
+static void testCheckOrder (void)
+{
+    uint8_t i;
+
+    GMOS_TEST_CHECK (runLogSize == TEST_ORDER_TASK_COUNT);
+    for (i = 0; (i < runLogSize) && (i < TEST_ORDER_TASK_COUNT); i++) {
+        GMOS_TEST_CHECK (runLog [i] == orderTaskSequence [i]);
+    }
+}
+
+/*
+ * Checks the task execution order for the starvation test. While the
+ * high priority task is busy, each lowest priority task run should be
+ * preceded by the configured number of high priority task runs. The
+ * lowest priority tasks should alternate in FIFO order.
+ */
+static void testCheckStarvation (void)
+{
+    uint8_t expectedLowTask = TEST_TASK_ID_LOW_A;
+    uint32_t highRunCount = 0;
+    uint32_t highRunTotal = 0;
+    uint32_t lowRunTotal = 0;
+    uint8_t i;
+
+    for (i = 0; i < runLogSize; i++) {
+        if (runLog [i] == TEST_TASK_ID_HIGH) {
+            highRunCount += 1;
+            highRunTotal += 1;
+            continue;
+        }
+        GMOS_TEST_CHECK (runLog [i] == expectedLowTask);
+        if (highRunTotal < TEST_HIGH_RUNS) {
+            GMOS_TEST_CHECK (highRunCount ==
+                GMOS_CONFIG_SCHEDULER_STARVATION_LIMIT);
+        }
+        expectedLowTask = (expectedLowTask == TEST_TASK_ID_LOW_A) ?
+            TEST_TASK_ID_LOW_B : TEST_TASK_ID_LOW_A;
+        highRunCount = 0;
+        lowRunTotal += 1;
+    }
+    GMOS_TEST_CHECK (highRunTotal == TEST_HIGH_RUNS);
+    GMOS_TEST_CHECK (lowRunTotal == 2 * TEST_LOW_RUNS);
+}
+
+/*
+ * Implements the test control task. Each test phase readies a set of
+ * test tasks and then delays the control task. Since the test runs in
+ * virtual time, all the ready tasks will have run to completion before
+ * the control task runs again.
+ */
+static gmosTaskStatus_t testControlTaskFn (void* nullData)
+{
+    uint8_t i;
+
+    switch (testPhase) {
+
+        // Resume the task ordering test tasks in index order.
+        case 0 :
+            runLogSize = 0;
+            for (i = 0; i < TEST_ORDER_TASK_COUNT; i++) {
+                testTaskResume (TEST_TASK_ID_ORDER + i, 1);
+            }
+            break;
+
+        // Check the task ordering and then resume the starvation test
+        // tasks.
+        case 1 :
+            testCheckOrder ();
+            runLogSize = 0;
+            testTaskResume (TEST_TASK_ID_LOW_A, TEST_LOW_RUNS);
+            testTaskResume (TEST_TASK_ID_LOW_B, TEST_LOW_RUNS);
+            testTaskResume (TEST_TASK_ID_HIGH, TEST_HIGH_RUNS);
+            break;
+
+        // Check the starvation test results and then resume the
+        // latency test tasks.
+        case 2 :
+            testCheckStarvation ();
+            runSequence = 0;
+            for (i = 0; i < TEST_BUSY_TASK_COUNT; i++) {
+                testTaskResume (TEST_TASK_ID_BUSY + i, TEST_BUSY_RUNS);
+            }
+            break;
+
+        // Check that the urgent task ran immediately after being
+        // resumed.
+        default :
+            GMOS_TEST_CHECK (
+                urgentResumeSequence == TEST_URGENT_TRIGGER);
+            GMOS_TEST_CHECK (
+                urgentRunSequence == urgentResumeSequence + 1);
+            GMOS_TEST_CHECK (runSequence ==
+                (TEST_BUSY_TASK_COUNT * TEST_BUSY_RUNS) + 1);
+            gmosTestComplete ("sched-priority");
+            break;
+    }
+    testPhase += 1;
+    return GMOS_TASK_RUN_LATER (1);
+}
+
+/*
+ * Starts a test task and sets its priority level. The priority level
+ * will apply when the task is next resumed.
+ */
+static void testTaskStart (uint8_t taskId, uint8_t taskPriority)
+{
+    testTask_t* testTask = &(testTasks [taskId]);
+
+    testTask->task.taskTickFn = testTaskFn;
+    testTask->task.taskData = testTask;
+    testTask->task.taskName = "Test";
+    testTask->runsLeft = 0;
+    testTask->taskId = taskId;
+    gmosSchedulerTaskStart (&(testTask->task));
+    gmosSchedulerTaskSetPriority (&(testTask->task), taskPriority);
+}
+
+/*
+ * Sets up the test application.
+ */
+void gmosAppInit (void)
+{
+    uint8_t i;
+
+    for (i = 0; i < TEST_ORDER_TASK_COUNT; i++) {
+        testTaskStart (TEST_TASK_ID_ORDER + i, orderTaskPriorities [i]);
+    }
+    testTaskStart (TEST_TASK_ID_HIGH, GMOS_TASK_PRIORITY_HIGHEST);
+    testTaskStart (TEST_TASK_ID_LOW_A, GMOS_TASK_PRIORITY_LOWEST);
+    testTaskStart (TEST_TASK_ID_LOW_B, GMOS_TASK_PRIORITY_LOWEST);
+    testTaskStart (TEST_TASK_ID_URGENT, GMOS_TASK_PRIORITY_HIGHEST);
+    for (i = 0; i < TEST_BUSY_TASK_COUNT; i++) {
+        testTaskStart (TEST_TASK_ID_BUSY + i, 2);
+    }
+
+    // Start the control task, which will run after the initial test
+    // task runs on startup.
+    controlTask.taskTickFn = testControlTaskFn;
+    controlTask.taskData = NULL;
+    controlTask.taskName = "Control";
+    gmosSchedulerTaskStart (&controlTask);
+}
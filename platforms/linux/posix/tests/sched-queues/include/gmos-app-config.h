@@ -0,0 +1,57 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the scheduler task queue test application configuration
+ * options. The task queue implementation is selected using the test
+ * build variant compiler options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the test application.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Run the test in virtual time, starting shortly before the system
+ * timer wraps so that timestamp wraparound handling is exercised.
+ */
+#define GMOS_CONFIG_POSIX_VIRTUAL_TIME true
+#define GMOS_CONFIG_POSIX_SYSTEM_TIMER_OFFSET 0xFFFF0000
+
+/*
+ * Specify the number of worker tasks to run.
+ */
+#define GMOS_TEST_WORKER_COUNT 200
+
+/*
+ * Specify the test run time as an integer number of system timer
+ * ticks.
+ */
+#define GMOS_TEST_RUN_TIME 600000
+
+/*
+ * Specify the expected digest of the task execution sequence, which is
+ * the same for all the task queue implementations.
+ */
+#define GMOS_TEST_RUN_DIGEST 0x899157CA
+
+#endif // GMOS_APP_CONFIG_H
@@ -0,0 +1,197 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a virtual time test for the scheduled and background task
+ * queues. A set of worker tasks are rescheduled using a random mix of
+ * short and long delays, while a control task randomly resumes delayed
+ * and suspended workers. Each worker checks that it is run at exactly
+ * the expected time, or no earlier than the expected time for
+ * background tasks. The test is built for both the sorted list and
+ * timing wheel task queue implementations. All the implementations must
+ * run the tasks in the same order, so a digest of the task execution
+ * sequence is checked against a common reference value.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-test.h"
+
+// Specify the worker task scheduling modes.
+#define WORKER_MODE_SCHEDULED  0
+#define WORKER_MODE_BACKGROUND 1
+#define WORKER_MODE_SUSPENDED  2
+#define WORKER_MODE_RESUMED    3
+
+// Specify the state of each worker task.
+typedef struct testWorker_t {
+    gmosTaskState_t task;
+    uint32_t expectedTime;
+    uint32_t runCount;
+    uint8_t mode;
+} testWorker_t;
+
+// Allocate the worker and control task state.
+static testWorker_t workers [GMOS_TEST_WORKER_COUNT];
+static gmosTaskState_t controlTask;
+static uint32_t startTime;
+static uint32_t resumeCount = 0;
+static uint32_t runDigest = 0x811C9DC5;
+
+/*
+ * Adds a value to the task execution sequence digest, using the 32-bit
+ * FNV-1a hash algorithm.
+ */
+static void testUpdateDigest (uint32_t value)
+{
+    uint8_t i;
+
+    for (i = 0; i < 4; i++) {
+        runDigest = (runDigest ^ (value & 0xFF)) * 16777619;
+        value >>= 8;
+    }
+}
+
+/*
+ * Selects a random task delay. Most delays are short, but a proportion
+ * of long delays are used to exercise the higher timing wheel levels.
+ */
+static uint32_t testRandomDelay (void)
+{
+    uint32_t selector = gmosTestRandom (100);
+    if (selector < 60) {
+        return 1 + gmosTestRandom (64);
+    } else if (selector < 85) {
+        return 1 + gmosTestRandom (5000);
+    } else if (selector < 95) {
+        return 1 + gmosTestRandom (200000);
+    } else {
+        return 1 + gmosTestRandom (1 << 22);
+    }
+}
+
+/*
+ * Implements the worker task function. This checks the task execution
+ * time against the expected time and then reschedules the task.
+ */
+static gmosTaskStatus_t testWorkerTaskFn (void* taskData)
+{
+    testWorker_t* worker = (testWorker_t*) taskData;
+    uint32_t currentTime = gmosPalGetTimer ();
+    uint32_t selector;
+    uint32_t delay;
+
+    // Check the task execution time.
+    switch (worker->mode) {
+        case WORKER_MODE_SCHEDULED :
+        case WORKER_MODE_RESUMED :
+            GMOS_TEST_CHECK (currentTime == worker->expectedTime);
+            break;
+        case WORKER_MODE_BACKGROUND :
+            GMOS_TEST_CHECK (
+                (int32_t) (currentTime - worker->expectedTime) >= 0);
+            break;
+        default :
+            GMOS_TEST_CHECK (worker->mode != WORKER_MODE_SUSPENDED);
+            break;
+    }
+    worker->runCount += 1;
+    testUpdateDigest ((uint32_t) (worker - workers));
+    testUpdateDigest (currentTime);
+
+    // Select the next scheduling mode.
+    selector = gmosTestRandom (100);
+    delay = testRandomDelay ();
+    worker->expectedTime = currentTime + delay;
+    if (selector < 80) {
+        worker->mode = WORKER_MODE_SCHEDULED;
+        return GMOS_TASK_RUN_LATER (delay);
+    } else if (selector < 95) {
+        worker->mode = WORKER_MODE_BACKGROUND;
+        return GMOS_TASK_RUN_AFTER (delay);
+    } else {
+        worker->mode = WORKER_MODE_SUSPENDED;
+        return GMOS_TASK_SUSPEND;
+    }
+}
+
+/*
+ * Implements the control task function. This randomly resumes worker
+ * tasks, which removes them from the task queues if they are currently
+ * delayed. It also checks for test completion.
+ */
+static gmosTaskStatus_t testControlTaskFn (void* nullData)
+{
+    uint32_t currentTime = gmosPalGetTimer ();
+    uint32_t totalRuns = 0;
+    uint32_t i;
+
+    // Resume a random selection of worker tasks. These will run
+    // immediately, without any virtual time elapsing.
+    for (i = 0; i < 4; i++) {
+        testWorker_t* worker =
+            &(workers [gmosTestRandom (GMOS_TEST_WORKER_COUNT)]);
+        worker->expectedTime = currentTime;
+        worker->mode = WORKER_MODE_RESUMED;
+        gmosSchedulerTaskResume (&(worker->task));
+        resumeCount += 1;
+    }
+
+    // Check for test completion.
+    if (currentTime - startTime < GMOS_TEST_RUN_TIME) {
+        return GMOS_TASK_RUN_LATER (1 + gmosTestRandom (16));
+    }
+    for (i = 0; i < GMOS_TEST_WORKER_COUNT; i++) {
+        totalRuns += workers [i].runCount;
+    }
+    GMOS_LOG_FMT (LOG_INFO,
+        "Ran %ld worker tasks, %ld resumed, digest 0x%08lX.",
+        (long) totalRuns, (long) resumeCount, (unsigned long) runDigest);
+    GMOS_TEST_CHECK (totalRuns > GMOS_TEST_RUN_TIME);
+    GMOS_TEST_CHECK (runDigest == GMOS_TEST_RUN_DIGEST);
+    gmosTestComplete ("sched-queues");
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Sets up the test application.
+ */
+void gmosAppInit (void)
+{
+    uint32_t i;
+
+    startTime = gmosPalGetTimer ();
+    for (i = 0; i < GMOS_TEST_WORKER_COUNT; i++) {
+        testWorker_t* worker = &(workers [i]);
+        worker->task.taskTickFn = testWorkerTaskFn;
+        worker->task.taskData = worker;
+        worker->task.taskName = "Worker";
+        worker->expectedTime = startTime;
+        worker->runCount = 0;
+        worker->mode = WORKER_MODE_RESUMED;
+        gmosSchedulerTaskStart (&(worker->task));
+    }
+    controlTask.taskTickFn = testControlTaskFn;
+    controlTask.taskData = NULL;
+    controlTask.taskName = "Control";
+    gmosSchedulerTaskStart (&controlTask);
+}
@@ -0,0 +1,52 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Specifies the scheduler timer slack test application configuration
+ * options. The task queue implementation is selected using the test
+ * build variant compiler options.
+ */
+
+#ifndef GMOS_APP_CONFIG_H
+#define GMOS_APP_CONFIG_H
+
+/*
+ * Set the debug console log level to use for the test application.
+ */
+#define GMOS_CONFIG_LOG_LEVEL LOG_INFO
+
+/*
+ * Run the test in virtual time, so that the system timer only advances
+ * when the scheduler requests an idle period.
+ */
+#define GMOS_CONFIG_POSIX_VIRTUAL_TIME true
+
+/*
+ * Specify the scheduler timer slack as an integer number of system
+ * timer ticks.
+ */
+#define GMOS_CONFIG_SCHEDULER_TIMER_SLACK 10
+
+/*
+ * Specify the number of periodic tasks and the simulated run time for
+ * the randomised part of the test.
+ */
+#define GMOS_TEST_PERIODIC_TASK_COUNT 24
+#define GMOS_TEST_RUN_TIME 3600000
+
+#endif // GMOS_APP_CONFIG_H
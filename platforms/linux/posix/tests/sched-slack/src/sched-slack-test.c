@@ -0,0 +1,274 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a virtual time test for scheduler wakeup coalescing using
+ * the timer slack. Scheduler wakeups are counted using a lifecycle
+ * monitor, since each virtual time idle period issues a power save
+ * notification. The first part of the test checks that a set of tasks
+ * which are due within the slack window are all run after a single
+ * wakeup, and that a task with no other deadlines in its slack window
+ * is run on time. The second part runs a randomised set of periodic
+ * tasks for one simulated hour, checking that scheduled tasks are never
+ * run early or more than the slack period late.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-test.h"
+
+// Check for the expected timer slack setting.
+#if (GMOS_CONFIG_SCHEDULER_TIMER_SLACK != 10)
+#error "The timer slack test requires a timer slack of 10 ticks."
+#endif
+
+// Specify the number of one-shot tasks used for the coalescing test.
+#define TEST_ONE_SHOT_TASK_COUNT 5
+
+// Specify the one-shot task states.
+#define ONE_SHOT_STATE_IDLE    0
+#define ONE_SHOT_STATE_ARMED   1
+#define ONE_SHOT_STATE_WAITING 2
+
+// Specify the state of each one-shot task.
+typedef struct testOneShot_t {
+    gmosTaskState_t task;
+    uint32_t delay;
+    uint32_t runTime;
+    bool background;
+    uint8_t state;
+} testOneShot_t;
+
+// Specify the state of each periodic task.
+typedef struct testPeriodic_t {
+    gmosTaskState_t task;
+    uint32_t period;
+    uint32_t dueTime;
+    bool background;
+} testPeriodic_t;
+
+// Specify the one-shot task delays and whether they are run as
+// background tasks. The first four tasks are due within the slack
+// window following the first deadline, but the last one is not. The
+// delays are short enough for the timing wheel to hold the exact task
+// timestamps.
+static const uint16_t oneShotDelays [TEST_ONE_SHOT_TASK_COUNT] = {
+    4, 6, 9, 12, 25 };
+static const bool oneShotBackground [TEST_ONE_SHOT_TASK_COUNT] = {
+    false, false, false, true, false };
+
+// Specify the expected one-shot task run times. The first group of
+// tasks are run at the latest scheduled deadline in the slack window,
+// and the last task is not delayed.
+static const uint16_t oneShotRunTimes [TEST_ONE_SHOT_TASK_COUNT] = {
+    9, 9, 9, 9, 25 };
+
+// Allocate the test task state.
+static testOneShot_t oneShotTasks [TEST_ONE_SHOT_TASK_COUNT];
+static testPeriodic_t periodicTasks [GMOS_TEST_PERIODIC_TASK_COUNT];
+static gmosTaskState_t controlTask;
+static uint8_t testPhase = 0;
+static uint32_t testStartTime;
+static uint32_t testStartWakeups;
+
+// Specify the wakeup counter and scheduled task run counter.
+static gmosLifecycleMonitor_t lifecycleMonitor;
+static uint32_t wakeupCount = 0;
+static uint32_t scheduledRunCount = 0;
+
+/*
+ * Counts the number of scheduler wakeups from the idle state.
+ */
+static bool testLifecycleHandler (gmosLifecycleStatus_t lifecycleStatus)
+{
+    if (lifecycleStatus == SCHEDULER_ENTER_POWER_SAVE) {
+        wakeupCount += 1;
+    }
+    return true;
+}
+
+/*
+ * Implements the one-shot task function. When armed, the task is
+ * rescheduled using its configured delay and the following task run
+ * time is recorded.
+ */
+static gmosTaskStatus_t testOneShotTaskFn (void* taskData)
+{
+    testOneShot_t* oneShot = (testOneShot_t*) taskData;
+
+    if (oneShot->state == ONE_SHOT_STATE_ARMED) {
+        oneShot->state = ONE_SHOT_STATE_WAITING;
+        return oneShot->background ?
+            GMOS_TASK_RUN_AFTER (oneShot->delay) :
+            GMOS_TASK_RUN_LATER (oneShot->delay);
+    } else if (oneShot->state == ONE_SHOT_STATE_WAITING) {
+        oneShot->state = ONE_SHOT_STATE_IDLE;
+        oneShot->runTime = gmosPalGetTimer ();
+    }
+    return GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Implements the periodic task function. This checks the task run
+ * time against the due time and then reschedules the task with a
+ * random amount of jitter.
+ */
+static gmosTaskStatus_t testPeriodicTaskFn (void* taskData)
+{
+    testPeriodic_t* periodic = (testPeriodic_t*) taskData;
+    int32_t lateness = (int32_t)
+        (gmosPalGetTimer () - periodic->dueTime);
+    uint32_t delay;
+
+    // Scheduled tasks may be run up to the slack period late, and
+    // background tasks may be run up to the slack period early.
+    if (periodic->background) {
+        GMOS_TEST_CHECK (
+            lateness >= -GMOS_CONFIG_SCHEDULER_TIMER_SLACK);
+    } else {
+        GMOS_TEST_CHECK ((lateness >= 0) &&
+            (lateness <= GMOS_CONFIG_SCHEDULER_TIMER_SLACK));
+        scheduledRunCount += 1;
+    }
+
+    // Reschedule the task with up to 20 ticks of jitter.
+    delay = periodic->period + gmosTestRandom (20);
+    periodic->dueTime = gmosPalGetTimer () + delay;
+    return periodic->background ?
+        GMOS_TASK_RUN_AFTER (delay) : GMOS_TASK_RUN_LATER (delay);
+}
+
+/*
+ * Arms the one-shot tasks for the coalescing test.
+ */
+static void testOneShotStart (void)
+{
+    uint8_t i;
+
+    for (i = 0; i < TEST_ONE_SHOT_TASK_COUNT; i++) {
+        testOneShot_t* oneShot = &(oneShotTasks [i]);
+        oneShot->delay = oneShotDelays [i];
+        oneShot->background = oneShotBackground [i];
+        oneShot->state = ONE_SHOT_STATE_ARMED;
+        gmosSchedulerTaskResume (&(oneShot->task));
+    }
+}
+
+/*
+ * Checks the one-shot task run times and the number of wakeups for the
+ * coalescing test. The expected wakeups are for the first group of
+ * tasks, the last one-shot task and the control task.
+ */
+static void testOneShotCheck (void)
+{
+    uint8_t i;
+
+    for (i = 0; i < TEST_ONE_SHOT_TASK_COUNT; i++) {
+        testOneShot_t* oneShot = &(oneShotTasks [i]);
+        GMOS_TEST_CHECK (oneShot->state == ONE_SHOT_STATE_IDLE);
+        GMOS_TEST_CHECK (oneShot->runTime - testStartTime ==
+            oneShotRunTimes [i]);
+    }
+    GMOS_TEST_CHECK (wakeupCount - testStartWakeups == 3);
+}
+
+/*
+ * Starts the periodic tasks for the randomised test. One in four tasks
+ * are run as background tasks.
+ */
+static void testPeriodicStart (void)
+{
+    uint8_t i;
+
+    for (i = 0; i < GMOS_TEST_PERIODIC_TASK_COUNT; i++) {
+        testPeriodic_t* periodic = &(periodicTasks [i]);
+        periodic->task.taskTickFn = testPeriodicTaskFn;
+        periodic->task.taskData = periodic;
+        periodic->task.taskName = "Periodic";
+        periodic->period = 100 + gmosTestRandom (1900);
+        periodic->dueTime = gmosPalGetTimer ();
+        periodic->background = ((i & 3) == 3) ? true : false;
+        gmosSchedulerTaskStart (&(periodic->task));
+    }
+}
+
+/*
+ * Implements the test control task.
+ */
+static gmosTaskStatus_t testControlTaskFn (void* nullData)
+{
+    uint32_t wakeups;
+
+    switch (testPhase) {
+
+        // Arm the one-shot tasks for the coalescing test.
+        case 0 :
+            testStartTime = gmosPalGetTimer ();
+            testStartWakeups = wakeupCount;
+            testOneShotStart ();
+            testPhase = 1;
+            return GMOS_TASK_RUN_LATER (1000);
+
+        // Check the coalescing test results and start the randomised
+        // test.
+        case 1 :
+            testOneShotCheck ();
+            testStartWakeups = wakeupCount;
+            scheduledRunCount = 0;
+            testPeriodicStart ();
+            testPhase = 2;
+            return GMOS_TASK_RUN_LATER (GMOS_TEST_RUN_TIME);
+
+        // Check that scheduled tasks were coalesced during the
+        // randomised test.
+        default :
+            wakeups = wakeupCount - testStartWakeups;
+            GMOS_LOG_FMT (LOG_INFO,
+                "Ran %ld scheduled tasks using %ld wakeups.",
+                (long) scheduledRunCount, (long) wakeups);
+            GMOS_TEST_CHECK (wakeups < scheduledRunCount);
+            gmosTestComplete ("sched-slack");
+            return GMOS_TASK_SUSPEND;
+    }
+}
+
+/*
+ * Sets up the test application.
+ */
+void gmosAppInit (void)
+{
+    uint8_t i;
+
+    gmosLifecycleAddMonitor (&lifecycleMonitor, testLifecycleHandler);
+    for (i = 0; i < TEST_ONE_SHOT_TASK_COUNT; i++) {
+        testOneShot_t* oneShot = &(oneShotTasks [i]);
+        oneShot->task.taskTickFn = testOneShotTaskFn;
+        oneShot->task.taskData = oneShot;
+        oneShot->task.taskName = "One-Shot";
+        oneShot->state = ONE_SHOT_STATE_IDLE;
+        gmosSchedulerTaskStart (&(oneShot->task));
+    }
+    controlTask.taskTickFn = testControlTaskFn;
+    controlTask.taskData = NULL;
+    controlTask.taskName = "Control";
+    gmosSchedulerTaskStart (&controlTask);
+}
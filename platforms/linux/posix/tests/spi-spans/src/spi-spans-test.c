@@ -0,0 +1,368 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a test for chained SPI buffer span transfers, using a
+ * fake SPI platform abstraction layer. The fake PAL completes each
+ * transfer from a separate hardware emulation task, which stands in
+ * for the transfer completion interrupt. Randomly sized buffers with
+ * random offsets are written to and read from an emulated SPI device
+ * using chained transactions, with transfer errors being injected at
+ * random points in some of the chains. The test checks that the chip
+ * select remains asserted for the entire chain, that all the buffer
+ * data is transferred in order and that the client task is only
+ * notified once for each chained transaction.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-buffers.h"
+#include "gmos-driver-gpio.h"
+#include "gmos-driver-spi.h"
+#include "gmos-test.h"
+
+// Specify the maximum size of the test buffers.
+#define TEST_BUFFER_MAX_SIZE 1200
+
+// Specify the maximum number of buffer spans in a transaction.
+#define TEST_SPAN_MAX_COUNT 32
+
+// Specify the chip select pin used by the emulated SPI device.
+#define TEST_CHIP_SELECT_PIN 0x0101
+
+// Defines the fake SPI PAL bus state.
+struct gmosPalSpiBusState_t {
+    bool transferPending;
+    uint8_t transferCount;
+    uint8_t errorTransfer;
+};
+
+// Defines the fake SPI PAL bus configuration.
+struct gmosPalSpiBusConfig_t {
+    uint8_t unused;
+};
+
+// Allocate the fake SPI PAL state.
+static gmosPalSpiBusState_t palData;
+static const gmosPalSpiBusConfig_t palConfig = { 0 };
+static gmosDriverSpiBus_t spiBus =
+    GMOS_DRIVER_SPI_PAL_CONFIG (&palData, &palConfig);
+static gmosDriverSpiDevice_t spiDevice;
+static bool chipSelectActive = false;
+
+// Allocate the emulated SPI device state.
+static uint8_t deviceData [TEST_BUFFER_MAX_SIZE];
+static uint16_t deviceOffset;
+
+// Allocate the test task state.
+static gmosTaskState_t clientTask;
+static gmosTaskState_t hardwareTask;
+
+// Allocate the test buffers and transaction state.
+static gmosBuffer_t testBuffer = GMOS_BUFFER_INIT ();
+static gmosBuffer_t copyBuffer = GMOS_BUFFER_INIT ();
+static gmosBufferSpan_t testSpans [TEST_SPAN_MAX_COUNT];
+static uint8_t refData [TEST_BUFFER_MAX_SIZE];
+static uint8_t readData [TEST_BUFFER_MAX_SIZE];
+static uint16_t transferOffset;
+static uint16_t transferSize;
+static uint8_t spanCount;
+static bool transferWrite;
+static bool transferActive = false;
+static uint32_t roundCount = 0;
+static uint32_t errorCount = 0;
+
+/*
+ * Implements the fake GPIO pin initialisation for the chip select.
+ */
+bool gmosDriverGpioPinInit (uint16_t gpioPinId, bool openDrain,
+    uint8_t driveStrength, int8_t biasResistor)
+{
+    return (gpioPinId == TEST_CHIP_SELECT_PIN) ? true : false;
+}
+
+/*
+ * Implements the fake GPIO output setup for the chip select.
+ */
+bool gmosDriverGpioSetAsOutput (uint16_t gpioPinId)
+{
+    return (gpioPinId == TEST_CHIP_SELECT_PIN) ? true : false;
+}
+
+/*
+ * Implements the fake GPIO output update for the active low chip
+ * select.
+ */
+void gmosDriverGpioSetPinState (uint16_t gpioPinId, bool pinState)
+{
+    GMOS_TEST_CHECK (gpioPinId == TEST_CHIP_SELECT_PIN);
+    chipSelectActive = !pinState;
+}
+
+/*
+ * Implements the fake SPI PAL initialisation.
+ */
+bool gmosDriverSpiPalInit (gmosDriverSpiBus_t* spiInterface)
+{
+    spiInterface->palData->transferPending = false;
+    return true;
+}
+
+/*
+ * Implements the fake SPI PAL clock setup.
+ */
+void gmosDriverSpiPalClockSetup (gmosDriverSpiBus_t* spiInterface)
+{
+    // No action required.
+}
+
+/*
+ * Implements the fake SPI PAL transaction request. The transfer is
+ * completed by the hardware emulation task.
+ */
+void gmosDriverSpiPalTransaction (gmosDriverSpiBus_t* spiInterface)
+{
+    gmosPalSpiBusState_t* palState = spiInterface->palData;
+
+    GMOS_TEST_CHECK (chipSelectActive);
+    GMOS_TEST_CHECK (!palState->transferPending);
+    palState->transferPending = true;
+    gmosSchedulerTaskResume (&hardwareTask);
+}
+
+/*
+ * Implements the fake SPI PAL inline transaction, which is not used.
+ */
+gmosDriverSpiStatus_t gmosDriverSpiPalInlineTransaction
+    (gmosDriverSpiBus_t* spiInterface)
+{
+    return GMOS_DRIVER_SPI_STATUS_DRIVER_ERROR;
+}
+
+/*
+ * Implements the hardware emulation task. This transfers the data for
+ * a pending SPI transfer and then signals completion, as would
+ * normally be done by the transfer completion interrupt.
+ */
+static gmosTaskStatus_t hardwareTaskFn (void* nullData)
+{
+    gmosPalSpiBusState_t* palState = spiBus.palData;
+    uint32_t eventFlags;
+    uint16_t size = spiBus.transferSize;
+
+    if (!palState->transferPending) {
+        return GMOS_TASK_SUSPEND;
+    }
+    palState->transferPending = false;
+    palState->transferCount += 1;
+
+    // Inject a transfer error if required.
+    if (palState->transferCount == palState->errorTransfer) {
+        gmosDriverSpiIoNotifyComplete (&spiBus,
+            GMOS_DRIVER_SPI_EVENT_COMPLETION_FLAG |
+            GMOS_DRIVER_SPI_STATUS_DMA_ERROR);
+    }
+
+    // Transfer the data to or from the emulated device.
+    else {
+        GMOS_TEST_CHECK (deviceOffset + size <= TEST_BUFFER_MAX_SIZE);
+        if (spiBus.writeData != NULL) {
+            memcpy (&(deviceData [deviceOffset]), spiBus.writeData, size);
+        } else {
+            memcpy (spiBus.readData, &(deviceData [deviceOffset]), size);
+        }
+        deviceOffset += size;
+        eventFlags = size;
+        eventFlags <<= GMOS_DRIVER_SPI_EVENT_SIZE_OFFSET;
+        eventFlags |= GMOS_DRIVER_SPI_EVENT_COMPLETION_FLAG |
+            GMOS_DRIVER_SPI_STATUS_SUCCESS;
+        gmosDriverSpiIoNotifyComplete (&spiBus, eventFlags);
+    }
+
+    // Run again immediately if the next transfer in a chained
+    // transaction has been started.
+    return palState->transferPending ?
+        GMOS_TASK_RUN_IMMEDIATE : GMOS_TASK_SUSPEND;
+}
+
+/*
+ * Fills a data array with random byte values.
+ */
+static void testRandomFill (uint8_t* data, uint16_t size)
+{
+    uint16_t i;
+
+    for (i = 0; i < size; i++) {
+        data [i] = (uint8_t) gmosTestRandom (256);
+    }
+}
+
+/*
+ * Sets up the test buffer with random contents and then starts a
+ * chained SPI write or read transaction for a random section of the
+ * buffer. A random amount of data is prepended to the buffer so that
+ * the buffer data does not start on a segment boundary.
+ */
+static bool testStartTransaction (void)
+{
+    uint16_t bufferSize = 1 + gmosTestRandom (TEST_BUFFER_MAX_SIZE);
+    uint16_t prependSize = gmosTestRandom (bufferSize);
+
+    // Set up the test buffer, which may share data segments with a
+    // copy of the buffer.
+    testRandomFill (refData, bufferSize);
+    GMOS_TEST_CHECK (gmosBufferReset (&testBuffer, 0));
+    GMOS_TEST_CHECK (gmosBufferAppend (&testBuffer,
+        &(refData [prependSize]), bufferSize - prependSize));
+    GMOS_TEST_CHECK (gmosBufferPrepend (&testBuffer,
+        refData, prependSize));
+    transferWrite = (gmosTestRandom (2) == 0) ? true : false;
+    if (transferWrite && (gmosTestRandom (2) == 0)) {
+        GMOS_TEST_CHECK (gmosBufferCopy (&testBuffer, &copyBuffer));
+    }
+
+    // Select a random section of the buffer for the transfer.
+    transferOffset = gmosTestRandom (bufferSize);
+    transferSize = 1 + gmosTestRandom (bufferSize - transferOffset);
+    spanCount = gmosBufferGetSpans (&testBuffer, transferOffset,
+        transferSize, testSpans, TEST_SPAN_MAX_COUNT);
+    GMOS_TEST_CHECK (spanCount > 0);
+
+    // Set up the emulated device and the transfer error injection.
+    deviceOffset = 0;
+    if (!transferWrite) {
+        testRandomFill (deviceData, transferSize);
+    }
+    palData.transferCount = 0;
+    palData.errorTransfer = (gmosTestRandom (8) == 0) ?
+        (uint8_t) (1 + gmosTestRandom (spanCount)) : 0;
+
+    // Start the chained transaction.
+    GMOS_TEST_CHECK (gmosDriverSpiDeviceSelect (&spiBus, &spiDevice));
+    if (transferWrite) {
+        return gmosDriverSpiIoWriteSpans (&spiBus, testSpans, spanCount);
+    } else {
+        return gmosDriverSpiIoReadSpans (&spiBus, testSpans, spanCount);
+    }
+}
+
+/*
+ * Checks the results of a completed chained SPI transaction.
+ */
+static void testCheckTransaction (
+    gmosDriverSpiStatus_t spiStatus, uint16_t completedSize)
+{
+    uint16_t expectedSize = 0;
+    uint8_t i;
+
+    // Determine the expected transfer size, which only includes the
+    // buffer spans that were transferred before any injected error.
+    for (i = 0; i < spanCount; i++) {
+        if (i + 1 == palData.errorTransfer) {
+            break;
+        }
+        expectedSize += testSpans [i].size;
+    }
+    GMOS_TEST_CHECK (completedSize == expectedSize);
+    GMOS_TEST_CHECK (deviceOffset == expectedSize);
+    if (palData.errorTransfer != 0) {
+        GMOS_TEST_CHECK (spiStatus == GMOS_DRIVER_SPI_STATUS_DMA_ERROR);
+        GMOS_TEST_CHECK (palData.transferCount == palData.errorTransfer);
+        errorCount += 1;
+    } else {
+        GMOS_TEST_CHECK (spiStatus == GMOS_DRIVER_SPI_STATUS_SUCCESS);
+        GMOS_TEST_CHECK (palData.transferCount == spanCount);
+        GMOS_TEST_CHECK (expectedSize == transferSize);
+    }
+
+    // Check the transferred data. The buffer contents outside the
+    // transferred section must be unchanged.
+    if (transferWrite) {
+        GMOS_TEST_CHECK (memcmp (deviceData,
+            &(refData [transferOffset]), completedSize) == 0);
+    } else {
+        memcpy (&(refData [transferOffset]), deviceData, completedSize);
+    }
+    GMOS_TEST_CHECK (gmosBufferRead (&testBuffer, 0,
+        readData, gmosBufferGetSize (&testBuffer)));
+    GMOS_TEST_CHECK (memcmp (readData, refData,
+        gmosBufferGetSize (&testBuffer)) == 0);
+    gmosBufferReset (&copyBuffer, 0);
+}
+
+/*
+ * Implements the client task function. This is the consumer task for
+ * the SPI device completion event, so it is only run when a chained
+ * transaction has completed.
+ */
+static gmosTaskStatus_t clientTaskFn (void* nullData)
+{
+    gmosDriverSpiStatus_t spiStatus;
+    uint16_t completedSize = 0;
+
+    // Start the next chained transaction.
+    if (!transferActive) {
+        GMOS_TEST_CHECK (testStartTransaction ());
+        transferActive = true;
+        return GMOS_TASK_SUSPEND;
+    }
+
+    // The transaction must have completed when the client task runs.
+    spiStatus = gmosDriverSpiIoComplete (&spiBus, &completedSize);
+    GMOS_TEST_CHECK (spiStatus != GMOS_DRIVER_SPI_STATUS_ACTIVE);
+    GMOS_TEST_CHECK (chipSelectActive);
+    testCheckTransaction (spiStatus, completedSize);
+    GMOS_TEST_CHECK (gmosDriverSpiDeviceRelease (&spiBus, &spiDevice));
+    GMOS_TEST_CHECK (!chipSelectActive);
+    transferActive = false;
+
+    // Check for test completion.
+    roundCount += 1;
+    if (roundCount == GMOS_TEST_ROUND_COUNT) {
+        GMOS_LOG_FMT (LOG_INFO,
+            "Ran %ld chained transactions, %ld with errors.",
+            (long) roundCount, (long) errorCount);
+        GMOS_TEST_CHECK (errorCount > 0);
+        gmosTestComplete ("spi-spans");
+    }
+    return GMOS_TASK_RUN_IMMEDIATE;
+}
+
+/*
+ * Sets up the test application.
+ */
+void gmosAppInit (void)
+{
+    GMOS_TEST_CHECK (gmosDriverSpiBusInit (&spiBus));
+    GMOS_TEST_CHECK (gmosDriverSpiDeviceInit (&spiDevice, &clientTask,
+        TEST_CHIP_SELECT_PIN, GMOS_DRIVER_SPI_CHIP_SELECT_OPTION_ACTIVE_LOW,
+        1000, GMOS_DRIVER_SPI_CLOCK_MODE_0));
+    hardwareTask.taskTickFn = hardwareTaskFn;
+    hardwareTask.taskData = NULL;
+    hardwareTask.taskName = "SPI Hardware";
+    gmosSchedulerTaskStart (&hardwareTask);
+    clientTask.taskTickFn = clientTaskFn;
+    clientTask.taskData = NULL;
+    clientTask.taskName = "SPI Client";
+    gmosSchedulerTaskStart (&clientTask);
+}
@@ -0,0 +1,101 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements the common support functions that are used by the host
+ * test and benchmark applications for the POSIX platform.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "gmos-config.h"
+#include "gmos-platform.h"
+#include "gmos-test.h"
+
+// Specify the number of test condition checks that have failed.
+static volatile uint32_t testFailureCount = 0;
+
+// Specify the state of the deterministic pseudo-random number
+// generator.
+static uint32_t testRandomState = 0x5EED5EED;
+
+/*
+ * Implements the test condition check.
+ */
+bool gmosTestCheck (bool condition, const char* fileName,
+    uint32_t lineNo, const char* conditionText)
+{
+    if (!condition) {
+        __atomic_add_fetch (&testFailureCount, 1, __ATOMIC_RELAXED);
+        GMOS_LOG_FMT (LOG_ERROR, "Check failed at %s:%ld : %s",
+            fileName, (long) lineNo, conditionText);
+    }
+    return condition;
+}
+
+/*
+ * Gets the number of test condition checks that have failed so far.
+ */
+uint32_t gmosTestGetFailureCount (void)
+{
+    return __atomic_load_n (&testFailureCount, __ATOMIC_RELAXED);
+}
+
+/*
+ * Generates the next value from the deterministic pseudo-random number
+ * sequence, using a 32-bit xorshift generator.
+ */
+uint32_t gmosTestRandom (uint32_t range)
+{
+    uint32_t x = testRandomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    testRandomState = x;
+    return x % range;
+}
+
+/*
+ * Reads the host monotonic clock.
+ */
+uint64_t gmosTestGetHostNanos (void)
+{
+    struct timespec timeSpec;
+    clock_gettime (CLOCK_MONOTONIC, &timeSpec);
+    return (((uint64_t) timeSpec.tv_sec) * 1000000000) +
+        (uint64_t) timeSpec.tv_nsec;
+}
+
+/*
+ * Completes the test run, logging the test result and then exiting the
+ * host process.
+ */
+void gmosTestComplete (const char* testName)
+{
+    uint32_t failureCount = gmosTestGetFailureCount ();
+    if (failureCount == 0) {
+        GMOS_LOG_FMT (LOG_INFO, "Test %s : PASSED.", testName);
+        gmosPalExit (0);
+    } else {
+        GMOS_LOG_FMT (LOG_ERROR, "Test %s : FAILED (%ld failures).",
+            testName, (long) failureCount);
+        gmosPalExit (1);
+    }
+}
@@ -0,0 +1,196 @@
+/*
+ * The Gubbins Microcontroller Operating System
+ *
+ * Copyright 2026 Zynaptic Limited
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+ * implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/*
+ * Implements a randomised test for the callback timers. A control task
+ * randomly starts, restarts and stops a set of one-shot and periodic
+ * timers, and the timer callbacks randomly restart or stop their own
+ * timers. A shadow copy of the expected timer state is used to check
+ * that each timer callback runs at exactly the expected time, that
+ * stopped timers never run and that the running state and stop status
+ * values are reported correctly. The test runs in virtual time.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "gmos-app-config.h"
+#include "gmos-platform.h"
+#include "gmos-scheduler.h"
+#include "gmos-timers.h"
+#include "gmos-test.h"
+
+// Specify the maximum one-shot timer delay and periodic timer period.
+#define TEST_MAX_DELAY 200
+#define TEST_MAX_PERIOD 100
+
+// Defines the test state for a single timer.
+typedef struct testTimer_t {
+    gmosTimer_t timer;
+    uint32_t expiryTime;
+    uint32_t period;
+    bool running;
+} testTimer_t;
+
+// Allocate the test timers and control task state.
+static testTimer_t testTimers [GMOS_TEST_TIMER_COUNT];
+static gmosTaskState_t testTask;
+static uint32_t testEndTime;
+static bool testStopping = false;
+
+// Count the various timer operations.
+static uint32_t oneShotCount = 0;
+static uint32_t periodicCount = 0;
+static uint32_t restartCount = 0;
+static uint32_t stopCount = 0;
+
+/*
+ * Starts a test timer as a random one-shot or periodic timer.
+ */
+static void testTimerStart (testTimer_t* testTimer)
+{
+    uint32_t currentTime = gmosPalGetTimer ();
+
+    if (gmosTestRandom (2) == 0) {
+        testTimer->period = 0;
+        testTimer->expiryTime = currentTime +
+            gmosTestRandom (TEST_MAX_DELAY + 1);
+        gmosTimerStart (&(testTimer->timer),
+            testTimer->expiryTime - currentTime);
+    } else {
+        testTimer->period = 1 + gmosTestRandom (TEST_MAX_PERIOD);
+        testTimer->expiryTime = currentTime + testTimer->period;
+        gmosTimerStartPeriodic (&(testTimer->timer), testTimer->period);
+    }
+    testTimer->running = true;
+}
+
+/*
+ * Stops a test timer, checking the returned running status.
+ */
+static void testTimerStop (testTimer_t* testTimer)
+{
+    GMOS_TEST_CHECK (
+        gmosTimerStop (&(testTimer->timer)) == testTimer->running);
+    GMOS_TEST_CHECK (!gmosTimerIsRunning (&(testTimer->timer)));
+    testTimer->running = false;
+}
+
+/*
+ * Implements the timer callback function, which checks the expiry
+ * time and then randomly restarts or stops the timer.
+ */
+static void testTimerFn (void* timerData)
+{
+    testTimer_t* testTimer = (testTimer_t*) timerData;
+    uint32_t currentTime = gmosPalGetTimer ();
+
+    // Check the expiry time and running state.
+    if (!GMOS_TEST_CHECK (testTimer->running) ||
+        !GMOS_TEST_CHECK (testTimer->expiryTime == currentTime)) {
+        gmosTestComplete ("timers");
+    }
+    if (testTimer->period == 0) {
+        GMOS_TEST_CHECK (!gmosTimerIsRunning (&(testTimer->timer)));
+        testTimer->running = false;
+        oneShotCount += 1;
+    } else {
+        GMOS_TEST_CHECK (gmosTimerIsRunning (&(testTimer->timer)));
+        testTimer->expiryTime += testTimer->period;
+        periodicCount += 1;
+    }
+
+    // Randomly restart or stop the timer from the callback.
+    if (testStopping) {
+        return;
+    }
+    switch (gmosTestRandom (8)) {
+        case 0 :
+        case 1 :
+            testTimerStart (testTimer);
+            restartCount += 1;
+            break;
+        case 2 :
+            testTimerStop (testTimer);
+            stopCount += 1;
+            break;
+    }
+}
+
+/*
+ * Implements the control task, which randomly starts, restarts and
+ * stops the test timers.
+ */
+static gmosTaskStatus_t testTaskFn (void* nullData)
+{
+    testTimer_t* testTimer;
+    uint8_t i;
+
+    // Check that no timers run after they have all been stopped.
+    if (testStopping) {
+        GMOS_LOG_FMT (LOG_INFO,
+            "Timer callbacks: %ld one-shot, %ld periodic.",
+            (long) oneShotCount, (long) periodicCount);
+        GMOS_LOG_FMT (LOG_INFO,
+            "Callback actions: %ld restarts, %ld stops.",
+            (long) restartCount, (long) stopCount);
+        GMOS_TEST_CHECK ((oneShotCount > 0) && (periodicCount > 0));
+        GMOS_TEST_CHECK ((restartCount > 0) && (stopCount > 0));
+        gmosTestComplete ("timers");
+        return GMOS_TASK_SUSPEND;
+    }
+
+    // Stop all the timers at the end of the test run.
+    if (((int32_t) (gmosPalGetTimer () - testEndTime)) >= 0) {
+        for (i = 0; i < GMOS_TEST_TIMER_COUNT; i++) {
+            testTimerStop (&(testTimers [i]));
+        }
+        testStopping = true;
+        return GMOS_TASK_RUN_LATER (2 * TEST_MAX_DELAY);
+    }
+
+    // Randomly start, restart or stop a timer.
+    testTimer = &(testTimers [gmosTestRandom (GMOS_TEST_TIMER_COUNT)]);
+    if (gmosTestRandom (4) == 0) {
+        testTimerStop (testTimer);
+    } else {
+        testTimerStart (testTimer);
+    }
+    return GMOS_TASK_RUN_LATER (gmosTestRandom (50));
+}
+
+/*
+ * Sets up the test application.
+ */
+void gmosAppInit (void)
+{
+    uint8_t i;
+
+    for (i = 0; i < GMOS_TEST_TIMER_COUNT; i++) {
+        gmosTimerInit (&(testTimers [i].timer),
+            testTimerFn, &(testTimers [i]));
+        testTimers [i].running = false;
+        GMOS_TEST_CHECK (!gmosTimerIsRunning (&(testTimers [i].timer)));
+    }
+    testEndTime = gmosPalGetTimer () + GMOS_TEST_RUN_TIME;
+    testTask.taskTickFn = testTaskFn;
+    testTask.taskData = NULL;
+    testTask.taskName = "Timer Test";
+    gmosSchedulerTaskStart (&testTask);
+}
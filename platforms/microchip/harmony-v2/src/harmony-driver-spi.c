@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2021 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -58,7 +58,6 @@ static void harmonyTransferCompleteHandler (DRV_SPI_BUFFER_EVENT status,
     DRV_SPI_BUFFER_HANDLE bufferHandle, void* context)
 {
     gmosDriverSpiBus_t* spiInterface = (gmosDriverSpiBus_t*) context;
-    gmosDriverSpiDevice_t* spiDevice = spiInterface->device;
     uint32_t eventFlags = 0;
 
     // Indicate successful completion.
@@ -75,9 +74,10 @@ static void harmonyTransferCompleteHandler (DRV_SPI_BUFFER_EVENT status,
             GMOS_DRIVER_SPI_STATUS_DRIVER_ERROR;
     }
 
-    // Trigger the GMOS event if required.
+    // Signal completion if required. This may start the next transfer
+    // in a chained transaction.
     if (eventFlags != 0) {
-        gmosEventAssignBits (&spiDevice->completionEvent, eventFlags);
+        gmosDriverSpiIoNotifyComplete (spiInterface, eventFlags);
     }
 }
 
@@ -180,7 +180,6 @@ void gmosDriverSpiPalClockSetup (gmosDriverSpiBus_t* spiInterface)
 void gmosDriverSpiPalTransaction (gmosDriverSpiBus_t* spiInterface)
 {
     gmosPalSpiBusState_t* spiState = spiInterface->palData;
-    gmosDriverSpiDevice_t* spiDevice = spiInterface->device;
     DRV_SPI_BUFFER_HANDLE drvBuffer;
 
     // Initiate a Harmony framework transfer request.
@@ -194,7 +193,7 @@ void gmosDriverSpiPalTransaction (gmosDriverSpiBus_t* spiInterface)
 
     // On failure, notify status via the GMOS event.
     else {
-        gmosEventAssignBits (&spiDevice->completionEvent,
+        gmosDriverSpiIoNotifyComplete (spiInterface,
             GMOS_DRIVER_SPI_EVENT_COMPLETION_FLAG |
             GMOS_DRIVER_SPI_STATUS_DRIVER_ERROR);
     }
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -93,6 +93,19 @@
 #define GMOS_CONFIG_SPI_GPIO_DRIVE_STRENGTH PICO_GPIO_DRIVER_SLEW_FAST_4MA
 #endif
 
+/*
+ * The RP2040 has two processor cores, which may each run a separate
+ * GubbinsMOS scheduler. The current core index is read directly from
+ * the SIO CPUID register, which avoids including the SDK headers here.
+ */
+#if defined (GMOS_CONFIG_SCHEDULER_CORES) && \
+    (GMOS_CONFIG_SCHEDULER_CORES > 1)
+#if (GMOS_CONFIG_SCHEDULER_CORES > 2)
+#error "The RP2040 only supports up to two scheduler cores."
+#endif
+#define GMOS_PAL_CORE_ID (*((volatile uint32_t*) 0xD0000000))
+#endif
+
 /*
  * The Raspberry Pi SDK includes fast memcpy implementations that will
  * be used for stream and buffer data transfers.
@@ -108,6 +121,12 @@
  */
 #define GMOS_CONFIG_SYSTEM_TIMER_FREQUENCY ((1000000 + 512) / 1024)
 
+/*
+ * The Pico SDK 1MHz system timer is used as the platform cycle counter.
+ */
+#define GMOS_CONFIG_PAL_CYCLE_COUNTER true
+#define GMOS_CONFIG_PAL_CYCLE_COUNTER_FREQUENCY 1000000
+
 /*
  * Converts the specified number of milliseconds to the closest number
  * of system timer ticks (rounding down). Defining the macro here will
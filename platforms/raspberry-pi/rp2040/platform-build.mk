@@ -1,7 +1,7 @@
 #
 # The Gubbins Microcontroller Operating System
 #
-# Copyright 2022 Zynaptic Limited
+# Copyright 2022-2026 Zynaptic Limited
 #
 # Licensed under the Apache License, Version 2.0 (the "License");
 # you may not use this file except in compliance with the License.
@@ -42,6 +42,7 @@ PLATFORM_HEADER_DIRS = \
 	${GMOS_PICO_SDK_DIR}/src/rp2_common/pico_bootrom/include \
 	${GMOS_PICO_SDK_DIR}/src/rp2_common/pico_platform/include \
 	${GMOS_PICO_SDK_DIR}/src/rp2_common/pico_printf/include \
+	${GMOS_PICO_SDK_DIR}/src/rp2_common/pico_multicore/include \
 	${GMOS_PICO_SDK_DIR}/src/rp2_common/hardware_base/include \
 	${GMOS_PICO_SDK_DIR}/src/rp2_common/hardware_clocks/include \
 	${GMOS_PICO_SDK_DIR}/src/rp2_common/hardware_irq/include \
@@ -79,6 +80,7 @@ PLATFORM_OBJ_FILE_NAMES = \
 	pico_bootrom/bootrom.o \
 	pico_platform/platform.o \
 	pico_printf/printf.o \
+	pico_multicore/multicore.o \
 	pico_runtime/runtime.o \
 	pico_divider/divider.o \
 	pico_sync/mutex.o \
@@ -140,6 +142,7 @@ ${LOCAL_DIR} :
 	mkdir -p $@/pico_bootrom
 	mkdir -p $@/pico_platform
 	mkdir -p $@/pico_printf
+	mkdir -p $@/pico_multicore
 	mkdir -p $@/pico_runtime
 	mkdir -p $@/pico_divider
 	mkdir -p $@/pico_sync
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022-2023 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,6 +29,7 @@
 #include "pico-device.h"
 #include "pico-driver-gpio.h"
 #include "pico/critical_section.h"
+#include "pico/platform.h"
 #include "pico/printf.h"
 #include "hardware/timer.h"
 
@@ -36,9 +37,12 @@
 static const char* logLevelNames [] = {
     "VERBOSE", "DEBUG  ", "INFO   ", "WARNING", "ERROR  ", "FAILURE" };
 
-// Implement the platform mutex lock counter.
+// Implement the platform mutex lock counter. The mutex is recursive for
+// the processor core that currently owns it, with the owner core ID
+// being set to -1 when the mutex is not held.
 static critical_section_t mutexLockData;
 static uint32_t mutexLockCount = 0;
+static volatile int32_t mutexOwnerCore = -1;
 
 /*
  * Initialises the platform abstraction layer on startup.
@@ -58,12 +62,21 @@ void gmosPalInit (void)
 }
 
 /*
- * Claims the main platform mutex lock.
+ * Claims the main platform mutex lock. The underlying critical section
+ * is not recursive, so it is only entered if the mutex is not already
+ * held by the current core. Interrupts are disabled on the owning core
+ * while the mutex is held, so the owner core ID can only match if the
+ * mutex was claimed from the current execution context.
  */
 void gmosPalMutexLock (void)
 {
+    int32_t coreId = (int32_t) get_core_num ();
+
     // Ensure interrupts are disabled before modifying the lock count.
-    critical_section_enter_blocking (&mutexLockData);
+    if (mutexOwnerCore != coreId) {
+        critical_section_enter_blocking (&mutexLockData);
+        mutexOwnerCore = coreId;
+    }
     mutexLockCount += 1;
 }
 
@@ -75,6 +88,7 @@ void gmosPalMutexUnlock (void)
     // Decrement the lock count and enable interrupts if required.
     mutexLockCount -= 1;
     if (mutexLockCount == 0) {
+        mutexOwnerCore = -1;
         critical_section_exit (&mutexLockData);
     }
 }
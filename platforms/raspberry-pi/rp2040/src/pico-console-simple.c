@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,6 +26,7 @@
 #include <stddef.h>
 
 #include "gmos-config.h"
+#include "gmos-platform.h"
 #include "gmos-scheduler.h"
 #include "gmos-streams.h"
 #include "gmos-driver-gpio.h"
@@ -54,9 +55,21 @@ static inline gmosTaskStatus_t gmosPalSerialConsoleTaskHandler (void* nullData)
         return GMOS_TASK_SUSPEND;
     }
 
-    // Write as much data as will fit into the UART buffers.
+    // Write as much data as will fit into the UART buffers. The
+    // console stream is shared by both cores if they are both running
+    // the scheduler, so access is protected by the platform mutex. This
+    // is recursive, so the stream may also claim it for memory pool
+    // segment allocation.
     while (uart_is_writable (debugUart)) {
-        if (gmosStreamReadByte (&consoleStream, &txByte)) {
+        bool byteRead;
+        if (GMOS_CONFIG_SCHEDULER_CORES > 1) {
+            gmosPalMutexLock ();
+        }
+        byteRead = gmosStreamReadByte (&consoleStream, &txByte);
+        if (GMOS_CONFIG_SCHEDULER_CORES > 1) {
+            gmosPalMutexUnlock ();
+        }
+        if (byteRead) {
             uart_putc_raw (debugUart, txByte);
         } else {
             return GMOS_TASK_SUSPEND;
@@ -108,5 +121,17 @@ void gmosPalSerialConsoleInit (void)
  */
 bool gmosPalSerialConsoleWrite (uint8_t* writeData, uint16_t writeSize)
 {
-    return gmosStreamWriteAll (&consoleStream, writeData, writeSize);
+    bool writeOk;
+
+    // Protect the shared console stream if both cores are running the
+    // scheduler. The platform mutex is recursive, so the memory pool
+    // may also claim it when allocating stream buffer segments.
+    if (GMOS_CONFIG_SCHEDULER_CORES > 1) {
+        gmosPalMutexLock ();
+    }
+    writeOk = gmosStreamWriteAll (&consoleStream, writeData, writeSize);
+    if (GMOS_CONFIG_SCHEDULER_CORES > 1) {
+        gmosPalMutexUnlock ();
+    }
+    return writeOk;
 }
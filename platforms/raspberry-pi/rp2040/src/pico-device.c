@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,7 +27,9 @@
 #include "gmos-platform.h"
 #include "gmos-mempool.h"
 #include "gmos-scheduler.h"
+#include "gmos-instance.h"
 #include "pico-device.h"
+#include "pico/multicore.h"
 #include "hardware/irq.h"
 #include "hardware/dma.h"
 
@@ -38,14 +40,35 @@ static uint16_t enabledDmaIsrs1 = 0;
 // Store pointers to the attached DMA interrupt service routines.
 static gmosPalDmaIsr_t attachedDmaIsrs [12];
 
+// Allocate the GubbinsMOS instance for each core when both cores are
+// used to run the scheduler.
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+static gmosInstance_t coreInstances [2];
+#endif
+
+/*
+ * Provides the entry point for core 1, which runs an independent
+ * scheduler loop using its own GubbinsMOS instance.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+static void gmosPalCore1Main (void)
+{
+    gmosInstanceCoreStart (&(coreInstances [1]));
+}
+#endif
+
 /*
  * The device setup and scheduler loop are all implemented from the
  * main application entry point.
  */
 int main(void)
 {
-    // Initialise the common platform components.
+    // Initialise the common platform components. When both cores are
+    // used, this also sets up the core 0 instance.
     gmosMempoolInit ();
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+    gmosInstanceInit (&(coreInstances [0]), NULL);
+#endif
 
     // Initialise the platform abstraction layer.
     gmosPalInit ();
@@ -53,6 +76,11 @@ int main(void)
     // Initialise the application code.
     gmosAppInit ();
 
+    // Start the scheduler on core 1 if required.
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+    multicore_launch_core1 (gmosPalCore1Main);
+#endif
+
     // Enter the scheduler loop. This is implemented in the 'main'
     // function to avoid adding an extra stack frame.
     gmosLifecycleNotify (SCHEDULER_STARTUP);
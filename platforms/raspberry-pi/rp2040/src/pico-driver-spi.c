@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -55,21 +55,19 @@ static uint8_t gmosDriverSpiPalIsrCommon
 {
     gmosPalSpiBusState_t* palData = spiInterface->palData;
     uint8_t dmaRxChannel = palData->dmaRxChannel;
-    gmosEvent_t* completionEvent;
     uint32_t eventFlags;
 
+    // Disable the receive channel interrupt. This must be done before
+    // signalling completion, since the next transfer in a chained
+    // transaction will enable it again.
+    gmosPalDmaIsrSetEnabled (dmaRxChannel, false);
+
     // Always indicate successful completion.
     eventFlags = spiInterface->transferSize;
     eventFlags <<= GMOS_DRIVER_SPI_EVENT_SIZE_OFFSET;
     eventFlags |= GMOS_DRIVER_SPI_EVENT_COMPLETION_FLAG |
         GMOS_DRIVER_SPI_STATUS_SUCCESS;
-
-    // Set the GubbinsMOS event flags.
-    completionEvent = &(spiInterface->device->completionEvent);
-    gmosEventSetBits (completionEvent, eventFlags);
-
-    // Disable the receive channel interrupt.
-    gmosPalDmaIsrSetEnabled (dmaRxChannel, false);
+    gmosDriverSpiIoNotifyComplete (spiInterface, eventFlags);
 
     // Clear all interrupts, regardless of status.
     return true;
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 
 #include <stdint.h>
 
+#include "gmos-platform.h"
 #include "hardware/timer.h"
 
 /*
@@ -36,6 +37,15 @@ uint32_t gmosPalGetTimer (void)
     return (uint32_t) (usTime / 1024);
 }
 
+/*
+ * Reads the low order bits of the Pico SDK 1MHz timer value for use as
+ * the platform cycle counter.
+ */
+uint32_t gmosPalGetCycleCount (void)
+{
+    return time_us_32 ();
+}
+
 /*
  * Requests that the platform abstraction layer enter idle mode for
  * the specified number of platform timer ticks. This currently returns
@@ -55,3 +65,15 @@ void gmosPalWake (void)
 {
     return;
 }
+
+/*
+ * Requests that the platform abstraction layer wakes the specified
+ * core from idle mode. This currently has no effect, since both cores
+ * perform busy waiting.
+ */
+#if (GMOS_CONFIG_SCHEDULER_CORES > 1)
+void gmosPalCoreWake (uint8_t coreId)
+{
+    return;
+}
+#endif
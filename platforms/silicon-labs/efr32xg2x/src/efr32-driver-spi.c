@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2023 Zynaptic Limited
+ * Copyright 2023-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -92,7 +92,6 @@ static void gmosDriverSpiPalCompletionHandler (
     int transferCount)
 {
     gmosDriverSpiBus_t* spiInterface;
-    gmosEvent_t* completionEvent;
     uint32_t spiStatus;
     uint32_t eventFlags;
     uint32_t i;
@@ -115,9 +114,9 @@ static void gmosDriverSpiPalCompletionHandler (
     eventFlags <<= GMOS_DRIVER_SPI_EVENT_SIZE_OFFSET;
     eventFlags |= GMOS_DRIVER_SPI_EVENT_COMPLETION_FLAG | spiStatus;
 
-    // Set the GubbinsMOS event flags.
-    completionEvent = &(spiInterface->device->completionEvent);
-    gmosEventSetBits (completionEvent, eventFlags);
+    // Signal completion, which may start the next transfer in a
+    // chained transaction.
+    gmosDriverSpiIoNotifyComplete (spiInterface, eventFlags);
 }
 
 /*
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2022 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -72,7 +72,6 @@ static uint8_t gmosDriverSpiPalIsrCommon
     SPI_TypeDef* spiRegs = spiRegisterMap [spiIndex];
     DMA_Channel_TypeDef* dmaTxRegs = dmaTxRegisterMap [spiIndex];
     DMA_Channel_TypeDef* dmaRxRegs = dmaRxRegisterMap [spiIndex];
-    gmosEvent_t* completionEvent;
     uint32_t eventFlags = 0;
 
     // Check for error condition. Note that all flags are shifted into
@@ -108,9 +107,9 @@ static uint8_t gmosDriverSpiPalIsrCommon
         spiRegs->CR1 &= ~SPI_CR1_SPE;
         spiRegs->CR2 &= ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
 
-        // Set the GubbinsMOS event flags.
-        completionEvent = &(spiInterface->device->completionEvent);
-        gmosEventSetBits (completionEvent, eventFlags);
+        // Signal completion, which may start the next transfer in a
+        // chained transaction.
+        gmosDriverSpiIoNotifyComplete (spiInterface, eventFlags);
     }
 
     // Clear all interrupts, regardless of status.
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2022 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -180,4 +180,9 @@
 #define GMOS_CONFIG_STM32_APB2_CLOCK \
     (GMOS_CONFIG_STM32_AHB_CLOCK / GMOS_CONFIG_STM32_APB2_CLOCK_DIV)
 
+// The Cortex-M3 DWT cycle counter is used as the platform cycle
+// counter, which runs at the AHB bus clock frequency.
+#define GMOS_CONFIG_PAL_CYCLE_COUNTER true
+#define GMOS_CONFIG_PAL_CYCLE_COUNTER_FREQUENCY GMOS_CONFIG_STM32_AHB_CLOCK
+
 #endif // GMOS_PAL_CONFIG_H
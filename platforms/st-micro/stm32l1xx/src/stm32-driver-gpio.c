@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2022 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,6 +26,7 @@
 #include <stddef.h>
 
 #include "gmos-driver-gpio.h"
+#include "gmos-trace.h"
 #include "stm32-driver-gpio.h"
 #include "stm32-device.h"
 
@@ -389,7 +390,8 @@ void gmosDriverGpioInterruptDisable (uint16_t gpioPinId)
 
 /*
  * Implements common GPIO ISR processing for GPIO lines in the specified
- * index range.
+ * index range. Each pin specific ISR is recorded in the timeline trace,
+ * using the GPIO line index as the trace record value.
  */
 static void gmosDriverGpioCommonIsr (uint8_t indexStart, uint8_t indexEnd)
 {
@@ -407,7 +409,9 @@ static void gmosDriverGpioCommonIsr (uint8_t indexStart, uint8_t indexEnd)
             pendingIsr = gpioIsrMap [i];
             pendingIsrData = gpioIsrDataMap [i];
             if (pendingIsr != NULL) {
+                GMOS_TRACE (GMOS_TRACE_ISR_ENTER, pendingIsrData, i);
                 pendingIsr (pendingIsrData);
+                GMOS_TRACE (GMOS_TRACE_ISR_EXIT, pendingIsrData, i);
             }
             EXTI->PR = activeFlag;
         }
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2020-2022 Zynaptic Limited
+ * Copyright 2020-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -52,6 +52,12 @@ void gmosPalSystemTimerInit (void)
     // to its maximum value.
     TIM11->CNT = 0xFFFF;
     TIM11->CR1 |= TIM_CR1_CEN | TIM_CR1_URS;
+
+    // Enable the DWT cycle counter for use as the platform cycle
+    // counter.
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 }
 
 /*
@@ -135,6 +141,14 @@ uint32_t gmosPalGetTimer (void)
     return counterValue;
 }
 
+/*
+ * Reads the current value of the DWT cycle counter.
+ */
+uint32_t gmosPalGetCycleCount (void)
+{
+    return DWT->CYCCNT;
+}
+
 /*
  * Requests that the platform abstraction layer enter idle mode for
  * the specified number of platform timer ticks.
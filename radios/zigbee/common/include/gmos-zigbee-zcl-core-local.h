@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2024-2025 Zynaptic Limited
+ * Copyright 2024-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -49,6 +49,10 @@ typedef struct gmosZigbeeZclEndpointLocal_t {
     // This is the response message buffer for the current command.
     gmosBuffer_t responseBuffer;
 
+    // This is the request payload buffer cursor, which is used to
+    // parse the request payload fields in order.
+    gmosBufferCursor_t requestCursor;
+
     // This is the currently active cluster for the endpoint.
     gmosZigbeeZclCluster_t* cluster;
 
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2024-2025 Zynaptic Limited
+ * Copyright 2024-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -781,6 +781,24 @@ gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataSize (
     gmosBuffer_t* dataBuffer, uint16_t dataItemOffset,
     uint8_t* dataSize);
 
+/**
+ * Determines the number of octets used to represent a ZCL serialized
+ * data value at the current position of a data buffer cursor. This
+ * avoids walking the buffer segment list from the start of the buffer
+ * when parsing a sequence of data items. The cursor position is not
+ * changed.
+ * @param itemCursor This is the data buffer cursor that refers to the
+ *     start of the serialized ZCL data item. This consists of a data
+ *     type byte followed by a variable number of data value octets.
+ * @param dataSize This is a pointer to the data size variable that will
+ *     be updated with the size of the data value. This does not include
+ *     the leading data type byte.
+ * @return Returns a ZCL status code which indicates successful
+ *     completion or the reason for failure.
+ */
+gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataSizeAtCursor (
+    gmosBufferCursor_t* itemCursor, uint8_t* dataSize);
+
 /**
  * Parses a complete attribute data record from a buffer, as included
  * in read attribute response messages and attribute reporting messages.
@@ -814,6 +832,40 @@ gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataRecord (
     gmosZigbeeZclDataRecord_t* dataRecord, uint8_t* octetArray,
     uint8_t octetArraySize, uint8_t* recordSize);
 
+/**
+ * Parses a complete attribute data record at the current position of a
+ * data buffer cursor. This avoids walking the buffer segment list from
+ * the start of the buffer when parsing a sequence of records. The
+ * cursor position is not changed, so the caller should advance the
+ * cursor using the parsed record size.
+ * @param recordCursor This is the data buffer cursor that refers to the
+ *     start of the serialized ZCL attribute record. This consists of an
+ *     attribute identifier, followed by optional ZCL status value, data
+ *     type and value fields.
+ * @param checkStatus This is a boolean flag, which when set to 'true'
+ *     checks the status field included in read attribute response
+ *     records. If set to 'false', the status field is skipped, as
+ *     required for attribute reporting records.
+ * @param dataRecord This is a pointer to the data record structure that
+ *     will be updated with the parsed data record parameters.
+ * @param octetArray This is a pointer to an octet array that will be
+ *     used to store variable length strings if required. A null
+ *     reference may be used if the record is known to have a fixed
+ *     format data type.
+ * @param octetArraySize This is the length of the data buffer that may
+ *     be used to store variable length strings.
+ * @param recordSize This is a pointer to the record size variable that
+ *     will be updated with the size of parsed data record. A null
+ *     reference may be used if this information is not required.
+ * @return Returns the ZCL status code which indicates successful
+ *     completion, the status value included in the data record or the
+ *     reason for failure.
+ */
+gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataRecordAtCursor (
+    gmosBufferCursor_t* recordCursor, bool checkStatus,
+    gmosZigbeeZclDataRecord_t* dataRecord, uint8_t* octetArray,
+    uint8_t octetArraySize, uint8_t* recordSize);
+
 /**
  * Parses attribute data from a buffer, updating the locally stored
  * attribute value. The data is only parsed if the data type at the
@@ -840,6 +892,28 @@ gmosZigbeeZclStatusCode_t gmosZigbeeZclParseAttrData (
     gmosZigbeeZclAttr_t* zclAttr, gmosBuffer_t* dataBuffer,
     uint16_t dataItemOffset, bool commitWrite);
 
+/**
+ * Parses attribute data at the current position of a data buffer
+ * cursor, updating the locally stored attribute value. The data is
+ * only parsed if the data type at the cursor position matches the data
+ * type specified in the attribute data structure. The cursor position
+ * is not changed.
+ * @param zclAttr This is the ZCL cluster attribute which will be
+ *     updated with the parsed data value.
+ * @param itemCursor This is the data buffer cursor that refers to the
+ *     start of the serialized ZCL data item. This consists of a data
+ *     type byte followed by a variable number of data value octets.
+ * @param commitWrite This is a boolean flag which when set to 'true'
+ *     causes the attribute value to be updated. If this is set to
+ *     'false', the write operation will be checked for validity, but
+ *     the attribute value will not be updated.
+ * @return Returns a ZCL status code which indicates successful
+ *     completion or the reason for failure.
+ */
+gmosZigbeeZclStatusCode_t gmosZigbeeZclParseAttrDataAtCursor (
+    gmosZigbeeZclAttr_t* zclAttr, gmosBufferCursor_t* itemCursor,
+    bool commitWrite);
+
 /**
  * Serializes the attribute data, appending it to the provided data
  * buffer. The serialized data consists of the data type field followed
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022-2025 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,6 +28,7 @@
 #include <stdbool.h>
 #include "gmos-buffers.h"
 #include "gmos-scheduler.h"
+#include "gmos-timers.h"
 #include "gmos-zigbee-config.h"
 #include "gmos-zigbee-stack.h"
 #include "gmos-zigbee-aps.h"
@@ -69,8 +70,8 @@ typedef struct gmosZigbeeZdoClient_t {
     // with the ZDO client.
     gmosZigbeeStack_t* zigbeeStack;
 
-    // This holds the ZDO client handler timeout task state.
-    gmosTaskState_t timeoutTask;
+    // This holds the ZDO client transaction timeout timer state.
+    gmosTimer_t timeoutTimer;
 
     // This is the array of ZDO transaction result callback handlers.
     gmosZigbeeZdoClientResultHandler_t
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2024-2025 Zynaptic Limited
+ * Copyright 2024-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -195,11 +195,13 @@ static gmosZigbeeZclStatusCode_t gmosZigbeeZclLocalReadAttrsRun (
     }
 
     // Set up the first attribute read transaction. Select the starting
-    // index for the request buffer and the starting offset for the
-    // response buffer.
+    // index and cursor position for the request buffer and the
+    // starting offset for the response buffer.
     zclLocal->state = GMOS_ZIGBEE_ZCL_LOCAL_STATE_READ_ATTR_REQ;
     zclLocal->count = 0;
     zclLocal->offset = gmosBufferGetSize (responseBuffer);
+    gmosBufferCursorInit (&(zclLocal->requestCursor),
+        &(zclLocal->requestBuffer), 0);
     commandStatus = GMOS_ZIGBEE_ZCL_STATUS_SUCCESS;
 
     // Return command execution status.
@@ -248,10 +250,11 @@ static gmosZigbeeZclStatusCode_t gmosZigbeeZclLocalWriteAttrsRun (
         zclLocal->state = GMOS_ZIGBEE_ZCL_LOCAL_STATE_WRITE_ATTR_REQ;
     }
 
-    // Select the starting offset for the request buffer and the
-    // starting index for the response buffer.
+    // Select the starting cursor position for the request buffer and
+    // the starting index for the response buffer.
     zclLocal->count = 0;
-    zclLocal->offset = 0;
+    gmosBufferCursorInit (&(zclLocal->requestCursor),
+        &(zclLocal->requestBuffer), 0);
     commandStatus = GMOS_ZIGBEE_ZCL_STATUS_SUCCESS;
 
     // Return command execution status.
@@ -294,8 +297,9 @@ static inline gmosTaskStatus_t gmosZigbeeZclLocalReadAttrReq (
     }
     zclLocal->offset = responseSize;
 
-    // Get the requested attribute instance.
-    gmosBufferRead (requestBuffer, attrIndex * 2, attrData, 2);
+    // Get the requested attribute instance. The attribute identifiers
+    // are read in order using the request buffer cursor.
+    gmosBufferCursorRead (&(zclLocal->requestCursor), attrData, 2);
     attrId = (uint_fast16_t) attrData [0];
     attrId |= ((uint_fast16_t) attrData [1]) << 8;
     zclAttr = gmosZigbeeZclGetAttrInstance (
@@ -362,9 +366,11 @@ static inline gmosTaskStatus_t gmosZigbeeZclLocalWriteAttrReq (
     gmosZigbeeZclAttr_t* zclAttr;
     gmosBuffer_t* requestBuffer = &(zclLocal->requestBuffer);
     gmosBuffer_t* responseBuffer = &(zclLocal->responseBuffer);
+    gmosBufferCursor_t* requestCursor = &(zclLocal->requestCursor);
+    gmosBufferCursor_t itemCursor;
     uint8_t attrData [3];
     uint8_t attrSize;
-    uint_fast8_t attrOffset;
+    uint_fast16_t attrOffset;
     uint_fast16_t attrId;
     uint_fast8_t attrType;
     uint_fast8_t attrStatus;
@@ -389,7 +395,7 @@ static inline gmosTaskStatus_t gmosZigbeeZclLocalWriteAttrReq (
     // Check to see if the end of the attribute list has been reached.
     // No check is carried out on the response message size, since it
     // will always be smaller than the request message.
-    attrOffset = zclLocal->offset;
+    attrOffset = gmosBufferCursorGetOffset (requestCursor);
     requestSize = gmosBufferGetSize (requestBuffer);
     GMOS_LOG_FMT (LOG_VERBOSE,
         "Running write attr request (attr offset %d, request size %d).",
@@ -403,8 +409,12 @@ static inline gmosTaskStatus_t gmosZigbeeZclLocalWriteAttrReq (
         return GMOS_TASK_RUN_IMMEDIATE;
     }
 
-    // Get the requested attribute instance and expected type.
-    gmosBufferRead (requestBuffer, attrOffset, attrData, 3);
+    // Get the requested attribute instance and expected type. The
+    // item cursor refers to the attribute data item, starting with the
+    // data type byte.
+    gmosBufferCursorPeek (requestCursor, attrData, 3);
+    itemCursor = *requestCursor;
+    gmosBufferCursorSkip (&itemCursor, 2);
     attrId = (uint_fast16_t) attrData [0];
     attrId |= ((uint_fast16_t) attrData [1]) << 8;
     attrType = attrData [2];
@@ -414,17 +424,21 @@ static inline gmosTaskStatus_t gmosZigbeeZclLocalWriteAttrReq (
     // Look up the size of the attribute data, as encoded in the write
     // request. If this can not be determined, the current field is
     // taken to contain invalid data.
-    attrStatus = gmosZigbeeZclParseDataSize (
-        requestBuffer, attrOffset + 2, &attrSize);
+    attrStatus = gmosZigbeeZclParseDataSizeAtCursor (
+        &itemCursor, &attrSize);
     if (attrStatus != GMOS_ZIGBEE_ZCL_STATUS_SUCCESS) {
         validFieldSize = false;
     }
 
     // Handle requests where the request field can be parsed, but the
-    // write transaction can not be executed.
+    // write transaction can not be executed. The request cursor is
+    // advanced to the next request field, or to the end of the request
+    // if the current field is truncated.
     else {
         validFieldSize = true;
-        zclLocal->offset += 3 + attrSize;
+        if (!gmosBufferCursorSkip (requestCursor, 3 + attrSize)) {
+            gmosBufferCursorSeek (requestCursor, requestSize);
+        }
         if (zclAttr == NULL) {
             attrStatus = GMOS_ZIGBEE_ZCL_STATUS_UNSUP_ATTRIBUTE;
         } else if (zclAttr->attrType != attrType) {
@@ -440,8 +454,8 @@ static inline gmosTaskStatus_t gmosZigbeeZclLocalWriteAttrReq (
     if (attrStatus == GMOS_ZIGBEE_ZCL_STATUS_SUCCESS) {
         if ((zclAttr->attrOptions &
             GMOS_ZIGBEE_ZCL_ATTR_OPTION_DYNAMIC_ACCESS) == 0) {
-            attrStatus = gmosZigbeeZclParseAttrData (
-                zclAttr, requestBuffer, attrOffset + 2, commitWrite);
+            attrStatus = gmosZigbeeZclParseAttrDataAtCursor (
+                zclAttr, &itemCursor, commitWrite);
         }
     }
 
@@ -510,7 +524,7 @@ static inline void gmosZigbeeZclLocalCheckAttrsComplete (
     // checks. If is is zero, a full attribute write cycle can be
     // initiated.
     if (zclLocal->count == 0) {
-        zclLocal->offset = 0;
+        gmosBufferCursorSeek (&(zclLocal->requestCursor), 0);
         zclLocal->state = GMOS_ZIGBEE_ZCL_LOCAL_STATE_WRITE_ATTR_REQ;
     }
 
@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2024-2025 Zynaptic Limited
+ * Copyright 2024-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -619,30 +619,30 @@ gmosZigbeeZclAttr_t* gmosZigbeeZclGetAttrInstance (
 
 /*
  * Determines the number of octets used to represent a ZCL serialized
- * data value.
+ * data value at the current data buffer cursor position. A local copy
+ * of the cursor is used, so the cursor position is not changed.
  */
-gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataSize (
-    gmosBuffer_t* dataBuffer, uint16_t dataItemOffset,
-    uint8_t* dataSize)
+gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataSizeAtCursor (
+    gmosBufferCursor_t* itemCursor, uint8_t* dataSize)
 {
+    gmosBufferCursor_t dataCursor;
     uint8_t dataType;
     uint8_t stringSize;
     uint_fast8_t fixedDataSize;
     gmosZigbeeZclStatusCode_t status = GMOS_ZIGBEE_ZCL_STATUS_SUCCESS;
 
     // Extract the data type byte from the data buffer.
-    if (!gmosBufferRead (dataBuffer, dataItemOffset, &dataType, 1)) {
+    dataCursor = *itemCursor;
+    if (!gmosBufferCursorReadU8 (&dataCursor, &dataType)) {
         status = GMOS_ZIGBEE_ZCL_STATUS_ABORT;
     }
 
     // Process variable length string data types.
     else if ((dataType == GMOS_ZIGBEE_ZCL_DATA_TYPE_OCTET_STRING) ||
         (dataType == GMOS_ZIGBEE_ZCL_DATA_TYPE_CHAR_STRING)) {
-        if (!gmosBufferRead (
-            dataBuffer, dataItemOffset + 1, &stringSize, 1)) {
+        if (!gmosBufferCursorReadU8 (&dataCursor, &stringSize)) {
             status = GMOS_ZIGBEE_ZCL_STATUS_ABORT;
-        }
-        if (stringSize < 0xFF) {
+        } else if (stringSize < 0xFF) {
             *dataSize = stringSize + 1;
         } else {
             *dataSize = 1;
@@ -664,19 +664,38 @@ gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataSize (
 }
 
 /*
- * Parses a complete attribute data record from a buffer, as included
- * in read attribute response messages and attribute reporting messages.
+ * Determines the number of octets used to represent a ZCL serialized
+ * data value at the specified buffer offset.
  */
-gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataRecord (
-    gmosBuffer_t* dataBuffer, uint16_t recordOffset, bool checkStatus,
+gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataSize (
+    gmosBuffer_t* dataBuffer, uint16_t dataItemOffset,
+    uint8_t* dataSize)
+{
+    gmosBufferCursor_t dataCursor;
+
+    if (!gmosBufferCursorInit (
+        &dataCursor, dataBuffer, dataItemOffset)) {
+        return GMOS_ZIGBEE_ZCL_STATUS_ABORT;
+    }
+    return gmosZigbeeZclParseDataSizeAtCursor (&dataCursor, dataSize);
+}
+
+/*
+ * Parses a complete attribute data record at the current data buffer
+ * cursor position, as included in read attribute response messages and
+ * attribute reporting messages. A local copy of the cursor is used, so
+ * the cursor position is not changed.
+ */
+gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataRecordAtCursor (
+    gmosBufferCursor_t* recordCursor, bool checkStatus,
     gmosZigbeeZclDataRecord_t* dataRecord, uint8_t* octetArray,
     uint8_t octetArraySize, uint8_t* recordSize)
 {
+    gmosBufferCursor_t dataCursor;
     uint8_t dataArray [8];
     uint8_t dataType;
     uint_fast8_t dataSize;
     uint_fast8_t headerSize;
-    uint_fast8_t dataItemOffset;
     uint_fast8_t stringSize;
     uint_fast8_t typeCategory;
     uint_fast8_t i;
@@ -687,8 +706,10 @@ gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataRecord (
     dataRecord->attrStatus = GMOS_ZIGBEE_ZCL_STATUS_NULL;
 
     // Extract the attribute ID and optional status byte from the data
-    // buffer.
-    if (!gmosBufferRead (dataBuffer, recordOffset, dataArray, 3)) {
+    // buffer. The record fields are read in order using the local
+    // buffer cursor.
+    dataCursor = *recordCursor;
+    if (!gmosBufferCursorPeek (&dataCursor, dataArray, 3)) {
         return GMOS_ZIGBEE_ZCL_STATUS_ABORT;
     }
     dataRecord->attrId = (uint16_t) dataArray [0];
@@ -706,8 +727,8 @@ gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataRecord (
     }
 
     // Extract the data type byte from the data buffer.
-    dataItemOffset = recordOffset + headerSize;
-    if (!gmosBufferRead (dataBuffer, dataItemOffset, &dataType, 1)) {
+    gmosBufferCursorSkip (&dataCursor, headerSize);
+    if (!gmosBufferCursorReadU8 (&dataCursor, &dataType)) {
         return GMOS_ZIGBEE_ZCL_STATUS_ABORT;
     }
     dataRecord->attrType = dataType;
@@ -728,8 +749,7 @@ gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataRecord (
     }
 
     // Read the fixed data bytes.
-    if (!gmosBufferRead (dataBuffer,
-        dataItemOffset + 1, dataArray, dataSize)) {
+    if (!gmosBufferCursorRead (&dataCursor, dataArray, dataSize)) {
         return GMOS_ZIGBEE_ZCL_STATUS_ABORT;
     }
 
@@ -747,8 +767,8 @@ gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataRecord (
         if (stringSize > octetArraySize) {
             return GMOS_ZIGBEE_ZCL_STATUS_INVALID_VALUE;
         }
-        if (!gmosBufferRead (
-            dataBuffer, dataItemOffset + 2, octetArray, stringSize)) {
+        if (!gmosBufferCursorRead (
+            &dataCursor, octetArray, stringSize)) {
             return GMOS_ZIGBEE_ZCL_STATUS_ABORT;
         }
         dataRecord->attrData.octetArray.dataLength = dataArray [0];
@@ -799,15 +819,37 @@ gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataRecord (
 }
 
 /*
- * Parses attribute data from a buffer, updating the locally stored
- * attribute value. The data is only parsed if the data type at the
- * specified data item offset matches the data type specified in the
- * attribute data structure.
+ * Parses a complete attribute data record from the specified buffer
+ * offset.
  */
-gmosZigbeeZclStatusCode_t gmosZigbeeZclParseAttrData (
-    gmosZigbeeZclAttr_t* zclAttr, gmosBuffer_t* dataBuffer,
-    uint16_t dataItemOffset, bool commitWrite)
+gmosZigbeeZclStatusCode_t gmosZigbeeZclParseDataRecord (
+    gmosBuffer_t* dataBuffer, uint16_t recordOffset, bool checkStatus,
+    gmosZigbeeZclDataRecord_t* dataRecord, uint8_t* octetArray,
+    uint8_t octetArraySize, uint8_t* recordSize)
+{
+    gmosBufferCursor_t dataCursor;
+
+    if (!gmosBufferCursorInit (&dataCursor, dataBuffer, recordOffset)) {
+        dataRecord->attrStatus = GMOS_ZIGBEE_ZCL_STATUS_NULL;
+        return GMOS_ZIGBEE_ZCL_STATUS_ABORT;
+    }
+    return gmosZigbeeZclParseDataRecordAtCursor (&dataCursor,
+        checkStatus, dataRecord, octetArray, octetArraySize,
+        recordSize);
+}
+
+/*
+ * Parses attribute data at the current data buffer cursor position,
+ * updating the locally stored attribute value. The data is only parsed
+ * if the data type at the cursor position matches the data type
+ * specified in the attribute data structure. A local copy of the
+ * cursor is used, so the cursor position is not changed.
+ */
+gmosZigbeeZclStatusCode_t gmosZigbeeZclParseAttrDataAtCursor (
+    gmosZigbeeZclAttr_t* zclAttr, gmosBufferCursor_t* itemCursor,
+    bool commitWrite)
 {
+    gmosBufferCursor_t dataCursor;
     uint8_t dataArray [9];
     uint_fast8_t dataSize;
     uint_fast8_t attrOptions = zclAttr->attrOptions;
@@ -822,8 +864,9 @@ gmosZigbeeZclStatusCode_t gmosZigbeeZclParseAttrData (
         dataSize = zclAttr->attrOptions &
             GMOS_ZIGBEE_ZCL_ATTR_OPTION_FIXED_SIZE_MASK;
     }
-    if ((dataSize > 8) || (!gmosBufferRead (
-        dataBuffer, dataItemOffset, dataArray, dataSize + 1))) {
+    dataCursor = *itemCursor;
+    if ((dataSize > 8) || (!gmosBufferCursorRead (
+        &dataCursor, dataArray, dataSize + 1))) {
         return GMOS_ZIGBEE_ZCL_STATUS_ABORT;
     }
 
@@ -841,7 +884,7 @@ gmosZigbeeZclStatusCode_t gmosZigbeeZclParseAttrData (
                 return GMOS_ZIGBEE_ZCL_STATUS_INVALID_VALUE;
             }
             if (commitWrite) {
-                if (!gmosBufferRead (dataBuffer, dataItemOffset + 2,
+                if (!gmosBufferCursorRead (&dataCursor,
                     zclAttr->attrData.octetArray.dataPtr, arrayLength)) {
                     return GMOS_ZIGBEE_ZCL_STATUS_ABORT;
                 }
@@ -901,6 +944,24 @@ gmosZigbeeZclStatusCode_t gmosZigbeeZclParseAttrData (
     return GMOS_ZIGBEE_ZCL_STATUS_SUCCESS;
 }
 
+/*
+ * Parses attribute data from the specified buffer offset, updating the
+ * locally stored attribute value.
+ */
+gmosZigbeeZclStatusCode_t gmosZigbeeZclParseAttrData (
+    gmosZigbeeZclAttr_t* zclAttr, gmosBuffer_t* dataBuffer,
+    uint16_t dataItemOffset, bool commitWrite)
+{
+    gmosBufferCursor_t dataCursor;
+
+    if (!gmosBufferCursorInit (
+        &dataCursor, dataBuffer, dataItemOffset)) {
+        return GMOS_ZIGBEE_ZCL_STATUS_ABORT;
+    }
+    return gmosZigbeeZclParseAttrDataAtCursor (
+        zclAttr, &dataCursor, commitWrite);
+}
+
 /*
  * Serialize the attribute data, appending it to the provided data
  * buffer.
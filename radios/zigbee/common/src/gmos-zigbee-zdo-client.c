@@ -1,7 +1,7 @@
 /*
  * The Gubbins Microcontroller Operating System
  *
- * Copyright 2022-2025 Zynaptic Limited
+ * Copyright 2022-2026 Zynaptic Limited
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,6 +28,7 @@
 #include "gmos-config.h"
 #include "gmos-platform.h"
 #include "gmos-scheduler.h"
+#include "gmos-timers.h"
 #include "gmos-buffers.h"
 #include "gmos-zigbee-config.h"
 #include "gmos-zigbee-stack.h"
@@ -136,9 +137,14 @@ static bool gmosZigbeeZdoClientUnicastRequest (
         zdoClient->requestTimeouts [slot] = zdoTimeout;
     }
 
-    // Ensure that the transaction timeout task is running.
+    // Ensure that the transaction timeout timer is running. New
+    // transactions always have the latest timeout, so a running timer
+    // does not need to be modified.
     zdoClient->sequenceCounter += 1;
-    gmosSchedulerTaskResume (&(zdoClient->timeoutTask));
+    if (!gmosTimerIsRunning (&(zdoClient->timeoutTimer))) {
+        gmosTimerStart (
+            &(zdoClient->timeoutTimer), ZDO_TRANSACTION_TIMEOUT);
+    }
     return true;
 }
 
@@ -209,18 +215,23 @@ static bool gmosZigbeeZdoClientBroadcastRequest (
         zdoClient->requestTimeouts [slot] = zdoTimeout;
     }
 
-    // Ensure that the transaction timeout task is running.
+    // Ensure that the transaction timeout timer is running. New
+    // transactions always have the latest timeout, so a running timer
+    // does not need to be modified.
     zdoClient->sequenceCounter += 1;
-    gmosSchedulerTaskResume (&(zdoClient->timeoutTask));
+    if (!gmosTimerIsRunning (&(zdoClient->timeoutTimer))) {
+        gmosTimerStart (
+            &(zdoClient->timeoutTimer), ZDO_TRANSACTION_TIMEOUT);
+    }
     return true;
 }
 
 /*
- * Implement ZDO transaction timeout management task.
+ * Implement ZDO transaction timeout management timer callback.
  */
-static gmosTaskStatus_t gmosZigbeeZdoClientTimeoutHandler (void* taskData)
+static void gmosZigbeeZdoClientTimeoutHandler (void* timerData)
 {
-    gmosZigbeeZdoClient_t* zdoClient = (gmosZigbeeZdoClient_t*) taskData;
+    gmosZigbeeZdoClient_t* zdoClient = (gmosZigbeeZdoClient_t*) timerData;
     gmosZigbeeZdoClientResultHandler_t resultHandler;
     uint_fast8_t slot;
     int32_t timeout;
@@ -244,8 +255,8 @@ static gmosTaskStatus_t gmosZigbeeZdoClientTimeoutHandler (void* taskData)
                 gmosBufferReset (&emptyBuffer, 0);
             }
 
-            // If the timeout has not expired, reshedule the timeout
-            // handler task to run again.
+            // If the timeout has not expired, restart the timeout
+            // timer for the next expiry time.
             else {
                 if (((uint32_t) timeout) < nextDelay) {
                     nextDelay = (uint32_t) timeout;
@@ -254,14 +265,12 @@ static gmosTaskStatus_t gmosZigbeeZdoClientTimeoutHandler (void* taskData)
         }
     }
 
-    // Reschedule the task if another timeout is pending.
-    if (nextDelay == UINT32_MAX) {
-        return GMOS_TASK_SUSPEND;
-    } else {
+    // Restart the timer if another timeout is pending.
+    if (nextDelay != UINT32_MAX) {
         GMOS_LOG_FMT (LOG_VERBOSE,
             "Setting next ZDO transaction timeout to %d ticks.",
             nextDelay);
-        return GMOS_TASK_RUN_LATER (nextDelay);
+        gmosTimerStart (&(zdoClient->timeoutTimer), nextDelay);
     }
 }
 
@@ -271,7 +280,6 @@ static gmosTaskStatus_t gmosZigbeeZdoClientTimeoutHandler (void* taskData)
 void gmosZigbeeZdoClientInit (gmosZigbeeZdoClient_t* zdoClient,
     gmosZigbeeStack_t* zigbeeStack)
 {
-    gmosTaskState_t* timeoutTask = &(zdoClient->timeoutTask);
     uint_fast8_t i;
 
     // Reset all the ZDO transaction states.
@@ -286,11 +294,9 @@ void gmosZigbeeZdoClientInit (gmosZigbeeZdoClient_t* zdoClient,
     zdoClient->zigbeeStack = zigbeeStack;
     zigbeeStack->zdoClient = zdoClient;
 
-    // Initialise the ZDO timeout task.
-    timeoutTask->taskTickFn = gmosZigbeeZdoClientTimeoutHandler;
-    timeoutTask->taskData = zdoClient;
-    timeoutTask->taskName = GMOS_PLATFORM_STRING_WRAPPER ("ZDO Client");
-    gmosSchedulerTaskStart (timeoutTask);
+    // Initialise the ZDO transaction timeout timer.
+    gmosTimerInit (&(zdoClient->timeoutTimer),
+        gmosZigbeeZdoClientTimeoutHandler, zdoClient);
 }
 
 /*